@@ -8,45 +8,141 @@
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
+#include <thread>
+#include "control_domain.h"
+#include "cpu_topology.h"
+#include "platform/iperf_sampler.h"
+#include "platform/isleep_monitor.h"
 #include "platform/isystem_monitor.h"
+#include "power_tier.h"
+#include "schedule.h"
+#include "workload_classifier.h"
 
 class ActivityMonitor
 {
 public:
     ActivityMonitor();
+    explicit ActivityMonitor(std::unique_ptr<ISystemMonitor> systemMonitor);
     ~ActivityMonitor();
 
     using ActivityCallback = std::function<void(bool)>;
+    /// Returns false if the tier did not apply; it is requested again at the next check
+    using TierCallback = std::function<bool(PowerTier)>;
+    using DomainTierCallback = std::function<bool(const ControlDomain&, PowerTier)>;
+    using UtilizationCallback = std::function<void(const std::vector<double>&)>;
+    using ResumeCallback = std::function<void()>;
 
     bool start();
     void stop();
     void setActivityCallback(ActivityCallback callback);
+    void setTierCallback(TierCallback callback);
+    /**
+     * Called instead of the tier callback to request a tier that did not apply
+     * again, so only the failed part (e.g. the power backend) is switched once more
+     */
+    void setTierRetryCallback(TierCallback callback);
+    void setDomainTierCallback(DomainTierCallback callback);
+    void setUtilizationCallback(UtilizationCallback callback);
+    /**
+     * Called after a resume, before the tier is decided and applied again
+     */
+    void setResumeCallback(ResumeCallback callback);
+    void setControlDomainScope(ControlDomainScope scope);
+    bool usesControlDomains() const { return !m_domains.empty(); }
+    void setSchedule(const Schedule& schedule);
     void setLoadThresholds(double highPerformanceThreshold, double powerSaveThreshold);
     void setMonitoringFrequency(int frequencySeconds);
+    /**
+     * Classify load from hardware counters; memory-bound load gets BALANCED_PERFORMANCE instead of PERFORMANCE
+     * @param sampler initialized counter sampler, sampled once per load check
+     * @param memoryBoundThreshold memory-boundedness at which load counts as memory-bound
+     */
+    void setPerfSampler(std::unique_ptr<IPerfSampler> sampler, double memoryBoundThreshold);
+    /**
+     * Resynchronise after suspend: on resume the load is sampled afresh and the tier applied again
+     * @param sleepMonitor monitor reporting suspended time; its wakeups end the monitor sleep at once
+     */
+    void setSleepMonitor(std::unique_ptr<ISleepMonitor> sleepMonitor);
     bool isActive() const;
+    const CpuTopology& getCpuTopology() const { return m_topology; }
 
 private:
+    /**
+     * Decision state of one control domain
+     * Every domain runs the same threshold/hysteresis logic on the utilization of its own CPUs
+     */
+    struct DomainState
+    {
+        ControlDomain domain;
+        bool isActive{false};
+        double utilization{0.0};
+        PowerTier currentTier{PowerTier::POWER_SAVE};
+        bool tierApplied{false};
+        std::chrono::steady_clock::time_point lastStateChangeTime;
+    };
+
     double getLoadAverage();
     int getCpuCoreCount();
+    void readCpuCapacity();
     void monitorLoop();
+    bool applyScheduleProfile(std::chrono::system_clock::time_point now);
+    void notifyStateChange();
+    bool tierPending() const;
+    PowerTier targetTier() const;
+    PowerTier targetTier(bool isActive) const;
+    bool initializeControlDomains();
+    void refreshControlDomains();
+    bool evaluateDomains(const std::vector<double>& utilization, std::chrono::steady_clock::time_point now, bool initial);
+    void notifyDomainStateChanges();
+    bool updateWorkloadClass(std::chrono::steady_clock::time_point now);
+    void resynchronize(std::chrono::milliseconds suspended);
+    double utilizationLoad(const std::vector<double>& utilization) const;
 
     bool m_isActive;
     std::atomic<bool> m_running;
     std::atomic<bool> m_threadReady;
+    std::thread m_monitorThread;
     std::mutex m_readyMutex;
     std::condition_variable m_readyCondition;
     std::mutex m_monitorMutex;
     std::condition_variable m_monitorCondition;
     double m_highPerformanceThreshold;
     double m_powerSaveThreshold;
+    double m_baseHighPerformanceThreshold;
+    double m_basePowerSaveThreshold;
     int m_monitoringFrequencySeconds;
     int m_cpuCoreCount;
+    double m_cpuCapacity;                   ///< summed CPU capacity, equals the core count on homogeneous machines
+    CpuTopology m_topology;
     ActivityCallback m_callback;
+    TierCallback m_tierCallback;
+    TierCallback m_tierRetryCallback;
+    DomainTierCallback m_domainTierCallback;
+    UtilizationCallback m_utilizationCallback;
+    ResumeCallback m_resumeCallback;
+    ControlDomainScope m_controlDomainScope;
+    std::vector<DomainState> m_domains;     ///< empty = system-wide control
+    PowerTier m_currentTier;
+    bool m_tierApplied;
+    bool m_tierRetryPending;                ///< the tier callback ran for m_currentTier but reported a failure
+    Schedule m_schedule;
+    const ScheduleProfile* m_activeProfile;
+    std::chrono::system_clock::time_point m_nextScheduleBoundary;
     std::unique_ptr<ISystemMonitor> m_systemMonitor;
+    std::unique_ptr<IPerfSampler> m_perfSampler;
+    WorkloadClassifier m_workloadClassifier;
+    bool m_memoryBound;                     ///< memory-bound class as last applied to the tier
+    std::unique_ptr<ISleepMonitor> m_sleepMonitor;
+    std::atomic<bool> m_wakePending;        ///< the sleep monitor saw a possible resume
+    std::chrono::milliseconds m_suspendedTime;          ///< suspended time at the last check
+    std::chrono::steady_clock::time_point m_freshSignalUntil;   ///< load average still reflects the time before a suspend
 
     std::chrono::steady_clock::time_point m_lastLoadCheckTime;
     std::chrono::steady_clock::time_point m_lastStateChangeTime;
     static constexpr int MINIMUM_STATE_CHANGE_INTERVAL = 60;
+    static constexpr std::chrono::milliseconds MINIMUM_SUSPEND{1000};       ///< shorter gaps are clock noise
+    static constexpr std::chrono::milliseconds RESUME_SAMPLE_WINDOW{500};  ///< utilization interval taken after resume
+    static constexpr std::chrono::seconds LOAD_AVERAGE_SETTLE{60};          ///< time for the 1-minute load average to forget a suspend
 };
 
 #endif // DDOGREEN_ACTIVITY_MONITOR_H
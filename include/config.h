@@ -1,8 +1,16 @@
 #ifndef DDOGREEN_CONFIG_H
 #define DDOGREEN_CONFIG_H
 
+#include <optional>
 #include <string>
 #include <span>
+#include <vector>
+#include "control_domain.h"
+#include "energy_model.h"
+#include "external_change_guard.h"
+#include "knob_profile.h"
+#include "schedule.h"
+#include "turbo_policy.h"
 
 /**
  * Configuration management for ddogreen
@@ -20,6 +28,33 @@ public:
     int getMonitoringFrequency() const { return m_monitoringFrequency; }
     double getHighPerformanceThreshold() const { return m_highPerformanceThreshold; }
     double getPowerSaveThreshold() const { return m_powerSaveThreshold; }
+    const Schedule& getSchedule() const { return m_schedule; }
+    const std::vector<std::string>& getPowerBackendOrder() const { return m_powerBackendOrder; }
+    const KnobProfiles& getKnobProfiles() const { return m_knobProfiles; }
+    ControlDomainScope getControlDomainScope() const { return m_controlDomainScope; }
+    std::optional<double> getFrequencyCapTarget() const { return m_frequencyCapTarget; }
+    const EnergyModelTables& getEnergyModelTables() const { return m_energyModelTables; }
+    std::optional<int> getPmQosLatency() const { return m_pmQosLatency; }
+    bool getPmQosPerCpu() const { return m_pmQosPerCpu; }
+    const std::vector<int>& getParkCpus() const { return m_parkCpus; }
+    const std::vector<int>& getIrqHousekeepingCpus() const { return m_irqHousekeepingCpus; }
+    int getIrqMaxRate() const { return m_irqMaxRate; }
+    const std::vector<std::string>& getCpusetCgroups() const { return m_cpusetCgroups; }
+    const std::vector<std::string>& getUclampMinCgroups() const { return m_uclampMinCgroups; }
+    int getUclampMin() const { return m_uclampMin; }
+    const std::vector<std::string>& getUclampMaxCgroups() const { return m_uclampMaxCgroups; }
+    int getUclampMax() const { return m_uclampMax; }
+    std::optional<double> getIdleInjectionPowerLimit() const { return m_idleInjectionPowerLimit; }
+    std::optional<double> getIdleInjectionThermalLimit() const { return m_idleInjectionThermalLimit; }
+    const std::vector<std::string>& getIdleInjectionCgroups() const { return m_idleInjectionCgroups; }
+    bool getPerfCounters() const { return m_perfCounters; }
+    double getMemoryBoundThreshold() const { return m_memoryBoundThreshold; }
+    ExternalChangePolicy getExternalChangePolicy() const { return m_externalChangePolicy; }
+    std::optional<double> getSmtOffUtilization() const { return m_smtOffUtilization; }
+    std::optional<TurboSettings> getTurboSettings() const
+    {
+        return m_turboControl ? std::optional<TurboSettings>{m_turboSettings} : std::nullopt;
+    }
 
     static std::string getDefaultConfigPath();
 
@@ -27,12 +62,45 @@ private:
     int m_monitoringFrequency;
     double m_highPerformanceThreshold;
     double m_powerSaveThreshold;
+    Schedule m_schedule;
+    std::vector<std::string> m_powerBackendOrder;   ///< empty = pick the fastest capable backend
+    KnobProfiles m_knobProfiles;
+    ControlDomainScope m_controlDomainScope;        ///< granularity of tier decisions
+    std::optional<double> m_frequencyCapTarget;     ///< unset = no scaling_max_freq controller
+    EnergyModelTables m_energyModelTables;          ///< vendor operating point tables, keyed by CPU
+    std::optional<int> m_pmQosLatency;              ///< microseconds, unset = no latency request
+    bool m_pmQosPerCpu;                             ///< bound busy CPUs only
+    std::vector<int> m_parkCpus;                    ///< CPUs taken offline in the power save tier
+    std::vector<int> m_irqHousekeepingCpus;         ///< CPUs taking the interrupts in the power save tier
+    int m_irqMaxRate;                               ///< interrupts per second that keep one source spread
+    std::vector<std::string> m_cpusetCgroups;       ///< cgroups confined to efficiency CPUs in power save
+    std::vector<std::string> m_uclampMinCgroups;    ///< interactive cgroups given a utilization floor
+    int m_uclampMin;                                ///< percent
+    std::vector<std::string> m_uclampMaxCgroups;    ///< background cgroups given a utilization cap
+    int m_uclampMax;                                ///< percent
+    std::optional<double> m_idleInjectionPowerLimit;    ///< watts, unset = no power budget
+    std::optional<double> m_idleInjectionThermalLimit;  ///< degrees Celsius, unset = no thermal budget
+    std::vector<std::string> m_idleInjectionCgroups;    ///< throttled when intel_powerclamp is missing
+    bool m_perfCounters;                            ///< classify load from hardware counters
+    double m_memoryBoundThreshold;                  ///< memory-boundedness that caps the tier at balanced performance
+    ExternalChangePolicy m_externalChangePolicy;    ///< reaction to settings changed by other agents
+    std::optional<double> m_smtOffUtilization;     ///< unset = SMT left alone
+    bool m_turboControl;                            ///< false = turbo left to the backends
+    TurboSettings m_turboSettings;
+
+    static constexpr int MAX_CPUS = 8192;           ///< kernel NR_CPUS limit
 
     static std::string trim(std::span<const char> str);
     bool parseLine(std::span<const char> line);
     bool parseLineString(const std::string& line);
     bool parseKeyValue(const std::string& key, const std::string& value);
     bool validateConfiguration() const;
+    bool parsePowerBackendOrder(const std::string& value);
+    bool parseKnobSetting(const std::string& tierName, const std::string& value);
+    bool parseEnergyModel(const std::string& domainName, const std::string& value);
+    bool parseParkCpus(const std::string& value);
+    static std::optional<std::vector<int>> parseCpuList(const std::string& value);
+    static std::optional<std::vector<std::string>> parseCgroupList(const std::string& value);
 };
 
 #endif // DDOGREEN_CONFIG_H
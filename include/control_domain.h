@@ -0,0 +1,69 @@
+#ifndef DDOGREEN_CONTROL_DOMAIN_H
+#define DDOGREEN_CONTROL_DOMAIN_H
+
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Granularity at which tier decisions are made
+ */
+enum class ControlDomainScope
+{
+    SYSTEM,             ///< one decision for the whole machine
+    CPUFREQ_POLICY,     ///< one decision per cpufreq policy (CPU cluster)
+    PACKAGE             ///< one decision per CPU package (socket) and its NUMA nodes
+};
+
+/**
+ * A group of CPUs whose performance is controlled together
+ * On Linux this is one cpufreq policy, i.e. one cluster on hybrid and big.LITTLE
+ * machines, or one package on multi-socket machines
+ */
+struct ControlDomain
+{
+    std::string name;       ///< platform identifier, e.g. "policy0" or "package1"
+    std::vector<int> cpus;  ///< logical CPU numbers in the domain
+    ControlDomainScope scope{ControlDomainScope::CPUFREQ_POLICY};
+    int package{-1};        ///< package id for PACKAGE domains, -1 otherwise
+};
+
+/**
+ * Convert a scope to its configuration name
+ * @param scope scope to convert
+ * @return "system", "cpufreq_policy" or "package"
+ */
+inline std::string controlDomainScopeToString(ControlDomainScope scope)
+{
+    switch (scope)
+    {
+        case ControlDomainScope::SYSTEM:         return "system";
+        case ControlDomainScope::CPUFREQ_POLICY: return "cpufreq_policy";
+        case ControlDomainScope::PACKAGE:        return "package";
+        default:                                 return "unknown";
+    }
+}
+
+/**
+ * Parse a scope name from configuration
+ * @param name scope name
+ * @return parsed scope, or std::nullopt if the name is not recognised
+ */
+inline std::optional<ControlDomainScope> parseControlDomainScope(const std::string& name)
+{
+    if (name == "system")
+    {
+        return ControlDomainScope::SYSTEM;
+    }
+    if (name == "cpufreq_policy")
+    {
+        return ControlDomainScope::CPUFREQ_POLICY;
+    }
+    if (name == "package")
+    {
+        return ControlDomainScope::PACKAGE;
+    }
+    return std::nullopt;
+}
+
+#endif // DDOGREEN_CONTROL_DOMAIN_H
@@ -0,0 +1,101 @@
+#ifndef DDOGREEN_CPU_TOPOLOGY_H
+#define DDOGREEN_CPU_TOPOLOGY_H
+
+#include <string>
+#include <vector>
+
+/**
+ * Core type of a logical CPU on hybrid processors
+ */
+enum class CoreType
+{
+    UNKNOWN,        ///< not reported (homogeneous machines, most ARM systems)
+    PERFORMANCE,    ///< Intel P-core (cpu_core PMU)
+    EFFICIENCY      ///< Intel E-core (cpu_atom PMU)
+};
+
+/**
+ * Topology of one logical CPU
+ */
+struct CpuInfo
+{
+    int cpu{0};
+    CoreType type{CoreType::UNKNOWN};
+    double capacity{1.0};           ///< raw capacity, normalised to the fastest CPU by CpuTopology
+    int package{0};
+    int core{0};                    ///< core id within the package
+    int cacheId{-1};                ///< last level cache id, -1 if unknown
+    std::vector<int> smtSiblings;   ///< hardware threads of the same core, including this CPU
+};
+
+/**
+ * CPU topology with capacity weighting
+ * A CPU with capacity 1.0 is as fast as the fastest CPU of the machine, so on
+ * homogeneous machines the total capacity equals the logical CPU count and
+ * weighted values match the plain ones
+ */
+class CpuTopology
+{
+public:
+    CpuTopology() = default;
+
+    /**
+     * @param cpus per-CPU topology; capacities are normalised so the fastest CPU has 1.0
+     */
+    explicit CpuTopology(std::vector<CpuInfo> cpus);
+
+    bool empty() const { return m_cpus.empty(); }
+    const std::vector<CpuInfo>& getCpus() const { return m_cpus; }
+
+    /**
+     * @return true if CPUs differ in capacity or core type
+     */
+    bool isHybrid() const;
+
+    /**
+     * @param cpu logical CPU number
+     * @return the CPU's topology, or nullptr if the CPU is unknown or offline
+     */
+    const CpuInfo* find(int cpu) const;
+
+    /**
+     * @return summed capacity of all CPUs, in units of the fastest CPU
+     */
+    double getCapacity() const;
+
+    /**
+     * @param cpus logical CPU numbers
+     * @return summed capacity of the listed CPUs that are known
+     */
+    double getCapacity(const std::vector<int>& cpus) const;
+
+    /**
+     * Capacity-weighted utilization of a set of CPUs
+     * CPUs missing from a non-empty topology are offline and left out
+     * @param utilization busy fraction per CPU, indexed by CPU number
+     * @param cpus CPUs to include
+     * @return share of the set's capacity in use (0.0-1.0)
+     */
+    double weightedUtilization(const std::vector<double>& utilization, const std::vector<int>& cpus) const;
+
+    /**
+     * CPUs of the slowest class: E-cores where core types are reported, otherwise
+     * the lowest-capacity CPUs of a capacity-hybrid (big.LITTLE) machine
+     * @return CPU numbers, empty on homogeneous machines
+     */
+    std::vector<int> getEfficiencyCpus() const;
+
+    int countCpus(CoreType type) const;
+    int getPhysicalCoreCount() const;
+    int getPackageCount() const;
+
+    /**
+     * @return short summary such as "6P+8E cores, 20 CPUs, 1 package(s), capacity 14.40"
+     */
+    std::string describe() const;
+
+private:
+    std::vector<CpuInfo> m_cpus;    ///< ordered by CPU number
+};
+
+#endif // DDOGREEN_CPU_TOPOLOGY_H
@@ -0,0 +1,69 @@
+#ifndef DDOGREEN_ENERGY_MODEL_H
+#define DDOGREEN_ENERGY_MODEL_H
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief One operating performance point of a performance domain
+ */
+struct OperatingPoint
+{
+    int frequencyKhz{0};
+    double power{0.0};      ///< active power at this frequency, any consistent unit
+    double cost{0.0};       ///< energy per unit of work; derived from power/frequency when zero
+};
+
+/**
+ * Operating points per performance domain, keyed by a CPU of the domain
+ */
+using EnergyModelTables = std::map<int, std::vector<OperatingPoint>>;
+
+/**
+ * @brief Energy model of one performance domain with a precomputed selection table
+ * The cheapest point that reaches a demand is looked up rather than searched,
+ * so selecting a point each tick is O(1)
+ */
+class EnergyModel
+{
+public:
+    /**
+     * @param points operating points in any order; points without frequency are dropped
+     */
+    explicit EnergyModel(std::vector<OperatingPoint> points);
+
+    bool empty() const { return m_points.empty(); }
+    const std::vector<OperatingPoint>& getOperatingPoints() const { return m_points; }
+
+    /**
+     * @return highest frequency of the model in kHz, 0 if empty
+     */
+    int getMaxFrequency() const { return m_points.empty() ? 0 : m_points.back().frequencyKhz; }
+
+    /**
+     * Cheapest operating point that reaches a demand
+     * @param demand required performance as a fraction of the highest frequency, rounded up
+     *               to the table resolution; values above 1.0 select the fastest point
+     * @return selected point; the model must not be empty
+     */
+    const OperatingPoint& select(double demand) const;
+
+    /**
+     * Parse a configured table such as "1200000:150,1800000:320,2400000:700"
+     * @param table comma separated frequency_khz:power pairs
+     * @return operating points, or std::nullopt if the table is malformed
+     */
+    static std::optional<std::vector<OperatingPoint>> parseTable(const std::string& table);
+
+private:
+    static constexpr size_t TABLE_RESOLUTION = 100;     ///< one entry per percent of the highest frequency
+
+    std::vector<OperatingPoint> m_points;               ///< ascending frequency
+    std::array<size_t, TABLE_RESOLUTION + 1> m_table{}; ///< demand percent -> index into m_points
+};
+
+#endif // DDOGREEN_ENERGY_MODEL_H
@@ -0,0 +1,142 @@
+#ifndef DDOGREEN_EXTERNAL_CHANGE_GUARD_H
+#define DDOGREEN_EXTERNAL_CHANGE_GUARD_H
+
+#include "platform/ipower_manager.h"
+#include <chrono>
+#include <map>
+#include <optional>
+#include <string>
+
+/**
+ * What to do when another agent changes a setting the backend applied
+ */
+enum class ExternalChangePolicy
+{
+    OFF,        ///< do not check
+    ADOPT,      ///< keep the other agent's value until the next tier change
+    BACKOFF,    ///< keep the other agent's value and stop switching for a while
+    REAPPLY     ///< write our value again, at most once per hold-off
+};
+
+/**
+ * Convert a policy to its configuration name
+ * @param policy policy to convert
+ * @return "off", "adopt", "backoff" or "reapply"
+ */
+inline std::string externalChangePolicyToString(ExternalChangePolicy policy)
+{
+    switch (policy)
+    {
+        case ExternalChangePolicy::OFF:     return "off";
+        case ExternalChangePolicy::ADOPT:   return "adopt";
+        case ExternalChangePolicy::BACKOFF: return "backoff";
+        case ExternalChangePolicy::REAPPLY: return "reapply";
+        default:                            return "unknown";
+    }
+}
+
+/**
+ * Parse a policy name from configuration
+ * @param name policy name
+ * @return parsed policy, or std::nullopt if the name is not recognised
+ */
+inline std::optional<ExternalChangePolicy> parseExternalChangePolicy(const std::string& name)
+{
+    if (name == "off")
+    {
+        return ExternalChangePolicy::OFF;
+    }
+    if (name == "adopt")
+    {
+        return ExternalChangePolicy::ADOPT;
+    }
+    if (name == "backoff")
+    {
+        return ExternalChangePolicy::BACKOFF;
+    }
+    if (name == "reapply")
+    {
+        return ExternalChangePolicy::REAPPLY;
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Keeps the backend from fighting other power management agents
+ *
+ * Tier requests go through the guard. Every check interval it asks the backend
+ * which applied settings someone else changed, reports them, and reacts as the
+ * policy says. While a hold-off runs, tier requests are only remembered; the
+ * latest one is applied when the hold-off ends. Each conflict that follows
+ * within a hold-off doubles the next one, up to a limit, so an agent that
+ * keeps winning is eventually left alone for long stretches.
+ */
+class ExternalChangeGuard
+{
+public:
+    /**
+     * @param powerManager backend whose settings are watched
+     * @param policy reaction to a change; OFF turns the guard into a pass-through
+     * @param checkInterval minimum time between two readbacks
+     */
+    ExternalChangeGuard(IPowerManager& powerManager, ExternalChangePolicy policy,
+                        std::chrono::seconds checkInterval = std::chrono::seconds(5));
+
+    /**
+     * Apply a system tier unless a hold-off runs
+     * A deferred tier is the guard's to apply when the hold-off ends
+     * @return true if the backend applied the tier or it was deferred
+     */
+    bool setTier(PowerTier tier, std::chrono::steady_clock::time_point now);
+
+    /**
+     * Apply a domain tier unless a hold-off runs
+     * @return true if the backend applied the tier or it was deferred
+     */
+    bool setDomainTier(const ControlDomain& domain, PowerTier tier, std::chrono::steady_clock::time_point now);
+
+    /**
+     * Check the first system tier request against the backend instead of switching
+     * If that request is for this tier and the backend confirms it by readback,
+     * the switch is skipped; any other first request is applied as usual
+     * @param tier tier the previous run applied last
+     */
+    void setWarmStartTier(PowerTier tier) { m_warmStartTier = tier; }
+
+    /**
+     * Check for external changes if the check interval has passed, and end an expired hold-off
+     * @param now current time
+     */
+    void update(std::chrono::steady_clock::time_point now);
+
+    /**
+     * Re-read the backend state after a resume
+     * Changes made while suspended, e.g. by TLP's udev rules on a power source
+     * change, are logged but not counted as conflicts; the tier applied next
+     * overrides them
+     */
+    void resync();
+
+    bool isEnabled() const { return m_policy != ExternalChangePolicy::OFF; }
+    bool isHolding(std::chrono::steady_clock::time_point now) const { return m_holdUntil && now < *m_holdUntil; }
+    int getConflicts() const { return m_conflicts; }
+    std::optional<PowerTier> getTier() const { return m_tier; }
+
+private:
+    std::chrono::seconds holdOff() const;
+    void reassert();
+
+    IPowerManager& m_powerManager;
+    ExternalChangePolicy m_policy;
+    std::chrono::seconds m_checkInterval;
+    std::optional<std::chrono::steady_clock::time_point> m_lastCheck;
+    std::optional<std::chrono::steady_clock::time_point> m_holdUntil;
+    std::chrono::steady_clock::time_point m_lastConflict;
+    std::optional<PowerTier> m_tier;                                    ///< last system tier requested
+    std::optional<PowerTier> m_warmStartTier;                           ///< tier the previous run left applied
+    std::map<std::string, std::pair<ControlDomain, PowerTier>> m_domainTiers;   ///< last tier per domain
+    int m_streak;           ///< conflicts without a conflict-free hold-off in between
+    int m_conflicts;        ///< conflicts in total
+};
+
+#endif // DDOGREEN_EXTERNAL_CHANGE_GUARD_H
@@ -0,0 +1,27 @@
+#ifndef DDOGREEN_KNOB_PROFILE_H
+#define DDOGREEN_KNOB_PROFILE_H
+
+#include <array>
+#include <string>
+#include <vector>
+
+/**
+ * One tunable of a knob profile
+ * The target is an absolute attribute path, which may contain glob patterns
+ * (e.g. a policy? or policy[0-3] component), or a sysctl name such as
+ * vm.dirty_writeback_centisecs. As in sysctl.d(5), a name containing '/'
+ * uses it as the separator, e.g. net/ipv4/conf/eth0.100/rp_filter
+ */
+struct KnobSetting
+{
+    std::string target;
+    std::string value;
+};
+
+/**
+ * Knob settings of every tier, indexed by PowerTier
+ * A knob that a tier does not list keeps the value it had before the daemon started
+ */
+using KnobProfiles = std::array<std::vector<KnobSetting>, 4>;
+
+#endif // DDOGREEN_KNOB_PROFILE_H
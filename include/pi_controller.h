@@ -0,0 +1,56 @@
+#ifndef DDOGREEN_PI_CONTROLLER_H
+#define DDOGREEN_PI_CONTROLLER_H
+
+/**
+ * @brief Tuning of a PiController
+ * Gains are per update, so the loop behaves the same at any monitoring frequency
+ */
+struct PiControllerSettings
+{
+    double kp{0.6};             ///< proportional gain
+    double ki{0.3};             ///< integral gain per update
+    double deadband{0.05};      ///< errors smaller than this are treated as zero
+    double outputMin{0.0};
+    double outputMax{1.0};
+    double maxStep{0.25};       ///< largest output change per update
+};
+
+/**
+ * @brief Discrete proportional-integral controller
+ * The error is measurement - setpoint, so a measurement above the setpoint
+ * raises the output. The integrator is clamped to the output range to avoid windup
+ */
+class PiController
+{
+public:
+    /**
+     * @param settings gains and limits
+     * @param initialOutput output before the first update, clamped to the output range
+     */
+    PiController(const PiControllerSettings& settings, double initialOutput);
+
+    /**
+     * Advance the controller by one sample
+     * @param setpoint desired measurement
+     * @param measurement observed measurement
+     * @return new output
+     */
+    double update(double setpoint, double measurement);
+
+    /**
+     * Drop the accumulated state and continue from a fixed output
+     * @param output new output, clamped to the output range
+     */
+    void reset(double output);
+
+    double getOutput() const { return m_output; }
+
+private:
+    double clamp(double value) const;
+
+    PiControllerSettings m_settings;
+    double m_integral;
+    double m_output;
+};
+
+#endif // DDOGREEN_PI_CONTROLLER_H
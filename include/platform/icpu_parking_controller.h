@@ -0,0 +1,42 @@
+#ifndef DDOGREEN_ICPU_PARKING_CONTROLLER_H
+#define DDOGREEN_ICPU_PARKING_CONTROLLER_H
+
+#include "power_tier.h"
+#include <vector>
+
+/**
+ * Interface for parking idle cores
+ * A configured set of non-boot CPUs is taken offline in the power save tier
+ * and brought back before the system leaves it or boosts
+ */
+class ICpuParkingController
+{
+public:
+    virtual ~ICpuParkingController() = default;
+
+    /**
+     * Select the CPUs to park
+     * @param cpus configured CPUs; the boot CPU and CPUs without hotplug support are skipped
+     * @return false if none of the CPUs can be parked
+     */
+    virtual bool initialize(const std::vector<int>& cpus) = 0;
+
+    /**
+     * Park the CPUs in the power save tier and bring them back in any other tier
+     * @param tier active tier
+     */
+    virtual void setTier(PowerTier tier) = 0;
+
+    /**
+     * Bring the parked CPUs back online ahead of a boost
+     */
+    virtual void unpark() = 0;
+
+    /**
+     * Bring every CPU this controller parked back online
+     * @return true if all of them are online again
+     */
+    virtual bool restore() = 0;
+};
+
+#endif // DDOGREEN_ICPU_PARKING_CONTROLLER_H
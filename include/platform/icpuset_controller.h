@@ -0,0 +1,38 @@
+#ifndef DDOGREEN_ICPUSET_CONTROLLER_H
+#define DDOGREEN_ICPUSET_CONTROLLER_H
+
+#include "power_tier.h"
+#include <string>
+#include <vector>
+
+/**
+ * Interface for confining background cgroups to efficiency CPUs in the power save tier
+ * Work in the confined cgroups no longer wakes the fast cores
+ */
+class ICpusetController
+{
+public:
+    virtual ~ICpusetController() = default;
+
+    /**
+     * Snapshot the CPU sets of the cgroups
+     * @param cgroups cgroup paths relative to the cgroup root, e.g. system.slice
+     * @param cpus CPUs the cgroups are confined to in the power save tier
+     * @return false if none of the cgroups has a writable CPU set
+     */
+    virtual bool initialize(const std::vector<std::string>& cgroups, const std::vector<int>& cpus) = 0;
+
+    /**
+     * Confine the cgroups in the power save tier and release them in every other tier
+     * @param tier active tier
+     */
+    virtual void setTier(PowerTier tier) = 0;
+
+    /**
+     * Write back the CPU sets from before confinement
+     * @return true if every CPU set was restored
+     */
+    virtual bool restore() = 0;
+};
+
+#endif // DDOGREEN_ICPUSET_CONTROLLER_H
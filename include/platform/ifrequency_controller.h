@@ -0,0 +1,61 @@
+#ifndef DDOGREEN_IFREQUENCY_CONTROLLER_H
+#define DDOGREEN_IFREQUENCY_CONTROLLER_H
+
+#include "energy_model.h"
+#include "power_tier.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Interface for continuous CPU frequency capping
+ * Instead of switching between fixed modes, the controller moves the maximum
+ * frequency of every frequency domain to track the utilization of its CPUs.
+ * Domains with an energy model get the cheapest operating point that meets
+ * the demand; the others follow a PI loop
+ */
+class IFrequencyController
+{
+public:
+    virtual ~IFrequencyController() = default;
+
+    /**
+     * Discover the frequency domains and snapshot their current limits
+     * @param targetUtilization utilization the controller steers each domain towards (0.0-1.0)
+     * @param configuredModels operating point tables that override the platform's energy model
+     * @return false if no domain can be capped
+     */
+    virtual bool initialize(double targetUtilization, const EnergyModelTables& configuredModels) = 0;
+
+    /**
+     * Run one control step
+     * @param utilization busy fraction per CPU, indexed by CPU number
+     */
+    virtual void update(const std::vector<double>& utilization) = 0;
+
+    /**
+     * Follow the active power tier
+     * The performance tier lifts the caps of PI domains and gives energy model
+     * domains extra headroom; the other tiers run at the target utilization
+     * @param tier active tier
+     */
+    virtual void setTier(PowerTier tier) = 0;
+
+    /**
+     * Write back the limits snapshotted by initialize()
+     * @return true if every domain was restored
+     */
+    virtual bool restore() = 0;
+
+    /**
+     * @return number of frequency domains under control
+     */
+    virtual size_t getDomainCount() const = 0;
+
+    /**
+     * @return paths of the frequency limits the controller writes
+     */
+    virtual std::vector<std::string> getControlledAttributes() const = 0;
+};
+
+#endif // DDOGREEN_IFREQUENCY_CONTROLLER_H
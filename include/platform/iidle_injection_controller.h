@@ -0,0 +1,54 @@
+#ifndef DDOGREEN_IIDLE_INJECTION_CONTROLLER_H
+#define DDOGREEN_IIDLE_INJECTION_CONTROLLER_H
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Injection level and its cost in scheduling latency
+ */
+struct IdleInjectionMetrics
+{
+    double injection{0.0};              ///< idle fraction currently forced
+    double averageInjection{0.0};       ///< idle fraction forced on average since start
+    double runDelayInjecting{0.0};      ///< run-queue wait in ms per CPU-second while injecting
+    double runDelayFree{0.0};           ///< run-queue wait in ms per CPU-second otherwise
+};
+
+/**
+ * Interface for forcing CPUs idle to hold a power or temperature budget
+ * Used where frequency caps alone cannot keep the package within the budget
+ */
+class IIdleInjectionController
+{
+public:
+    virtual ~IIdleInjectionController() = default;
+
+    /**
+     * Find the idle injection actuator and the budget sensors
+     * @param powerLimitWatts package power budget, unset for none
+     * @param thermalLimit CPU temperature budget in degrees Celsius, unset for none
+     * @param cgroups cgroups throttled through cpu.max when the kernel offers no idle injection
+     * @return false if there is no actuator or a budget cannot be measured
+     */
+    virtual bool initialize(std::optional<double> powerLimitWatts, std::optional<double> thermalLimit,
+                            const std::vector<std::string>& cgroups) = 0;
+
+    /**
+     * Measure the budget and adjust the injection
+     * @param now time of the sample
+     */
+    virtual void update(std::chrono::steady_clock::time_point now) = 0;
+
+    virtual IdleInjectionMetrics getMetrics() const = 0;
+
+    /**
+     * Stop injecting and write back the throttled cgroups
+     * @return true if everything was restored
+     */
+    virtual bool restore() = 0;
+};
+
+#endif // DDOGREEN_IIDLE_INJECTION_CONTROLLER_H
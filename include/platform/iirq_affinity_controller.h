@@ -0,0 +1,50 @@
+#ifndef DDOGREEN_IIRQ_AFFINITY_CONTROLLER_H
+#define DDOGREEN_IIRQ_AFFINITY_CONTROLLER_H
+
+#include "power_tier.h"
+#include <chrono>
+#include <vector>
+
+/**
+ * Interface for steering interrupts onto housekeeping CPUs in the power save tier
+ * Idle cores stay in deep C-states when no device interrupt is routed to them
+ */
+class IIrqAffinityController
+{
+public:
+    virtual ~IIrqAffinityController() = default;
+
+    /**
+     * Snapshot the current interrupt affinities
+     * @param housekeepingCpus CPUs that take the interrupts in the power save tier
+     * @param maxIrqRate interrupts per second above which one interrupt blocks consolidation
+     * @return false if no interrupt affinity can be read
+     */
+    virtual bool initialize(const std::vector<int>& housekeepingCpus, int maxIrqRate) = 0;
+
+    /**
+     * Consolidate interrupts in the power save tier and spread them again in every other tier
+     * @param tier active tier
+     */
+    virtual void setTier(PowerTier tier) = 0;
+
+    /**
+     * Sample the interrupt counters and spread the interrupts again if one of them gets busy
+     * @param now time of the sample
+     */
+    virtual void update(std::chrono::steady_clock::time_point now) = 0;
+
+    /**
+     * Device interrupts per second on each CPU over the last sample interval
+     * @return rates indexed by CPU number, empty until two samples were taken
+     */
+    virtual std::vector<double> getInterruptRates() const = 0;
+
+    /**
+     * Write back the affinities from before consolidation
+     * @return true if every affinity was restored
+     */
+    virtual bool restore() = 0;
+};
+
+#endif // DDOGREEN_IIRQ_AFFINITY_CONTROLLER_H
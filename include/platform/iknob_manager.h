@@ -0,0 +1,44 @@
+#ifndef DDOGREEN_IKNOB_MANAGER_H
+#define DDOGREEN_IKNOB_MANAGER_H
+
+#include "knob_profile.h"
+#include "power_tier.h"
+#include <cstddef>
+
+/**
+ * Interface for applying declarative knob profiles
+ * Writes the per-tier kernel tunables listed in the configuration and puts
+ * the original values back when the daemon stops
+ */
+class IKnobManager
+{
+public:
+    virtual ~IKnobManager() = default;
+
+    /**
+     * Resolve the configured targets and snapshot their current values
+     * @param profiles knob settings of every tier
+     * @return false if a target is not an allowed tunable or names a missing sysctl
+     */
+    virtual bool load(const KnobProfiles& profiles) = 0;
+
+    /**
+     * Apply the knob values of a tier
+     * @param tier tier to apply
+     * @return true if every changed knob was written
+     */
+    virtual bool applyTier(PowerTier tier) = 0;
+
+    /**
+     * Write back the values snapshotted by load()
+     * @return true if every knob was restored
+     */
+    virtual bool restore() = 0;
+
+    /**
+     * @return number of attributes the loaded profiles resolved to
+     */
+    virtual size_t getKnobCount() const = 0;
+};
+
+#endif // DDOGREEN_IKNOB_MANAGER_H
@@ -0,0 +1,35 @@
+#ifndef DDOGREEN_IPERF_SAMPLER_H
+#define DDOGREEN_IPERF_SAMPLER_H
+
+#include "workload_classifier.h"
+#include <optional>
+#include <string>
+
+/**
+ * Interface for system-wide hardware performance counters
+ * Counts cycles, instructions and a memory event on every CPU
+ */
+class IPerfSampler
+{
+public:
+    virtual ~IPerfSampler() = default;
+
+    /**
+     * Open the counters on every online CPU
+     * @return false if the hardware counters are not available (virtual machines, perf_event_paranoid, no PMU)
+     */
+    virtual bool initialize() = 0;
+
+    /**
+     * Read all counters
+     * @return deltas since the previous call, summed over the CPUs; std::nullopt on the first call or a read failure
+     */
+    virtual std::optional<PerfCounters> sample() = 0;
+
+    /**
+     * @return name of the memory event in use, e.g. "stalled-cycles-backend"
+     */
+    virtual std::string getMemoryEvent() const = 0;
+};
+
+#endif // DDOGREEN_IPERF_SAMPLER_H
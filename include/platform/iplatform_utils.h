@@ -95,6 +95,12 @@ public:
      */
     virtual std::string getDefaultConfigPath() const = 0;
 
+    /**
+     * Get the directory for persistent service state (caches, saved settings)
+     * @return platform-specific state directory path
+     */
+    virtual std::string getDefaultStateDirectory() const = 0;
+
     /**
      * Check if platform utilities are available
      * @return true if platform utilities are functional
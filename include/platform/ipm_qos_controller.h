@@ -0,0 +1,44 @@
+#ifndef DDOGREEN_IPM_QOS_CONTROLLER_H
+#define DDOGREEN_IPM_QOS_CONTROLLER_H
+
+#include "power_tier.h"
+#include <vector>
+
+/**
+ * Interface for CPU wakeup latency requests in the performance tier
+ * A latency bound keeps the CPUs out of C-states whose exit latency exceeds
+ * it, either system-wide or only on the busy CPUs
+ */
+class IPmQosController
+{
+public:
+    virtual ~IPmQosController() = default;
+
+    /**
+     * Check that latency requests can be made
+     * @param latencyUs wakeup latency bound in microseconds
+     * @param perCpu bound only the busy CPUs instead of the whole system
+     * @return false if the platform offers no latency request of the chosen kind
+     */
+    virtual bool initialize(int latencyUs, bool perCpu) = 0;
+
+    /**
+     * Hold the request in the performance tier and drop it in every other tier
+     * @param tier active tier
+     */
+    virtual void setTier(PowerTier tier) = 0;
+
+    /**
+     * Move per-CPU requests to the CPUs that are busy now
+     * @param utilization busy fraction per CPU, indexed by CPU number
+     */
+    virtual void update(const std::vector<double>& utilization) = 0;
+
+    /**
+     * Drop every request this controller holds
+     * @return true if all requests were released
+     */
+    virtual bool release() = 0;
+};
+
+#endif // DDOGREEN_IPM_QOS_CONTROLLER_H
@@ -3,8 +3,54 @@
 
 #include <string>
 #include <span>
+#include <vector>
 #include <cstring>
 #include <algorithm>
+#include "control_domain.h"
+#include "power_tier.h"
+
+/**
+ * @brief Result of reading a switch back after it was applied
+ */
+enum class ActuationOutcome
+{
+    SUCCEEDED,      ///< every target read back with the requested value
+    PARTIAL,        ///< some targets kept another value after the retries
+    FAILED          ///< the switch failed or no target took the requested value
+};
+
+/**
+ * @brief Verified switch counters of one backend
+ */
+struct ActuationMetrics
+{
+    int succeeded{0};
+    int partial{0};
+    int failed{0};
+
+    void record(ActuationOutcome outcome)
+    {
+        switch (outcome)
+        {
+            case ActuationOutcome::SUCCEEDED: ++succeeded; break;
+            case ActuationOutcome::PARTIAL:   ++partial; break;
+            case ActuationOutcome::FAILED:    ++failed; break;
+        }
+    }
+
+    int total() const { return succeeded + partial + failed; }
+};
+
+/**
+ * @brief A setting another agent changed after the backend applied it
+ */
+struct ExternalChange
+{
+    std::string setting;        ///< attribute path or property name
+    std::string expected;       ///< value the backend applied
+    std::string actual;         ///< value found now
+    std::string writer;         ///< suspected agent, or "unknown"
+};
 
 /**
  * Interface for platform-specific power management functionality
@@ -37,6 +83,55 @@ public:
      */
     virtual std::string getCurrentMode() = 0;
 
+    /**
+     * Set system to a specific power tier
+     * Backends with finer control than performance/power saving override this
+     * @param tier requested tier
+     * @return true if successful
+     */
+    virtual bool setTier(PowerTier tier)
+    {
+        // Default implementation - map the upper half to performance mode
+        if (tier == PowerTier::PERFORMANCE || tier == PowerTier::BALANCED_PERFORMANCE)
+        {
+            return setPerformanceMode();
+        }
+        return setPowerSavingMode();
+    }
+
+    /**
+     * Check by readback whether a tier is already in effect, and treat it as applied if so
+     * Lets a restarted service skip the first switch; nothing is written
+     * @param tier tier the service applied last
+     * @return true if the backend's settings already match the tier
+     */
+    virtual bool confirmTier([[maybe_unused]] PowerTier tier)
+    {
+        // Default implementation - no cheap readback, so always switch
+        return false;
+    }
+
+    /**
+     * Check whether tiers can be applied to a single control domain
+     * @return true if setDomainTier is implemented
+     */
+    virtual bool supportsControlDomains() const
+    {
+        return false;
+    }
+
+    /**
+     * Apply a tier to the CPUs of one control domain only
+     * @param domain domain reported by the system monitor, at cpufreq policy or package scope
+     * @param tier requested tier
+     * @return true if successful
+     */
+    virtual bool setDomainTier([[maybe_unused]] const ControlDomain& domain, [[maybe_unused]] PowerTier tier)
+    {
+        // Default implementation - only system-wide control
+        return false;
+    }
+
     /**
      * Check if power management is available on this platform
      * Linux: Check if TLP is installed
@@ -45,6 +140,56 @@ public:
      */
     virtual bool isAvailable() = 0;
 
+    /**
+     * Get the short backend name used in configuration and logs
+     * @return backend identifier, e.g. "tlp" or "epp"
+     */
+    virtual std::string getBackendName() const
+    {
+        return "default";
+    }
+
+    /**
+     * Get the outcome counters of the switches this backend verified by readback
+     * @return counters; all zero for backends that cannot read their targets back
+     */
+    virtual ActuationMetrics getActuationMetrics() const
+    {
+        return {};
+    }
+
+    /**
+     * Read back the settings this backend applied and report the ones changed by someone else
+     * Each change is reported once; the backend then treats the found value as
+     * current, so the next switch writes its own value again
+     * @return changes since the last check; empty for backends that cannot read their settings back
+     */
+    virtual std::vector<ExternalChange> detectExternalChanges()
+    {
+        return {};
+    }
+
+    /**
+     * Stop watching settings that another controller of this daemon writes
+     * Those changes are ours, so they must not be reported as external changes
+     * @param settings paths of the settings, e.g. a turbo switch or a frequency cap
+     */
+    virtual void ignoreExternalChanges([[maybe_unused]] const std::vector<std::string>& settings)
+    {
+        // Default implementation - nothing is watched
+    }
+
+    /**
+     * Re-apply the current mode without changing it
+     * Used to time an idempotent switch while probing backends; not rate limited
+     * @return true if the backend accepted the switch
+     */
+    virtual bool reapplyCurrentMode()
+    {
+        // Default implementation - a mode readback is the closest side-effect free operation
+        return getCurrentMode() != "unknown";
+    }
+
     /**
      * Apply power management configuration from buffer data
      * @param configData span containing power management configuration
@@ -0,0 +1,38 @@
+#ifndef DDOGREEN_ISLEEP_MONITOR_H
+#define DDOGREEN_ISLEEP_MONITOR_H
+
+#include <chrono>
+#include <functional>
+#include <optional>
+
+/**
+ * Interface for noticing system suspend and resume
+ * The steady clock stops while the system is suspended, so timers measured
+ * with it do not see the suspend at all
+ */
+class ISleepMonitor
+{
+public:
+    virtual ~ISleepMonitor() = default;
+
+    /**
+     * Total time the system has spent suspended since boot
+     * @return suspended time, or std::nullopt if the platform cannot tell
+     */
+    virtual std::optional<std::chrono::milliseconds> getSuspendedTime() = 0;
+
+    /**
+     * Start watching for resume in the background
+     * @param onWake called from the watcher thread after a resume; may also be
+     *               called after other clock jumps, so compare getSuspendedTime()
+     * @return false if resume cannot be watched; getSuspendedTime() still works
+     */
+    virtual bool start(std::function<void()> onWake) = 0;
+
+    /**
+     * Stop the watcher thread
+     */
+    virtual void stop() = 0;
+};
+
+#endif // DDOGREEN_ISLEEP_MONITOR_H
@@ -0,0 +1,43 @@
+#ifndef DDOGREEN_ISMT_CONTROLLER_H
+#define DDOGREEN_ISMT_CONTROLLER_H
+
+#include "power_tier.h"
+#include <vector>
+
+/**
+ * Interface for switching simultaneous multithreading in deep power save
+ * With SMT off the sibling threads go offline, which lowers idle package power
+ * on many laptops; SMT comes back as soon as load or the tier asks for it
+ */
+class ISmtController
+{
+public:
+    virtual ~ISmtController() = default;
+
+    /**
+     * Check that SMT can be switched and is currently on
+     * @param offUtilization average utilization below which SMT may be switched off
+     * @return false if SMT is unsupported, forced off or not writable
+     */
+    virtual bool initialize(double offUtilization) = 0;
+
+    /**
+     * Record a utilization sample and switch SMT if needed
+     * @param utilization busy fraction per CPU, indexed by CPU number
+     */
+    virtual void update(const std::vector<double>& utilization) = 0;
+
+    /**
+     * Follow the active power tier; SMT is only ever off in the power save tier
+     * @param tier active tier
+     */
+    virtual void setTier(PowerTier tier) = 0;
+
+    /**
+     * Switch SMT back on if the controller switched it off
+     * @return true if SMT is in its original state
+     */
+    virtual bool restore() = 0;
+};
+
+#endif // DDOGREEN_ISMT_CONTROLLER_H
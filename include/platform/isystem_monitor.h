@@ -10,6 +10,9 @@
 #include <tuple>
 #include <numeric>
 
+#include "control_domain.h"
+#include "cpu_topology.h"
+
 /**
  * @brief Abstract interface for system monitoring functionality
  * 
@@ -46,6 +49,51 @@ public:
      */
     virtual void setMonitoringFrequency(int frequencySeconds) = 0;
 
+    /**
+     * Get the CPU groups that can be controlled independently
+     * @param scope granularity of the groups
+     * @return control domains, or an empty list if the platform cannot group CPUs at this scope
+     */
+    virtual std::vector<ControlDomain> getControlDomains([[maybe_unused]] ControlDomainScope scope)
+    {
+        // Default implementation - a single system-wide domain
+        return {};
+    }
+
+    /**
+     * Sample per-CPU utilization since the previous call
+     * All CPUs are read in one pass so every domain sees the same interval
+     * @param utilization filled with the busy fraction (0.0-1.0), indexed by CPU number
+     * @return false if no previous sample exists yet or the counters cannot be read
+     */
+    virtual bool sampleCpuUtilization([[maybe_unused]] std::vector<double>& utilization)
+    {
+        // Default implementation - per-CPU counters are not available
+        return false;
+    }
+
+    /**
+     * Get the core types, capacities and cache/package layout of the CPUs
+     * @return topology, or an empty topology if the platform does not report it
+     */
+    virtual CpuTopology getCpuTopology()
+    {
+        // Default implementation - topology unknown, every CPU counts as one
+        return {};
+    }
+
+    /**
+     * Re-read the set of online CPUs
+     * CPUs go offline through hotplug or when SMT is switched off; the core count
+     * and topology then describe only the CPUs that remain
+     * @return true if the set changed since the previous call
+     */
+    virtual bool refreshOnlineCpus()
+    {
+        // Default implementation - the CPU set is fixed
+        return false;
+    }
+
     /**
      * Get detailed system metrics in a structured format
      * @param metricsBuffer span to fill with system metrics data
@@ -0,0 +1,66 @@
+#ifndef DDOGREEN_ITURBO_CONTROLLER_H
+#define DDOGREEN_ITURBO_CONTROLLER_H
+
+#include "power_tier.h"
+#include "turbo_policy.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * Interface for turbo boost control
+ * Turbo is a policy dimension of its own: it is switched on for confirmed
+ * bursts and in the performance tier, within a turbo-time budget and the
+ * thermal headroom of the CPU
+ */
+class ITurboController
+{
+public:
+    virtual ~ITurboController() = default;
+
+    using BoostCallback = std::function<void()>;
+
+    /**
+     * Find the turbo switch and snapshot its state
+     * @param settings burst, budget and thermal limits
+     * @return false if turbo cannot be switched on this system
+     */
+    virtual bool initialize(const TurboSettings& settings) = 0;
+
+    /**
+     * Record a utilization sample and switch turbo if the decision changes
+     * @param utilization busy fraction per CPU, indexed by CPU number
+     */
+    virtual void update(const std::vector<double>& utilization) = 0;
+
+    /**
+     * Follow the active power tier
+     * Backends may write the same switch, so the current decision is re-applied
+     * @param tier active tier
+     */
+    virtual void setTier(PowerTier tier) = 0;
+
+    /**
+     * Write back the state snapshotted by initialize()
+     * @return true if the switch was restored
+     */
+    virtual bool restore() = 0;
+
+    /**
+     * Run a callback right after turbo is switched on, e.g. to bring parked CPUs back
+     * @param callback called on every off-to-on transition the kernel accepted
+     */
+    virtual void setBoostCallback(BoostCallback callback) = 0;
+
+    /**
+     * @return turbo residency and denial counters
+     */
+    virtual TurboMetrics getMetrics() const = 0;
+
+    /**
+     * @return paths of the switches the controller writes
+     */
+    virtual std::vector<std::string> getControlledAttributes() const = 0;
+};
+
+#endif // DDOGREEN_ITURBO_CONTROLLER_H
@@ -0,0 +1,42 @@
+#ifndef DDOGREEN_IUCLAMP_CONTROLLER_H
+#define DDOGREEN_IUCLAMP_CONTROLLER_H
+
+#include "power_tier.h"
+#include <string>
+#include <vector>
+
+/**
+ * Interface for per-cgroup utilization clamps
+ * A floor makes schedutil run interactive cgroups at a higher frequency and a cap
+ * keeps background cgroups slow, so the system can stay in a low power tier
+ */
+class IUclampController
+{
+public:
+    virtual ~IUclampController() = default;
+
+    /**
+     * Snapshot the clamps of the cgroups
+     * @param floorCgroups cgroups given cpu.uclamp.min
+     * @param floorPercent utilization floor in percent
+     * @param capCgroups cgroups given cpu.uclamp.max
+     * @param capPercent utilization cap in percent
+     * @return false if none of the cgroups has writable clamps
+     */
+    virtual bool initialize(const std::vector<std::string>& floorCgroups, int floorPercent,
+                            const std::vector<std::string>& capCgroups, int capPercent) = 0;
+
+    /**
+     * Hold the clamps below the performance tier and release them in it
+     * @param tier active tier
+     */
+    virtual void setTier(PowerTier tier) = 0;
+
+    /**
+     * Write back the clamps from before the daemon started
+     * @return true if every clamp was restored
+     */
+    virtual bool restore() = 0;
+};
+
+#endif // DDOGREEN_IUCLAMP_CONTROLLER_H
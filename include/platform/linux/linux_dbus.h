@@ -0,0 +1,177 @@
+#ifndef DDOGREEN_LINUX_DBUS_H
+#define DDOGREEN_LINUX_DBUS_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Minimal D-Bus wire protocol support
+ * Covers the subset needed to call methods and read/write string properties
+ * without linking libdbus or sd-bus
+ */
+
+/**
+ * @brief Marshals D-Bus values into a byte buffer
+ *
+ * Alignment is relative to the start of the buffer, which is correct for
+ * message bodies because the body always starts on an 8-byte boundary.
+ */
+class DBusWriter
+{
+public:
+    void align(size_t boundary);
+    void writeByte(uint8_t value);
+    void writeUint32(uint32_t value);
+    void writeString(const std::string& value);
+    void writeObjectPath(const std::string& value) { writeString(value); }
+    void writeSignature(const std::string& value);
+    void writeVariantString(const std::string& value);
+
+    const std::vector<uint8_t>& data() const { return m_data; }
+    std::vector<uint8_t>& data() { return m_data; }
+
+private:
+    std::vector<uint8_t> m_data;
+};
+
+/**
+ * @brief Unmarshals D-Bus values from a byte buffer
+ */
+class DBusReader
+{
+public:
+    DBusReader(const std::vector<uint8_t>& data, size_t offset, bool bigEndian);
+
+    bool align(size_t boundary);
+    bool readByte(uint8_t& value);
+    bool readUint32(uint32_t& value);
+    bool readString(std::string& value);
+    bool readSignature(std::string& value);
+
+    /**
+     * Read a variant holding a basic string-like or integer value
+     * @param value string representation of the contained value
+     * @return false for container types or malformed data
+     */
+    bool readVariant(std::string& value);
+
+    size_t offset() const { return m_offset; }
+
+private:
+    const std::vector<uint8_t>& m_data;
+    size_t m_offset;
+    bool m_bigEndian;
+};
+
+/**
+ * @brief D-Bus message with the header fields used by ddogreen
+ */
+struct DBusMessage
+{
+    static constexpr uint8_t METHOD_CALL = 1;
+    static constexpr uint8_t METHOD_RETURN = 2;
+    static constexpr uint8_t ERROR = 3;
+    static constexpr uint8_t SIGNAL = 4;
+
+    uint8_t type{METHOD_CALL};
+    uint8_t flags{0};
+    uint32_t serial{0};
+    uint32_t replySerial{0};
+    std::string path;
+    std::string interface;
+    std::string member;
+    std::string errorName;
+    std::string destination;
+    std::string sender;
+    std::string signature;
+    std::vector<uint8_t> body;
+    bool bigEndian{false};
+
+    /**
+     * Serialize to wire format (little endian)
+     */
+    std::vector<uint8_t> serialize() const;
+
+    /**
+     * Parse one message from the start of a buffer
+     * @param buffer received bytes
+     * @param consumed set to the message size when a complete message was parsed
+     * @return message, or std::nullopt if the buffer holds no complete valid message
+     */
+    static std::optional<DBusMessage> parse(const std::vector<uint8_t>& buffer, size_t& consumed);
+
+    /**
+     * Check whether a complete message may be parsed from the buffer
+     * @param buffer received bytes
+     * @return total message size, 0 if more data is needed
+     */
+    static size_t completeSize(const std::vector<uint8_t>& buffer);
+
+    /**
+     * Reader positioned at the start of the body
+     */
+    DBusReader bodyReader() const { return DBusReader(body, 0, bigEndian); }
+};
+
+/**
+ * @brief Persistent connection to a D-Bus bus over a Unix socket
+ *
+ * Authenticates with SASL EXTERNAL and registers with Hello once, so each
+ * subsequent method call costs a single request/reply round trip.
+ */
+class DBusConnection
+{
+public:
+    /**
+     * @param address bus address, e.g. "unix:path=/run/dbus/system_bus_socket"
+     */
+    explicit DBusConnection(std::string address);
+    ~DBusConnection();
+
+    DBusConnection(const DBusConnection&) = delete;
+    DBusConnection& operator=(const DBusConnection&) = delete;
+
+    /**
+     * Connect, authenticate and register on the bus
+     * @return true if the connection is ready for method calls
+     */
+    bool connect();
+
+    /**
+     * Close the connection
+     */
+    void disconnect();
+
+    bool isConnected() const { return m_fd >= 0; }
+    const std::string& getUniqueName() const { return m_uniqueName; }
+
+    /**
+     * Send a method call and wait for its reply
+     * Signals and unrelated messages received meanwhile are discarded
+     * @param message method call; serial is assigned by the connection
+     * @param timeoutMs reply timeout in milliseconds
+     * @return METHOD_RETURN or ERROR reply, or std::nullopt on I/O failure or timeout
+     */
+    std::optional<DBusMessage> call(DBusMessage message, int timeoutMs = 2000);
+
+    /**
+     * Get the system bus address from DBUS_SYSTEM_BUS_ADDRESS or the well-known socket
+     */
+    static std::string systemBusAddress();
+
+private:
+    bool authenticate();
+    bool sendAll(const void* data, size_t size);
+    bool readLine(std::string& line, int timeoutMs);
+    std::optional<DBusMessage> readMessage(int timeoutMs);
+
+    std::string m_address;
+    int m_fd;
+    uint32_t m_nextSerial;
+    std::string m_uniqueName;
+    std::vector<uint8_t> m_readBuffer;
+};
+
+#endif // DDOGREEN_LINUX_DBUS_H
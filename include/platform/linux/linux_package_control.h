@@ -0,0 +1,57 @@
+#ifndef DDOGREEN_LINUX_PACKAGE_CONTROL_H
+#define DDOGREEN_LINUX_PACKAGE_CONTROL_H
+
+#include "control_domain.h"
+#include "platform/linux/linux_power_plan.h"
+#include "power_tier.h"
+#include <string>
+#include <vector>
+
+/**
+ * Select the cpufreq policies covered by a control domain
+ * Policy domains match by name; package domains take every policy with a CPU in the package
+ * @param domain domain reported by the system monitor
+ * @param policies policy directories the backend controls
+ * @param cpuRoot root of the CPU subsystem
+ * @return matching entries of policies, empty if the domain is unknown
+ */
+std::vector<std::string> selectDomainPolicies(const ControlDomain& domain, const std::vector<std::string>& policies,
+                                              const std::string& cpuRoot);
+
+/**
+ * @brief Per-package uncore frequency limits (intel_uncore_frequency)
+ * Idle packages gain little from a fast uncore (LLC, memory controller, interconnect),
+ * so the lower tiers cap max_freq_khz inside the range firmware set at boot
+ */
+class LinuxUncoreFrequency
+{
+public:
+    /**
+     * @param cpuRoot root of the CPU subsystem, normally /sys/devices/system/cpu
+     */
+    explicit LinuxUncoreFrequency(const std::string& cpuRoot);
+
+    bool isAvailable() const { return !m_domains.empty(); }
+
+    /**
+     * Build the limit writes for every uncore domain (die) of a package
+     * @param package package id
+     * @param tier requested tier
+     * @param stage plan stage of the writes
+     * @return writes, empty if the package has no uncore control
+     */
+    PowerPlan buildPlan(int package, PowerTier tier, int stage) const;
+
+private:
+    struct UncoreDomain
+    {
+        std::string path;
+        int package{0};
+        int initialMinKhz{0};
+        int initialMaxKhz{0};
+    };
+
+    std::vector<UncoreDomain> m_domains;
+};
+
+#endif // DDOGREEN_LINUX_PACKAGE_CONTROL_H
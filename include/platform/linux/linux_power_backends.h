@@ -0,0 +1,128 @@
+#ifndef DDOGREEN_LINUX_POWER_BACKENDS_H
+#define DDOGREEN_LINUX_POWER_BACKENDS_H
+
+#include "platform/icpu_parking_controller.h"
+#include "platform/icpuset_controller.h"
+#include "platform/ifrequency_controller.h"
+#include "platform/iidle_injection_controller.h"
+#include "platform/iirq_affinity_controller.h"
+#include "platform/iknob_manager.h"
+#include "platform/iperf_sampler.h"
+#include "platform/ipm_qos_controller.h"
+#include "platform/ipower_manager.h"
+#include "platform/isleep_monitor.h"
+#include "platform/ismt_controller.h"
+#include "platform/iturbo_controller.h"
+#include "platform/iuclamp_controller.h"
+#include <memory>
+#include <string>
+
+/**
+ * Factory functions for the Linux power management backends
+ * Roots are parameters so tests can point backends at a fake sysfs tree
+ */
+
+/**
+ * Create the TLP backend (native TLP profile writes, or tlp ac / tlp bat)
+ * @param rootPrefix prefix for the TLP configuration and sysfs paths, empty on a real system
+ */
+std::unique_ptr<IPowerManager> createLinuxPowerManager(const std::string& rootPrefix = "");
+
+/**
+ * Create the energy_performance_preference backend for intel_pstate/amd-pstate active mode
+ * @param cpuSysfsRoot root of the CPU subsystem
+ */
+std::unique_ptr<IPowerManager> createLinuxEppPowerManager(const std::string& cpuSysfsRoot = "/sys/devices/system/cpu");
+
+/**
+ * Create the generic cpufreq scaling_governor backend
+ * @param cpuSysfsRoot root of the CPU subsystem
+ */
+std::unique_ptr<IPowerManager> createLinuxGovernorPowerManager(const std::string& cpuSysfsRoot = "/sys/devices/system/cpu");
+
+/**
+ * Create the power-profiles-daemon backend (ActiveProfile over D-Bus)
+ * @param busAddress D-Bus address, empty for the system bus
+ */
+std::unique_ptr<IPowerManager> createLinuxPpdPowerManager(const std::string& busAddress = "");
+
+/**
+ * Create the sysfs/procfs knob profile manager
+ * @param rootPrefix prefix for /sys and /proc/sys, empty on a real system
+ */
+std::unique_ptr<IKnobManager> createLinuxKnobManager(const std::string& rootPrefix = "");
+
+/**
+ * Create the scaling_max_freq cap controller
+ * @param cpuSysfsRoot root of the CPU subsystem
+ * @param energyModelRoot debugfs directory of the kernel energy model
+ */
+std::unique_ptr<IFrequencyController> createLinuxFrequencyController(const std::string& cpuSysfsRoot = "/sys/devices/system/cpu",
+                                                                     const std::string& energyModelRoot = "/sys/kernel/debug/energy_model");
+
+/**
+ * Create the turbo controller (intel_pstate/no_turbo or cpufreq boost)
+ * @param cpuSysfsRoot root of the CPU subsystem
+ * @param thermalRoot root of the thermal zones
+ */
+std::unique_ptr<ITurboController> createLinuxTurboController(const std::string& cpuSysfsRoot = "/sys/devices/system/cpu",
+                                                             const std::string& thermalRoot = "/sys/class/thermal");
+
+/**
+ * Create the SMT controller (/sys/devices/system/cpu/smt/control)
+ * @param rootPrefix prefix for the sysfs and procfs paths, empty on a real system
+ */
+std::unique_ptr<ISmtController> createLinuxSmtController(const std::string& rootPrefix = "");
+
+/**
+ * Create the core parking controller (/sys/devices/system/cpu/cpuN/online)
+ * @param cpuSysfsRoot root of the CPU subsystem
+ */
+std::unique_ptr<ICpuParkingController> createLinuxCpuParkingController(const std::string& cpuSysfsRoot = "/sys/devices/system/cpu");
+
+/**
+ * Create the PM QoS controller (/dev/cpu_dma_latency or per-CPU resume latency)
+ * @param latencyDevice system-wide CPU latency device
+ * @param cpuSysfsRoot root of the CPU subsystem
+ */
+std::unique_ptr<IPmQosController> createLinuxPmQosController(const std::string& latencyDevice = "/dev/cpu_dma_latency",
+                                                             const std::string& cpuSysfsRoot = "/sys/devices/system/cpu");
+
+/**
+ * Create the IRQ affinity controller (/proc/irq/N/smp_affinity_list)
+ * @param rootPrefix prefix for the procfs and sysfs paths, empty on a real system
+ */
+std::unique_ptr<IIrqAffinityController> createLinuxIrqAffinityController(const std::string& rootPrefix = "");
+
+/**
+ * Create the cpuset controller (cgroup v2 cpuset.cpus)
+ * @param cgroupRoot mount point of the unified cgroup hierarchy
+ */
+std::unique_ptr<ICpusetController> createLinuxCpusetController(const std::string& cgroupRoot = "/sys/fs/cgroup");
+
+/**
+ * Create the uclamp controller (cgroup v2 cpu.uclamp.min and cpu.uclamp.max)
+ * @param cgroupRoot mount point of the unified cgroup hierarchy
+ * @param cpuSysfsRoot root of the CPU subsystem, used to check the governor
+ */
+std::unique_ptr<IUclampController> createLinuxUclampController(const std::string& cgroupRoot = "/sys/fs/cgroup",
+                                                               const std::string& cpuSysfsRoot = "/sys/devices/system/cpu");
+
+/**
+ * Create the idle injection controller (intel_powerclamp or cgroup v2 cpu.max)
+ * @param rootPrefix prefix for the sysfs and procfs paths, empty on a real system
+ */
+std::unique_ptr<IIdleInjectionController> createLinuxIdleInjectionController(const std::string& rootPrefix = "");
+
+/**
+ * Create the performance counter sampler (perf_event_open)
+ * @param cpuSysfsRoot root of the CPU subsystem, used for the online CPU list
+ */
+std::unique_ptr<IPerfSampler> createLinuxPerfSampler(const std::string& cpuSysfsRoot = "/sys/devices/system/cpu");
+
+/**
+ * Create the sleep monitor (CLOCK_BOOTTIME and a clock-set cancelled timerfd)
+ */
+std::unique_ptr<ISleepMonitor> createLinuxSleepMonitor();
+
+#endif // DDOGREEN_LINUX_POWER_BACKENDS_H
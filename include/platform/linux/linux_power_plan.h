@@ -0,0 +1,195 @@
+#ifndef DDOGREEN_LINUX_POWER_PLAN_H
+#define DDOGREEN_LINUX_POWER_PLAN_H
+
+#include "platform/ipower_manager.h"
+#include <chrono>
+#include <functional>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+/**
+ * @brief One attribute write of a power plan
+ */
+struct SysfsWrite
+{
+    std::string path;
+    std::string value;
+    std::string knob;           ///< name used in reports, e.g. the TLP parameter
+    int stage{0};               ///< writes in a later stage depend on all earlier stages
+    bool readBack{false};       ///< re-read after writing because the kernel may clamp the value
+};
+
+/**
+ * Desired attribute values; the order within a stage is irrelevant
+ */
+using PowerPlan = std::vector<SysfsWrite>;
+
+/**
+ * @brief Latency of one knob write
+ */
+struct KnobTiming
+{
+    std::string knob;
+    std::string path;
+    std::chrono::microseconds latency{0};
+};
+
+/**
+ * @brief Outcome of applying a power plan
+ */
+struct PowerPlanResult
+{
+    bool success{true};
+    bool rolledBack{false};
+    int written{0};
+    int unchanged{0};
+    std::string failedPath;
+    std::vector<KnobTiming> timings;    ///< written knobs in execution order
+};
+
+/**
+ * @brief Outcome of reading a power plan back
+ */
+struct PlanVerification
+{
+    int matched{0};
+    int retries{0};                             ///< rewrite rounds needed
+    std::vector<std::string> mismatchedPaths;   ///< attributes still holding another value
+
+    ActuationOutcome outcome() const
+    {
+        if (mismatchedPaths.empty())
+        {
+            return ActuationOutcome::SUCCEEDED;
+        }
+        return matched > 0 ? ActuationOutcome::PARTIAL : ActuationOutcome::FAILED;
+    }
+};
+
+/**
+ * Check a condition until it holds, doubling the delay after each miss
+ * With the defaults the last check comes 70 ms after the first
+ * @param condition check to repeat; may retry the write as a side effect
+ * @param attempts checks in total
+ * @param initialDelay delay after the first miss
+ * @return number of failed checks before the condition held, or std::nullopt if it never did
+ */
+std::optional<int> pollWithBackoff(const std::function<bool()>& condition, int attempts = 4,
+                                   std::chrono::milliseconds initialDelay = std::chrono::milliseconds(10));
+
+/**
+ * @brief Applies power plans transactionally
+ *
+ * Only attributes whose cached value differs from the plan are written.
+ * Stages run in ascending order; inside a stage the knobs that were fastest
+ * so far go first. If a write fails, every attribute written by the same
+ * apply is restored in reverse order, so the machine stays on the previous
+ * plan instead of a mix of both.
+ */
+class LinuxPowerPlanExecutor
+{
+public:
+    /**
+     * Apply a plan
+     * @param plan desired attribute values
+     * @return per-knob timings and the transaction outcome
+     */
+    PowerPlanResult apply(const PowerPlan& plan);
+
+    /**
+     * Read every attribute of a plan back from the kernel
+     * Attributes that do not hold their planned value are written again with
+     * backoff. Attributes marked readBack only have to be readable, since the
+     * kernel may clamp them. The cache is refreshed with what was read, so an
+     * attribute that did not take is written again by the next apply
+     * @param plan plan passed to the preceding apply
+     * @return matched and mismatched attributes
+     */
+    PlanVerification verify(const PowerPlan& plan);
+
+    /**
+     * Re-read the attributes settled by earlier verifications
+     * Attributes marked readBack are not watched, since the kernel adjusts them
+     * on its own. A changed attribute is reported once and then expected to keep
+     * its new value, and the cache holds that value so the next apply rewrites it
+     * @return attributes holding another value than after their last verification
+     */
+    std::vector<ExternalChange> detectExternalChanges();
+
+    /**
+     * Never watch these attributes for external changes
+     * For attributes another in-process controller rewrites between switches
+     * @param paths attribute paths
+     */
+    void ignoreExternalChanges(const std::vector<std::string>& paths);
+
+    /**
+     * Take over a plan that is already in effect, without writing anything
+     * Every attribute is read once; readBack attributes only have to be
+     * readable. On a match the cache and the external change baseline hold
+     * what was read, as after a verified apply
+     * @param plan plan that may have been applied before this executor existed
+     * @return true if every attribute holds its planned value
+     */
+    bool adoptIfApplied(const PowerPlan& plan);
+
+    /**
+     * Check that an apply would write nothing
+     * Compares against the cache the same way apply does
+     * @param plan desired attribute values
+     * @return true if the plan is not empty and every cached value matches it
+     */
+    bool isApplied(const PowerPlan& plan);
+
+    /**
+     * Last value written to, or read from, an attribute
+     * @param path attribute path
+     * @return cached value, read from the attribute on first use
+     */
+    std::optional<std::string> cachedValue(const std::string& path);
+
+    /**
+     * Forget cached values so the next apply compares against the attributes again
+     */
+    void invalidate() { m_cache.clear(); }
+
+    /**
+     * Smoothed write latency of an attribute
+     * @return latency, or std::nullopt if the attribute was never written
+     */
+    std::optional<std::chrono::microseconds> averageLatency(const std::string& path) const;
+
+private:
+    PowerPlan executionOrder(const PowerPlan& plan) const;
+    void rollback(const std::vector<std::pair<std::string, std::string>>& previousValues);
+    void recordLatency(const std::string& path, std::chrono::microseconds latency);
+
+    std::map<std::string, std::string> m_cache;
+    std::map<std::string, std::string> m_expected;     ///< settled value of every verified attribute
+    std::set<std::string> m_ignored;                   ///< attributes never added to m_expected
+    std::map<std::string, std::chrono::microseconds> m_latency;
+};
+
+/**
+ * Guess which power management agent changed a setting
+ * Looks for the daemons known to write cpufreq and platform profile settings
+ * @param procRoot procfs root
+ * @return names of the running agents, comma separated, or "unknown"
+ */
+std::string identifyExternalWriter(const std::string& procRoot = "/proc");
+
+/**
+ * Verify an applied plan, count the outcome and log what the kernel did not take
+ * @param executor executor that applied the plan
+ * @param plan applied plan
+ * @param metrics counters of the backend
+ * @param description switch named in the log, e.g. "EPP tier POWER_SAVE"
+ * @return false if no attribute of the plan took its value
+ */
+bool verifyActuation(LinuxPowerPlanExecutor& executor, const PowerPlan& plan, ActuationMetrics& metrics,
+                     const std::string& description);
+
+#endif // DDOGREEN_LINUX_POWER_PLAN_H
@@ -0,0 +1,98 @@
+#ifndef DDOGREEN_LINUX_SYSFS_H
+#define DDOGREEN_LINUX_SYSFS_H
+
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Helpers for reading and writing Linux sysfs/procfs attributes
+ * Writes use a single write(2) so kernel validation errors are reported
+ */
+class LinuxSysfs
+{
+public:
+    /**
+     * Read an attribute and strip the trailing newline
+     * @param path attribute path
+     * @return attribute value, or std::nullopt if it cannot be read
+     */
+    static std::optional<std::string> readAttribute(const std::string& path);
+
+    /**
+     * Write a value to an attribute
+     * @param path attribute path
+     * @param value value to write (no trailing newline required)
+     * @return true if the kernel accepted the value
+     */
+    static bool writeAttribute(const std::string& path, const std::string& value);
+
+    /**
+     * Open an attribute for repeated reads and writes
+     * @param path attribute path
+     * @return file descriptor, or -1 if the attribute cannot be opened read-write
+     */
+    static int openAttribute(const std::string& path);
+
+    /**
+     * Read an attribute through a descriptor returned by openAttribute
+     * @param fd attribute descriptor
+     * @return attribute value without trailing newline, or std::nullopt on error
+     */
+    static std::optional<std::string> readDescriptor(int fd);
+
+    /**
+     * Write an attribute through a descriptor returned by openAttribute
+     * @param fd attribute descriptor
+     * @param value value to write (no trailing newline required)
+     * @return true if the kernel accepted the value
+     */
+    static bool writeDescriptor(int fd, const std::string& value);
+
+    /**
+     * Check whether an attribute exists
+     * @param path attribute path
+     * @return true if the path exists
+     */
+    static bool exists(const std::string& path);
+
+    /**
+     * List cpufreq policy directories (policy0, policy1, ...) in numeric order
+     * @param cpuRoot root of the CPU subsystem, normally /sys/devices/system/cpu
+     * @return absolute paths of the policy directories
+     */
+    static std::vector<std::string> listCpufreqPolicies(const std::string& cpuRoot);
+
+    /**
+     * Read the CPUs of a cpufreq policy
+     * @param policy policy directory
+     * @return related_cpus, or affected_cpus where related_cpus is missing or empty
+     */
+    static std::vector<int> readPolicyCpus(const std::string& policy);
+
+    /**
+     * Parse a kernel CPU list such as "0-3,8,10-11"
+     * @param list CPU list as found in cpus, thread_siblings_list or online
+     * @return CPU numbers in list order, empty if the list is malformed
+     */
+    static std::vector<int> parseCpuList(const std::string& list);
+
+    /**
+     * Find the thermal zones that report the CPU package
+     * @param thermalRoot root of the thermal zones, normally /sys/class/thermal
+     * @return zone directories of known CPU types, or every zone if none is recognised
+     */
+    static std::vector<std::string> findCpuThermalZones(const std::string& thermalRoot);
+
+    /**
+     * Read the hottest of a set of thermal zones
+     * @param zones zone directories
+     * @return degrees Celsius, std::nullopt if no zone can be read
+     */
+    static std::optional<double> readHottestTemperature(const std::vector<std::string>& zones);
+
+private:
+    LinuxSysfs() = default; // Static utility class
+};
+
+#endif // DDOGREEN_LINUX_SYSFS_H
@@ -0,0 +1,118 @@
+#ifndef DDOGREEN_LINUX_TLP_COMPILER_H
+#define DDOGREEN_LINUX_TLP_COMPILER_H
+
+#include "platform/linux/linux_power_plan.h"
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * TLP power source profile
+ */
+enum class TlpProfile
+{
+    AC,     ///< *_ON_AC parameters (tlp ac)
+    BAT     ///< *_ON_BAT parameters (tlp bat)
+};
+
+/**
+ * @brief TLP profile compiled into attribute writes
+ */
+struct CompiledTlpProfile
+{
+    PowerPlan writes;                       ///< knob names are the TLP parameters
+    std::vector<std::string> unsupported;   ///< user-set parameters that need the tlp command
+
+    /**
+     * @return true if every user-set parameter of the profile can be applied natively
+     */
+    bool isNativeCapable() const { return unsupported.empty(); }
+};
+
+/**
+ * @brief Compiles TLP configuration into native sysfs/procfs writes
+ *
+ * Reads the intrinsic defaults, the *.conf drop-ins in /etc/tlp.d and /etc/tlp.conf
+ * in TLP's own precedence order (the last occurrence wins, "+=" appends).
+ *
+ * Supported parameters: CPU_SCALING_GOVERNOR, CPU_ENERGY_PERF_POLICY,
+ * CPU_SCALING_MIN/MAX_FREQ, CPU_MIN/MAX_PERF, CPU_BOOST, CPU_HWP_DYN_BOOST,
+ * PLATFORM_PROFILE, MEM_SLEEP, PCIE_ASPM, RUNTIME_PM (with its device and
+ * driver lists) and SOUND_POWER_SAVE (with SOUND_POWER_SAVE_CONTROLLER).
+ *
+ * Any other *_ON_AC / *_ON_BAT parameter set by the user makes that profile
+ * unsupported. Mode independent parameters are applied by TLP at boot and
+ * are not repeated on a mode switch, and unsupported intrinsic defaults are
+ * ignored.
+ */
+class LinuxTlpCompiler
+{
+public:
+    /**
+     * @param rootPrefix prefix prepended to /etc, /usr, /sys and /proc (empty on a real system)
+     */
+    explicit LinuxTlpCompiler(std::string rootPrefix = "");
+
+    /**
+     * Load the TLP configuration files that exist
+     * @return true if a user configuration (tlp.conf or a drop-in) was found
+     */
+    bool load();
+
+    /**
+     * Load one configuration file
+     * @param path file to read
+     * @param intrinsic true for TLP's own defaults
+     * @return true if the file was read
+     */
+    bool loadFile(const std::string& path, bool intrinsic = false);
+
+    /**
+     * Get the effective value of a parameter
+     * @param name parameter name, e.g. "CPU_BOOST_ON_AC"
+     * @return value without quotes, or std::nullopt if unset
+     */
+    std::optional<std::string> getParameter(const std::string& name) const;
+
+    /**
+     * @return false when TLP_ENABLE=0
+     */
+    bool isEnabled() const;
+
+    /**
+     * Compile a profile against the attributes present on this machine
+     * @param profile AC or BAT
+     * @return attribute writes in application order plus unsupported parameters
+     */
+    CompiledTlpProfile compile(TlpProfile profile) const;
+
+private:
+    // Dependency stages: platform profile, then governor, then everything that
+    // depends on the governor; max/min perf limits get stages of their own
+    static constexpr int STAGE_PLATFORM_PROFILE = 0;
+    static constexpr int STAGE_GOVERNOR = 1;
+    static constexpr int STAGE_INDEPENDENT = 2;
+    static constexpr int STAGE_MAX_PERF = 3;
+    static constexpr int STAGE_MIN_PERF_AGAIN = 4;
+
+    struct Parameter
+    {
+        std::string value;
+        bool intrinsic{false};
+    };
+
+    void compileCpu(const std::string& suffix, CompiledTlpProfile& result) const;
+    void compileRuntimePm(const std::string& value, CompiledTlpProfile& result) const;
+    void addWrite(CompiledTlpProfile& result, const std::string& path, const std::string& value,
+                  const std::string& parameter, int stage = STAGE_INDEPENDENT, bool readBack = false) const;
+    std::optional<std::string> getNonEmpty(const std::string& name) const;
+    std::string path(const std::string& absolutePath) const { return m_root + absolutePath; }
+
+    static bool parseLine(const std::string& line, std::string& name, std::string& value, bool& append);
+
+    std::string m_root;
+    std::map<std::string, Parameter> m_parameters;
+};
+
+#endif // DDOGREEN_LINUX_TLP_COMPILER_H
@@ -1,11 +1,25 @@
 #ifndef DDOGREEN_PLATFORM_FACTORY_H
 #define DDOGREEN_PLATFORM_FACTORY_H
 
+#include "platform/icpu_parking_controller.h"
+#include "platform/icpuset_controller.h"
+#include "platform/ifrequency_controller.h"
+#include "platform/iidle_injection_controller.h"
+#include "platform/iirq_affinity_controller.h"
+#include "platform/iknob_manager.h"
+#include "platform/iperf_sampler.h"
 #include "platform/isystem_monitor.h"
 #include "platform/ipower_manager.h"
 #include "platform/iplatform_utils.h"
+#include "platform/ipm_qos_controller.h"
 #include "platform/isignal_handler.h"
+#include "platform/isleep_monitor.h"
+#include "platform/ismt_controller.h"
+#include "platform/iturbo_controller.h"
+#include "platform/iuclamp_controller.h"
 #include <memory>
+#include <string>
+#include <vector>
 
 /**
  * Platform factory for creating platform-specific implementations
@@ -21,10 +35,93 @@ public:
 
     /**
      * Create a power manager for the current platform
+     * Same as probing the backends in their default order without a selection cache
      * @return unique_ptr to platform-specific power manager implementation
      */
     static std::unique_ptr<IPowerManager> createPowerManager();
 
+    /**
+     * Create a power manager by probing the compiled-in backends
+     * Platforms with a single backend ignore the parameters
+     * @param backendOrder backend names to try in order; empty selects the most capable backend
+     * @param cacheFile file caching the selection across starts; empty disables caching
+     * @return unique_ptr to the selected power manager implementation
+     */
+    static std::unique_ptr<IPowerManager> createPowerManager(const std::vector<std::string>& backendOrder,
+                                                             const std::string& cacheFile);
+
+    /**
+     * Create a knob profile manager for the current platform
+     * @return unique_ptr to the knob manager, or nullptr if the platform has no kernel tunables
+     */
+    static std::unique_ptr<IKnobManager> createKnobManager();
+
+    /**
+     * Create a frequency cap controller for the current platform
+     * @return unique_ptr to the controller, or nullptr if frequencies cannot be capped
+     */
+    static std::unique_ptr<IFrequencyController> createFrequencyController();
+
+    /**
+     * Create a turbo controller for the current platform
+     * @return unique_ptr to the controller, or nullptr if turbo cannot be switched
+     */
+    static std::unique_ptr<ITurboController> createTurboController();
+
+    /**
+     * Create an SMT controller for the current platform
+     * @return unique_ptr to the controller, or nullptr if SMT cannot be switched
+     */
+    static std::unique_ptr<ISmtController> createSmtController();
+
+    /**
+     * Create a core parking controller for the current platform
+     * @return unique_ptr to the controller, or nullptr if CPUs cannot be taken offline
+     */
+    static std::unique_ptr<ICpuParkingController> createCpuParkingController();
+
+    /**
+     * Create a PM QoS latency controller for the current platform
+     * @return unique_ptr to the controller, or nullptr if latency requests are not supported
+     */
+    static std::unique_ptr<IPmQosController> createPmQosController();
+
+    /**
+     * Create an IRQ affinity controller for the current platform
+     * @return unique_ptr to the controller, or nullptr if interrupt affinity cannot be set
+     */
+    static std::unique_ptr<IIrqAffinityController> createIrqAffinityController();
+
+    /**
+     * Create a cpuset controller for the current platform
+     * @return unique_ptr to the controller, or nullptr if cgroup CPU sets are not supported
+     */
+    static std::unique_ptr<ICpusetController> createCpusetController();
+
+    /**
+     * Create a utilization clamp controller for the current platform
+     * @return unique_ptr to the controller, or nullptr if cgroup clamps are not supported
+     */
+    static std::unique_ptr<IUclampController> createUclampController();
+
+    /**
+     * Create an idle injection controller for the current platform
+     * @return unique_ptr to the controller, or nullptr if CPUs cannot be forced idle
+     */
+    static std::unique_ptr<IIdleInjectionController> createIdleInjectionController();
+
+    /**
+     * Create a hardware performance counter sampler for the current platform
+     * @return unique_ptr to the sampler, or nullptr if counters are not supported
+     */
+    static std::unique_ptr<IPerfSampler> createPerfSampler();
+
+    /**
+     * Create a suspend/resume monitor for the current platform
+     * @return unique_ptr to the monitor, or nullptr if suspend cannot be detected
+     */
+    static std::unique_ptr<ISleepMonitor> createSleepMonitor();
+
     /**
      * Create platform utilities for the current platform
      * @return unique_ptr to platform-specific platform utilities implementation
@@ -0,0 +1,95 @@
+#ifndef DDOGREEN_POWER_BACKEND_SELECTOR_H
+#define DDOGREEN_POWER_BACKEND_SELECTOR_H
+
+#include "platform/ipower_manager.h"
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Compiled-in power backend that may be probed
+ */
+struct PowerBackendCandidate
+{
+    std::string name;
+    std::function<std::unique_ptr<IPowerManager>()> create;
+    int capability{0};      ///< higher = finer control; outranks any latency difference
+};
+
+/**
+ * @brief Outcome of probing one backend
+ */
+struct PowerBackendProbe
+{
+    std::string name;
+    bool available{false};
+    bool capable{false};    ///< idempotent switch succeeded
+    std::chrono::microseconds switchLatency{0};
+};
+
+/**
+ * @brief Chooses the power backend by capability probing and measured switch latency
+ *
+ * Each candidate is created, checked with isAvailable() and timed on an
+ * idempotent switch (reapplyCurrentMode). Without a preferred order the
+ * most capable backend wins; among equally capable ones a backend later in
+ * the default order only wins if it switches more than LATENCY_TOLERANCE
+ * times faster, so timing noise cannot decide. With a preferred order, the
+ * first capable backend in that order wins. The decision is cached so later
+ * starts only re-check the cached backend's availability instead of probing
+ * everything again.
+ */
+class PowerBackendSelector
+{
+public:
+    /**
+     * @param candidates compiled-in backends in default preference order
+     */
+    explicit PowerBackendSelector(std::vector<PowerBackendCandidate> candidates);
+
+    /**
+     * Restrict and order the backends to try
+     * @param order backend names; empty selects the most capable backend
+     */
+    void setPreferredOrder(const std::vector<std::string>& order);
+
+    /**
+     * Set the cache file; empty disables caching
+     */
+    void setCacheFile(const std::string& path) { m_cacheFile = path; }
+
+    /**
+     * Select a backend, from the cache when it is still valid
+     * @return selected backend, or nullptr if no candidate is capable
+     */
+    std::unique_ptr<IPowerManager> select();
+
+    const std::string& getSelectedName() const { return m_selectedName; }
+    const std::vector<PowerBackendProbe>& getProbeResults() const { return m_probes; }
+    bool usedCache() const { return m_usedCache; }
+
+private:
+    static constexpr int CACHE_VERSION = 2;
+    static constexpr int PROBE_SAMPLES = 3;
+    static constexpr int LATENCY_TOLERANCE = 2;
+
+    std::unique_ptr<IPowerManager> selectFromCache();
+    std::unique_ptr<IPowerManager> probeCandidates();
+    PowerBackendProbe probe(const PowerBackendCandidate& candidate, std::unique_ptr<IPowerManager>& backend) const;
+    std::vector<const PowerBackendCandidate*> orderedCandidates() const;
+    const PowerBackendCandidate* findCandidate(const std::string& name) const;
+    std::string orderKey() const;
+    std::string candidatesKey() const;
+    void writeCache() const;
+
+    std::vector<PowerBackendCandidate> m_candidates;
+    std::vector<std::string> m_preferredOrder;
+    std::string m_cacheFile;
+    std::string m_selectedName;
+    std::vector<PowerBackendProbe> m_probes;
+    bool m_usedCache{false};
+};
+
+#endif // DDOGREEN_POWER_BACKEND_SELECTOR_H
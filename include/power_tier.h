@@ -0,0 +1,64 @@
+#ifndef DDOGREEN_POWER_TIER_H
+#define DDOGREEN_POWER_TIER_H
+
+#include <string>
+#include <optional>
+
+/**
+ * Power tiers ordered from the most power-efficient to the fastest
+ * Backends that only know two modes treat the upper half as performance
+ */
+enum class PowerTier
+{
+    POWER_SAVE,             ///< Lowest power, background work only
+    BALANCED_POWER,         ///< Favour power but keep some responsiveness
+    BALANCED_PERFORMANCE,   ///< Favour responsiveness with moderate power cost
+    PERFORMANCE             ///< Full performance
+};
+
+/**
+ * Convert a tier to its configuration name
+ * Names follow the energy_performance_preference vocabulary
+ * @param tier tier to convert
+ * @return "power", "balance_power", "balance_performance" or "performance"
+ */
+inline std::string powerTierToString(PowerTier tier)
+{
+    switch (tier)
+    {
+        case PowerTier::POWER_SAVE:           return "power";
+        case PowerTier::BALANCED_POWER:       return "balance_power";
+        case PowerTier::BALANCED_PERFORMANCE: return "balance_performance";
+        case PowerTier::PERFORMANCE:          return "performance";
+        default:                              return "unknown";
+    }
+}
+
+/**
+ * Parse a tier name from configuration
+ * Accepts the names produced by powerTierToString plus "powersave"
+ * @param name tier name
+ * @return parsed tier, or std::nullopt if the name is not recognised
+ */
+inline std::optional<PowerTier> parsePowerTier(const std::string& name)
+{
+    if (name == "power" || name == "powersave")
+    {
+        return PowerTier::POWER_SAVE;
+    }
+    if (name == "balance_power")
+    {
+        return PowerTier::BALANCED_POWER;
+    }
+    if (name == "balance_performance")
+    {
+        return PowerTier::BALANCED_PERFORMANCE;
+    }
+    if (name == "performance")
+    {
+        return PowerTier::PERFORMANCE;
+    }
+    return std::nullopt;
+}
+
+#endif // DDOGREEN_POWER_TIER_H
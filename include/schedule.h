@@ -0,0 +1,114 @@
+#ifndef DDOGREEN_SCHEDULE_H
+#define DDOGREEN_SCHEDULE_H
+
+#include "power_tier.h"
+#include <chrono>
+#include <ctime>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Named set of overrides applied while a schedule window is active
+ *
+ * A profile either adjusts the load thresholds and the tiers used for the
+ * active/idle states, or holds a fixed tier regardless of load.
+ */
+struct ScheduleProfile
+{
+    std::string name;
+    std::optional<double> highPerformanceThreshold;
+    std::optional<double> powerSaveThreshold;
+    std::optional<PowerTier> holdTier;
+    PowerTier activeTier{PowerTier::PERFORMANCE};
+    PowerTier idleTier{PowerTier::POWER_SAVE};
+};
+
+/**
+ * @brief Recurring weekly time window mapped to a profile
+ *
+ * Minutes are counted from local midnight. A window whose end is not after
+ * its start wraps past midnight into the following day.
+ */
+struct ScheduleWindow
+{
+    unsigned int dayMask{0};    ///< bit N set = window starts on weekday N (0 = Sunday)
+    int startMinute{0};
+    int endMinute{0};
+    std::string profile;
+};
+
+/**
+ * @brief Time-of-day and calendar schedule of threshold/tier profiles
+ *
+ * Windows are evaluated in configuration order and the first match wins.
+ * Outside every window no profile is active and the base configuration applies.
+ *
+ * Window syntax:  "<days> <HH:MM>-<HH:MM> <profile>"
+ *   days: "*", "mon-fri", "sat,sun", "fri-mon" (ranges may wrap)
+ * Profile syntax: comma separated "key=value" pairs
+ *   high=<0.1-1.0>, low=<0.05-0.9>, active=<tier>, idle=<tier>, hold=<tier>
+ */
+class Schedule
+{
+public:
+    Schedule() = default;
+
+    /**
+     * Define a profile from its specification string
+     * @param name profile name referenced by windows
+     * @param spec comma separated key=value overrides
+     * @return true if the specification is valid
+     */
+    bool addProfile(const std::string& name, const std::string& spec);
+
+    /**
+     * Add a window from its specification string
+     * @param spec "<days> <HH:MM>-<HH:MM> <profile>"
+     * @return true if the specification is valid
+     */
+    bool addWindow(const std::string& spec);
+
+    /**
+     * Check that every window references a defined profile
+     * @return true if the schedule is consistent
+     */
+    bool validate() const;
+
+    bool empty() const { return m_windows.empty(); }
+    const std::vector<ScheduleProfile>& getProfiles() const { return m_profiles; }
+    const std::vector<ScheduleWindow>& getWindows() const { return m_windows; }
+
+    /**
+     * Find the profile active at a local calendar time
+     * @param localTime broken-down local time
+     * @return active profile, or nullptr when no window matches
+     */
+    const ScheduleProfile* activeProfileAt(const std::tm& localTime) const;
+
+    /**
+     * Find the profile active at a point in time
+     * @param time wall clock time, interpreted in the local time zone
+     * @return active profile, or nullptr when no window matches
+     */
+    const ScheduleProfile* activeProfileAt(std::chrono::system_clock::time_point time) const;
+
+    /**
+     * Compute the next instant at which the active profile may change
+     * @param time wall clock time
+     * @return next window boundary strictly after time, or time_point::max() if none
+     */
+    std::chrono::system_clock::time_point nextBoundaryAfter(std::chrono::system_clock::time_point time) const;
+
+private:
+    const ScheduleProfile* findProfile(const std::string& name) const;
+
+    static bool parseDays(const std::string& field, unsigned int& dayMask);
+    static bool parseClock(const std::string& field, int& minute);
+    static std::tm toLocalTime(std::chrono::system_clock::time_point time);
+
+    std::vector<ScheduleProfile> m_profiles;
+    std::vector<ScheduleWindow> m_windows;
+};
+
+#endif // DDOGREEN_SCHEDULE_H
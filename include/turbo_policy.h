@@ -0,0 +1,82 @@
+#ifndef DDOGREEN_TURBO_POLICY_H
+#define DDOGREEN_TURBO_POLICY_H
+
+#include "power_tier.h"
+#include <chrono>
+#include <optional>
+
+/**
+ * @brief Tuning of a TurboPolicy
+ */
+struct TurboSettings
+{
+    double burstThreshold{0.85};                ///< busiest-CPU utilization that counts as a burst
+    int burstSamples{2};                        ///< consecutive burst samples before turbo is granted
+    double budget{0.25};                        ///< fraction of each window turbo may be on
+    std::chrono::seconds window{60};            ///< budget accounting window
+    double thermalLimit{85.0};                  ///< degrees Celsius at which turbo is withdrawn
+    double thermalHysteresis{5.0};              ///< cooling below the limit needed before turbo returns
+};
+
+/**
+ * @brief Turbo residency and denial counters
+ */
+struct TurboMetrics
+{
+    std::chrono::milliseconds residency{0};     ///< time spent with turbo enabled
+    std::chrono::milliseconds observed{0};      ///< time covered by the policy
+    int activations{0};
+    int budgetDenials{0};                       ///< samples that wanted turbo with the budget spent
+    int thermalDenials{0};                      ///< samples that wanted turbo while too hot
+
+    double residencyFraction() const
+    {
+        return observed.count() > 0 ? static_cast<double>(residency.count()) / static_cast<double>(observed.count()) : 0.0;
+    }
+};
+
+/**
+ * @brief Decides when turbo may run
+ * Turbo is wanted in the performance tier or after a confirmed burst, and granted
+ * only while the window's turbo-time budget lasts and the CPU has thermal headroom
+ */
+class TurboPolicy
+{
+public:
+    explicit TurboPolicy(const TurboSettings& settings);
+
+    void setTier(PowerTier tier) { m_tier = tier; }
+
+    /**
+     * Record a utilization sample and re-evaluate
+     * @param utilization busy fraction of the busiest CPU
+     * @param temperature CPU temperature in degrees Celsius, if known
+     * @param now sample time
+     * @return whether turbo should be enabled
+     */
+    bool update(double utilization, std::optional<double> temperature, std::chrono::steady_clock::time_point now);
+
+    /**
+     * Re-evaluate without a new sample, e.g. after a tier change
+     * @return whether turbo should be enabled
+     */
+    bool evaluate(std::optional<double> temperature, std::chrono::steady_clock::time_point now);
+
+    bool isEnabled() const { return m_enabled; }
+    const TurboMetrics& getMetrics() const { return m_metrics; }
+
+private:
+    void account(std::chrono::steady_clock::time_point now);
+
+    TurboSettings m_settings;
+    PowerTier m_tier;
+    int m_burstSamples;
+    bool m_enabled;
+    bool m_thermalThrottled;
+    std::optional<std::chrono::steady_clock::time_point> m_lastUpdate;
+    std::chrono::steady_clock::time_point m_windowStart;
+    std::chrono::milliseconds m_windowUsed;
+    TurboMetrics m_metrics;
+};
+
+#endif // DDOGREEN_TURBO_POLICY_H
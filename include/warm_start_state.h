@@ -0,0 +1,54 @@
+#ifndef DDOGREEN_WARM_START_STATE_H
+#define DDOGREEN_WARM_START_STATE_H
+
+#include "platform/ipower_manager.h"
+#include "power_tier.h"
+#include <optional>
+#include <string>
+
+/**
+ * @brief What a run left behind for the next start
+ */
+struct WarmStartState
+{
+    std::string backend;                ///< backend that applied the tier
+    std::optional<PowerTier> tier;      ///< system tier applied last; none with per-domain control
+    int runs{0};                        ///< runs recorded so far
+    ActuationMetrics actuation;         ///< verified switches over all recorded runs
+    int conflicts{0};                   ///< external power-setting conflicts over all recorded runs
+};
+
+/**
+ * @brief Keeps the warm-start state in a small versioned file
+ *
+ * The backend probe results stay in the backend selection cache next to it;
+ * this file only names the backend they chose. A file of another version, or
+ * one that cannot be parsed, is ignored, so the next start switches as usual.
+ */
+class WarmStartStore
+{
+public:
+    /**
+     * @param path state file, e.g. /var/lib/ddogreen/warm_start.state; empty disables the store
+     */
+    explicit WarmStartStore(std::string path);
+
+    /**
+     * Read the state of the previous run
+     * @return state, or std::nullopt if there is no usable file
+     */
+    std::optional<WarmStartState> load() const;
+
+    /**
+     * Write the state, replacing the file atomically
+     * @return true if the file was written
+     */
+    bool save(const WarmStartState& state) const;
+
+private:
+    static constexpr int STATE_VERSION = 1;
+
+    std::string m_path;
+};
+
+#endif // DDOGREEN_WARM_START_STATE_H
@@ -0,0 +1,67 @@
+#ifndef DDOGREEN_WORKLOAD_CLASSIFIER_H
+#define DDOGREEN_WORKLOAD_CLASSIFIER_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+/**
+ * @brief Hardware counter deltas over one sample interval, summed over all CPUs
+ * A machine reports either backend stalls or last level cache misses as its memory event
+ */
+struct PerfCounters
+{
+    uint64_t cycles{0};
+    uint64_t instructions{0};
+    std::optional<uint64_t> stalledCycles;      ///< cycles the backend waited, mostly on memory
+    std::optional<uint64_t> llcMisses;          ///< last level cache misses
+};
+
+enum class WorkloadClass
+{
+    UNKNOWN,            ///< not enough cycles observed or no memory event
+    COMPUTE_BOUND,      ///< gains from higher frequency
+    MEMORY_BOUND        ///< waits on memory, gains little from higher frequency
+};
+
+std::string workloadClassToString(WorkloadClass workloadClass);
+
+/**
+ * @brief Classifies load as compute- or memory-bound from counter deltas
+ * Memory-boundedness is the stalled share of cycles, or, without a stall
+ * counter, LLC misses per thousand instructions scaled so MEMORY_BOUND_MPKI
+ * counts as fully bound. Separate enter and exit thresholds keep the class
+ * from flapping around the boundary
+ */
+class WorkloadClassifier
+{
+public:
+    /**
+     * @param memoryBoundThreshold boundedness at which load turns memory-bound
+     */
+    explicit WorkloadClassifier(double memoryBoundThreshold = 0.5);
+
+    /**
+     * Classify one interval
+     * @param counters counter deltas of the interval
+     * @return class after the interval; unchanged when the interval had too few cycles
+     */
+    WorkloadClass update(const PerfCounters& counters);
+
+    WorkloadClass getClass() const { return m_class; }
+    double getIpc() const { return m_ipc; }
+    double getMemoryBoundedness() const { return m_memoryBoundedness; }
+
+private:
+    static constexpr double MEMORY_BOUND_MPKI = 20.0;   ///< misses per kilo-instruction that count as fully bound
+    static constexpr double EXIT_MARGIN = 0.15;         ///< boundedness drop below the threshold needed to leave
+    static constexpr double MAX_MEMORY_BOUND_IPC = 1.0; ///< higher IPC means the core is not starved
+    static constexpr uint64_t MIN_CYCLES = 100000000;   ///< intervals this quiet say nothing about the load
+
+    double m_threshold;
+    WorkloadClass m_class;
+    double m_ipc;
+    double m_memoryBoundedness;
+};
+
+#endif // DDOGREEN_WORKLOAD_CLASSIFIER_H
@@ -55,7 +55,7 @@ check_systemd() {
 # Function to check if TLP is installed
 check_tlp() {
     if ! command -v tlp &> /dev/null; then
-        print_warning "TLP not found. DDOGreen requires TLP for power management."
+        print_warning "TLP not found. DDOGreen will use EPP, the cpufreq governor or power-profiles-daemon if available."
         print_info "Install TLP with:"
         print_info "  Ubuntu/Debian: sudo apt install tlp"
         print_info "  Fedora/RHEL:   sudo dnf install tlp"
@@ -151,11 +151,13 @@ TimeoutStartSec=30
 NoNewPrivileges=yes
 ProtectSystem=strict
 ProtectHome=yes
-ReadWritePaths=/var/log /run /tmp /proc
+StateDirectory=ddogreen
+ReadWritePaths=/var/log /run /tmp /proc /sys
 PrivateTmp=yes
-ProtectKernelTunables=yes
+# No ProtectKernelTunables/ProtectControlGroups: they remount /proc/sys, /proc/irq and
+# /sys/fs/cgroup read-only over ReadWritePaths, and ddogreen writes sysctl knobs,
+# IRQ affinity and cgroup cpuset, uclamp and cpu.max files
 ProtectKernelModules=yes
-ProtectControlGroups=yes
 
 [Install]
 WantedBy=multi-user.target
@@ -270,7 +272,7 @@ Examples:
 
 Requirements:
   - Linux with systemd
-  - TLP installed (sudo apt install tlp / sudo dnf install tlp)
+  - A power backend: cpufreq sysfs, power-profiles-daemon or TLP
   - Root privileges (use sudo)
 
 After installation:
@@ -1,6 +1,8 @@
 #include "activity_monitor.h"
 #include "logger.h"
 #include "platform/platform_factory.h"
+#include <algorithm>
+#include <numeric>
 #include <thread>
 #include <chrono>
 #include <fstream>
@@ -18,35 +20,54 @@ std::string formatNumber(double value)
 }
 
 ActivityMonitor::ActivityMonitor()
+    : ActivityMonitor(PlatformFactory::createSystemMonitor())
+{
+}
+
+ActivityMonitor::ActivityMonitor(std::unique_ptr<ISystemMonitor> systemMonitor)
     : m_isActive{false}
     , m_running{false}
     , m_threadReady{false}
     , m_highPerformanceThreshold{0.0}
     , m_powerSaveThreshold{0.0}
+    , m_baseHighPerformanceThreshold{0.0}
+    , m_basePowerSaveThreshold{0.0}
     , m_monitoringFrequencySeconds{0}
     , m_cpuCoreCount{0}
+    , m_cpuCapacity{0.0}
     , m_callback{nullptr}
-    , m_systemMonitor{nullptr}
+    , m_tierCallback{nullptr}
+    , m_domainTierCallback{nullptr}
+    , m_utilizationCallback{nullptr}
+    , m_resumeCallback{nullptr}
+    , m_controlDomainScope{ControlDomainScope::SYSTEM}
+    , m_currentTier{PowerTier::POWER_SAVE}
+    , m_tierApplied{false}
+    , m_tierRetryPending{false}
+    , m_activeProfile{nullptr}
+    , m_nextScheduleBoundary{std::chrono::system_clock::time_point::max()}
+    , m_systemMonitor{std::move(systemMonitor)}
+    , m_memoryBound{false}
+    , m_wakePending{false}
+    , m_suspendedTime{0}
 {
     auto now = std::chrono::steady_clock::now();
     m_lastLoadCheckTime = now;
     m_lastStateChangeTime = now;
 
-    m_systemMonitor = PlatformFactory::createSystemMonitor();
-
     if (m_systemMonitor && m_systemMonitor->isAvailable())
     {
-        m_cpuCoreCount = m_systemMonitor->getCpuCoreCount();
-        Logger::info("Detected " + std::to_string(m_cpuCoreCount) + " CPU core(s)");
+        readCpuCapacity();
         Logger::info("High performance threshold: " + formatNumber(m_highPerformanceThreshold) + " (" + formatNumber(m_highPerformanceThreshold * 100) + "% per core)");
         Logger::info("Power save threshold: " + formatNumber(m_powerSaveThreshold) + " (" + formatNumber(m_powerSaveThreshold * 100) + "% per core)");
-        Logger::info("Absolute high performance threshold: " + formatNumber(m_highPerformanceThreshold * m_cpuCoreCount));
-        Logger::info("Absolute power save threshold: " + formatNumber(m_powerSaveThreshold * m_cpuCoreCount));
+        Logger::info("Absolute high performance threshold: " + formatNumber(m_highPerformanceThreshold * m_cpuCapacity));
+        Logger::info("Absolute power save threshold: " + formatNumber(m_powerSaveThreshold * m_cpuCapacity));
     }
     else
     {
         Logger::error("Failed to initialize platform-specific system monitor");
         m_cpuCoreCount = 1;
+        m_cpuCapacity = 1.0;
     }
 }
 
@@ -55,6 +76,20 @@ ActivityMonitor::~ActivityMonitor()
     stop();
 }
 
+void ActivityMonitor::readCpuCapacity()
+{
+    m_cpuCoreCount = m_systemMonitor->getCpuCoreCount();
+    m_topology = m_systemMonitor->getCpuTopology();
+    Logger::info("Detected " + std::to_string(m_cpuCoreCount) + " CPU core(s)");
+
+    // Thresholds scale with compute capacity, so an E-core counts as a fraction of a P-core
+    m_cpuCapacity = m_topology.empty() ? static_cast<double>(m_cpuCoreCount) : m_topology.getCapacity();
+    if (!m_topology.empty())
+    {
+        Logger::info("CPU topology: " + m_topology.describe() + (m_topology.isHybrid() ? " (hybrid)" : ""));
+    }
+}
+
 bool ActivityMonitor::start()
 {
     if (m_running.load())
@@ -78,12 +113,68 @@ bool ActivityMonitor::start()
     m_running.store(true);
     m_threadReady.store(false);
     m_lastLoadCheckTime = std::chrono::steady_clock::now();
+    m_tierApplied = false;
+
+    if (m_sleepMonitor)
+    {
+        m_suspendedTime = m_sleepMonitor->getSuspendedTime().value_or(std::chrono::milliseconds(0));
+        m_wakePending.store(false);
+        m_sleepMonitor->start([this]() {
+            // Under the lock, so the wakeup cannot fall between the loop's predicate check and its wait
+            {
+                std::lock_guard<std::mutex> lock(m_monitorMutex);
+                m_wakePending.store(true);
+            }
+            m_monitorCondition.notify_all();
+        });
+    }
+
+    if (m_perfSampler)
+    {
+        // Prime the counters so the first tick has an interval to classify
+        m_perfSampler->sample();
+    }
 
+    if (!m_schedule.empty())
+    {
+        m_activeProfile = nullptr;
+        m_highPerformanceThreshold = m_baseHighPerformanceThreshold;
+        m_powerSaveThreshold = m_basePowerSaveThreshold;
+        applyScheduleProfile(std::chrono::system_clock::now());
+    }
+
+    m_domains.clear();
+    if (m_controlDomainScope != ControlDomainScope::SYSTEM && m_domainTierCallback && initializeControlDomains())
+    {
+        std::vector<double> utilization;
+        if (m_systemMonitor->sampleCpuUtilization(utilization))
+        {
+            evaluateDomains(utilization, std::chrono::steady_clock::now(), true);
+        }
+        else
+        {
+            // No utilization interval yet - every domain starts from the system load
+            bool active = getLoadAverage() > m_highPerformanceThreshold * m_cpuCapacity;
+            for (auto& state : m_domains)
+            {
+                state.isActive = active;
+            }
+            m_isActive = active;
+        }
+        notifyStateChange();
+    }
     // Perform initial load check to set correct mode immediately
-    if (m_callback)
+    else if (m_callback || m_tierCallback)
     {
+        if (m_utilizationCallback)
+        {
+            // Prime the per-CPU counters so the first tick has an interval to report
+            std::vector<double> utilization;
+            m_systemMonitor->sampleCpuUtilization(utilization);
+        }
+
         double load1min = getLoadAverage();
-        double highPerformanceAbsoluteThreshold = m_highPerformanceThreshold * m_cpuCoreCount;
+        double highPerformanceAbsoluteThreshold = m_highPerformanceThreshold * m_cpuCapacity;
 
         // Apply dual threshold logic with hysteresis:
         // High performance when load > high_performance_threshold
@@ -98,18 +189,17 @@ bool ActivityMonitor::start()
             m_isActive = false;
         }
 
-        double load1minPercentage = (load1min / m_cpuCoreCount) * 100;
+        double load1minPercentage = (load1min / m_cpuCapacity) * 100;
         Logger::info("Initial state: load: " + formatNumber(load1min) +
                     " (" + formatNumber(load1minPercentage) + "% avg per core)");
         Logger::info(m_isActive ?
             "System active - switching to performance mode" :
             "System idle - switching to power saving mode");
-        m_callback(m_isActive);
+        notifyStateChange();
     }
 
-    // Start monitoring in a separate thread
-    std::thread monitorThread(&ActivityMonitor::monitorLoop, this);
-    monitorThread.detach();
+    // Start monitoring in a separate thread; stop() joins it
+    m_monitorThread = std::thread(&ActivityMonitor::monitorLoop, this);
 
     // Wait for the monitoring thread to signal it's ready
     std::unique_lock<std::mutex> lock(m_readyMutex);
@@ -127,14 +217,25 @@ void ActivityMonitor::stop()
     }
 
     Logger::info("Stopping activity monitor...");
-    m_running.store(false);
+    if (m_sleepMonitor)
+    {
+        m_sleepMonitor->stop();
+    }
+    // Under the lock, so the flag cannot change between the loop's predicate check and its wait
+    {
+        std::lock_guard<std::mutex> lock(m_monitorMutex);
+        m_running.store(false);
+    }
 
     // ENERGY EFFICIENT: Wake sleeping thread for immediate shutdown
     // instead of waiting for timeout to expire
     m_monitorCondition.notify_all();
 
-    // Allow some time for the monitoring thread to exit gracefully
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    // A callback in flight (a tlp run, a verification) finishes before the caller restores anything
+    if (m_monitorThread.joinable())
+    {
+        m_monitorThread.join();
+    }
 
     Logger::info("Activity monitor stopped");
 }
@@ -144,16 +245,60 @@ void ActivityMonitor::setActivityCallback(ActivityCallback callback)
     m_callback = callback;
 }
 
+void ActivityMonitor::setTierCallback(TierCallback callback)
+{
+    m_tierCallback = callback;
+}
+
+void ActivityMonitor::setTierRetryCallback(TierCallback callback)
+{
+    m_tierRetryCallback = callback;
+}
+
+void ActivityMonitor::setDomainTierCallback(DomainTierCallback callback)
+{
+    m_domainTierCallback = callback;
+}
+
+void ActivityMonitor::setUtilizationCallback(UtilizationCallback callback)
+{
+    m_utilizationCallback = callback;
+}
+
+void ActivityMonitor::setResumeCallback(ResumeCallback callback)
+{
+    m_resumeCallback = callback;
+}
+
+void ActivityMonitor::setControlDomainScope(ControlDomainScope scope)
+{
+    m_controlDomainScope = scope;
+}
+
+void ActivityMonitor::setSchedule(const Schedule& schedule)
+{
+    m_schedule = schedule;
+    m_activeProfile = nullptr;
+    m_nextScheduleBoundary = std::chrono::system_clock::time_point::max();
+
+    if (!m_schedule.empty())
+    {
+        Logger::info("Schedule configured with " + std::to_string(m_schedule.getWindows().size()) + " window(s)");
+    }
+}
+
 void ActivityMonitor::setLoadThresholds(double highPerformanceThreshold, double powerSaveThreshold)
 {
     m_highPerformanceThreshold = highPerformanceThreshold;
     m_powerSaveThreshold = powerSaveThreshold;
-    double highPerformanceAbsoluteThreshold = highPerformanceThreshold * m_cpuCoreCount;
-    double powerSaveAbsoluteThreshold = powerSaveThreshold * m_cpuCoreCount;
+    m_baseHighPerformanceThreshold = highPerformanceThreshold;
+    m_basePowerSaveThreshold = powerSaveThreshold;
+    double highPerformanceAbsoluteThreshold = highPerformanceThreshold * m_cpuCapacity;
+    double powerSaveAbsoluteThreshold = powerSaveThreshold * m_cpuCapacity;
     Logger::info("High performance threshold set to " + formatNumber(highPerformanceThreshold) + " (" + formatNumber(highPerformanceThreshold * 100) + "% per core)");
     Logger::info("Power save threshold set to " + formatNumber(powerSaveThreshold) + " (" + formatNumber(powerSaveThreshold * 100) + "% per core)");
-    Logger::info("Absolute high performance threshold: " + formatNumber(highPerformanceAbsoluteThreshold) + " (for " + std::to_string(m_cpuCoreCount) + " cores)");
-    Logger::info("Absolute power save threshold: " + formatNumber(powerSaveAbsoluteThreshold) + " (for " + std::to_string(m_cpuCoreCount) + " cores)");
+    Logger::info("Absolute high performance threshold: " + formatNumber(highPerformanceAbsoluteThreshold) + " (for capacity " + formatNumber(m_cpuCapacity) + ")");
+    Logger::info("Absolute power save threshold: " + formatNumber(powerSaveAbsoluteThreshold) + " (for capacity " + formatNumber(m_cpuCapacity) + ")");
 }
 
 void ActivityMonitor::setMonitoringFrequency(int frequencySeconds)
@@ -169,6 +314,28 @@ void ActivityMonitor::setMonitoringFrequency(int frequencySeconds)
     Logger::info("Energy efficiency: minimum " + std::to_string(MINIMUM_STATE_CHANGE_INTERVAL) + "s between power state changes");
 }
 
+void ActivityMonitor::setPerfSampler(std::unique_ptr<IPerfSampler> sampler, double memoryBoundThreshold)
+{
+    m_perfSampler = std::move(sampler);
+    m_workloadClassifier = WorkloadClassifier(memoryBoundThreshold);
+    m_memoryBound = false;
+
+    if (m_perfSampler)
+    {
+        Logger::info("Workload classification enabled (" + m_perfSampler->getMemoryEvent() + ", memory-bound at " +
+                    formatNumber(memoryBoundThreshold * 100) + "%) - memory-bound load runs at balanced performance");
+    }
+}
+
+void ActivityMonitor::setSleepMonitor(std::unique_ptr<ISleepMonitor> sleepMonitor)
+{
+    m_sleepMonitor = std::move(sleepMonitor);
+    if (m_sleepMonitor)
+    {
+        Logger::info("Suspend detection enabled - power state is resynchronised on resume");
+    }
+}
+
 bool ActivityMonitor::isActive() const {
     return m_isActive;
 }
@@ -200,34 +367,99 @@ void ActivityMonitor::monitorLoop() {
     m_readyCondition.notify_one();
 
     while (m_running.load()) {
+        // The steady clock stops during suspend; the time suspended shows up as a gap between the boot and monotonic clocks
+        if (m_sleepMonitor) {
+            m_wakePending.store(false);
+            auto suspended = m_sleepMonitor->getSuspendedTime();
+            if (suspended && *suspended - m_suspendedTime >= MINIMUM_SUSPEND) {
+                auto duration = *suspended - m_suspendedTime;
+                m_suspendedTime = *suspended;
+                resynchronize(duration);
+            }
+        }
+
         auto now = std::chrono::steady_clock::now();
 
-        if (std::chrono::duration_cast<std::chrono::seconds>(now - m_lastLoadCheckTime).count() >= m_monitoringFrequencySeconds) {
+        // Schedule profiles only change at window boundaries, so a single comparison per wakeup suffices
+        if (!m_schedule.empty() && std::chrono::system_clock::now() >= m_nextScheduleBoundary) {
+            if (applyScheduleProfile(std::chrono::system_clock::now())) {
+                notifyStateChange();
+                m_lastStateChangeTime = now;
+            }
+        }
+
+        bool checkDue = std::chrono::duration_cast<std::chrono::seconds>(now - m_lastLoadCheckTime).count() >= m_monitoringFrequencySeconds;
+
+        // Hotplug and SMT switching change the capacity the thresholds are measured against
+        if (checkDue && m_systemMonitor->refreshOnlineCpus()) {
+            readCpuCapacity();
+            if (!m_domains.empty()) {
+                refreshControlDomains();
+            }
+        }
+
+        if (checkDue && updateWorkloadClass(now)) {
+            notifyStateChange();
+            m_lastStateChangeTime = now;
+        }
+
+        // A switch that failed, was rate limited or deferred is requested again on every check until it applies
+        if (checkDue && tierPending()) {
+            Logger::debug("Requesting the power tier again - the last switch did not apply");
+            notifyStateChange();
+        }
+
+        if (checkDue && !m_domains.empty()) {
+            // One /proc/stat pass feeds every domain, so all decide on the same interval
+            std::vector<double> utilization;
+            m_lastLoadCheckTime = now;
+            if (m_systemMonitor->sampleCpuUtilization(utilization)) {
+                if (evaluateDomains(utilization, now, false)) {
+                    notifyStateChange();
+                }
+                if (m_utilizationCallback) {
+                    m_utilizationCallback(utilization);
+                }
+            }
+        } else if (checkDue) {
             double load1min = getLoadAverage();
             m_lastLoadCheckTime = now;
 
-            double highPerformanceAbsoluteThreshold = m_highPerformanceThreshold * m_cpuCoreCount;
-            double powerSaveAbsoluteThreshold = m_powerSaveThreshold * m_cpuCoreCount;
+            std::vector<double> utilization;
+            bool sampled = false;
+            if (now < m_freshSignalUntil) {
+                // The load average still decays from the load before the suspend
+                sampled = m_systemMonitor->sampleCpuUtilization(utilization);
+                if (sampled) {
+                    load1min = utilizationLoad(utilization);
+                }
+            }
+
+            double highPerformanceAbsoluteThreshold = m_highPerformanceThreshold * m_cpuCapacity;
+            double powerSaveAbsoluteThreshold = m_powerSaveThreshold * m_cpuCapacity;
 
             Logger::debug("Load average: " + formatNumber(load1min) +
                          " (high perf threshold: " + formatNumber(highPerformanceAbsoluteThreshold) +
-                         " = " + formatNumber(m_highPerformanceThreshold * 100) + "% of " + std::to_string(m_cpuCoreCount) + " cores, " +
+                         " = " + formatNumber(m_highPerformanceThreshold * 100) + "% of capacity " + formatNumber(m_cpuCapacity) + ", " +
                          "power save threshold: " + formatNumber(powerSaveAbsoluteThreshold) +
-                         " = " + formatNumber(m_powerSaveThreshold * 100) + "% of " + std::to_string(m_cpuCoreCount) + " cores)");
+                         " = " + formatNumber(m_powerSaveThreshold * 100) + "% of capacity " + formatNumber(m_cpuCapacity) + ")");
 
             bool wasActive = m_isActive;
 
-            if (!m_isActive && load1min > highPerformanceAbsoluteThreshold) {
+            if (m_activeProfile && m_activeProfile->holdTier) {
+                Logger::debug("Schedule profile " + m_activeProfile->name + " holds tier " +
+                             powerTierToString(*m_activeProfile->holdTier) + " - load-based switching paused");
+            } else if (!m_isActive && load1min > highPerformanceAbsoluteThreshold) {
                 m_isActive = true;
             } else if (m_isActive && load1min < powerSaveAbsoluteThreshold) {
                 m_isActive = false;
             }
 
-            if (wasActive != m_isActive && m_callback) {
+            if (wasActive != m_isActive && (m_callback || m_tierCallback)) {
                 auto timeSinceLastChange = std::chrono::duration_cast<std::chrono::seconds>(now - m_lastStateChangeTime).count();
 
                 if (timeSinceLastChange >= MINIMUM_STATE_CHANGE_INTERVAL) {
-                    double load1minPercentage = (load1min / m_cpuCoreCount) * 100;
+                    double load1minPercentage = (load1min / m_cpuCapacity) * 100;
                     double highPerfPercentage = m_highPerformanceThreshold * 100;
                     double powerSavePercentage = m_powerSaveThreshold * 100;
 
@@ -238,19 +470,374 @@ void ActivityMonitor::monitorLoop() {
                         Logger::info("System became idle (load: " + formatNumber(load1min) +
                                     " = " + formatNumber(load1minPercentage) + "% avg per core < " + formatNumber(powerSavePercentage) + "%) - switching to power saving mode");
                     }
-                    m_callback(m_isActive);
+                    notifyStateChange();
                     m_lastStateChangeTime = now;
                 } else {
                     m_isActive = wasActive;
                     Logger::debug("State change suppressed for energy efficiency (last change " + std::to_string(timeSinceLastChange) + "s ago, minimum " + std::to_string(MINIMUM_STATE_CHANGE_INTERVAL) + "s)");
                 }
             }
+
+            // Continuous controllers run after the tier decision so they see the new tier
+            if (m_utilizationCallback && (sampled || m_systemMonitor->sampleCpuUtilization(utilization))) {
+                m_utilizationCallback(utilization);
+            }
         }
 
         // ENERGY EFFICIENT: Use condition_variable for blocking instead of polling
         // CPU can enter low-power states during wait, reducing energy consumption
-        const auto sleepDuration = std::chrono::seconds(std::max(m_monitoringFrequencySeconds, 10));
+        auto sleepDuration = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::seconds(std::max(m_monitoringFrequencySeconds, 10)));
+        if (!m_schedule.empty()) {
+            // Arm the wakeup for the next schedule boundary when it comes before the next tick
+            auto untilBoundary = m_nextScheduleBoundary - std::chrono::system_clock::now();
+            if (untilBoundary < sleepDuration) {
+                sleepDuration = std::max(std::chrono::milliseconds(0),
+                    std::chrono::ceil<std::chrono::milliseconds>(untilBoundary));
+            }
+        }
         std::unique_lock<std::mutex> lock(m_monitorMutex);
-        m_monitorCondition.wait_for(lock, sleepDuration, [this] { return !m_running.load(); });
+        m_monitorCondition.wait_for(lock, sleepDuration, [this] { return !m_running.load() || m_wakePending.load(); });
+    }
+}
+
+void ActivityMonitor::resynchronize(std::chrono::milliseconds suspended)
+{
+    Logger::info("Resumed after " + formatNumber(static_cast<double>(suspended.count()) / 1000.0) +
+                " s suspended - resynchronising power state");
+    if (m_resumeCallback)
+    {
+        m_resumeCallback();
+    }
+
+    // Counters and load average still describe the time before the suspend, so take a short fresh sample
+    std::vector<double> utilization;
+    m_systemMonitor->sampleCpuUtilization(utilization);
+    if (m_perfSampler)
+    {
+        m_perfSampler->sample();
+    }
+    {
+        std::unique_lock<std::mutex> lock(m_monitorMutex);
+        if (m_monitorCondition.wait_for(lock, RESUME_SAMPLE_WINDOW, [this] { return !m_running.load(); }))
+        {
+            return;
+        }
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    bool sampled = m_systemMonitor->sampleCpuUtilization(utilization);
+    m_freshSignalUntil = now + LOAD_AVERAGE_SETTLE;
+    m_lastLoadCheckTime = now;
+    m_lastStateChangeTime = now;
+
+    if (!m_schedule.empty() && std::chrono::system_clock::now() >= m_nextScheduleBoundary)
+    {
+        applyScheduleProfile(std::chrono::system_clock::now());
+    }
+
+    if (sampled && !m_domains.empty())
+    {
+        evaluateDomains(utilization, now, true);
+    }
+    else if (sampled && !(m_activeProfile && m_activeProfile->holdTier))
+    {
+        double load = utilizationLoad(utilization);
+        m_isActive = load > m_highPerformanceThreshold * m_cpuCapacity;
+        Logger::info("Load after resume: " + formatNumber(load) + " (" + formatNumber(load / m_cpuCapacity * 100) +
+                    "% avg per core)");
+    }
+
+    // The backend may have been switched behind our back, so apply every tier even if unchanged
+    m_tierApplied = false;
+    for (auto& state : m_domains)
+    {
+        state.tierApplied = false;
+    }
+    notifyStateChange();
+
+    if (sampled && m_utilizationCallback)
+    {
+        m_utilizationCallback(utilization);
+    }
+}
+
+double ActivityMonitor::utilizationLoad(const std::vector<double>& utilization) const
+{
+    // Busy CPUs, in capacity units so it compares with the thresholds like the load average does
+    std::vector<int> cpus(utilization.size());
+    std::iota(cpus.begin(), cpus.end(), 0);
+    return m_topology.weightedUtilization(utilization, cpus) * m_cpuCapacity;
+}
+
+bool ActivityMonitor::applyScheduleProfile(std::chrono::system_clock::time_point now)
+{
+    const ScheduleProfile* profile = m_schedule.activeProfileAt(now);
+    m_nextScheduleBoundary = m_schedule.nextBoundaryAfter(now);
+
+    if (profile == m_activeProfile)
+    {
+        return false;
+    }
+
+    m_activeProfile = profile;
+    if (profile)
+    {
+        m_highPerformanceThreshold = profile->highPerformanceThreshold.value_or(m_baseHighPerformanceThreshold);
+        m_powerSaveThreshold = profile->powerSaveThreshold.value_or(m_basePowerSaveThreshold);
+        Logger::info("Schedule profile '" + profile->name + "' active (high performance threshold: " +
+                    formatNumber(m_highPerformanceThreshold * 100) + "%, power save threshold: " +
+                    formatNumber(m_powerSaveThreshold * 100) + "%" +
+                    (profile->holdTier ? ", holding tier " + powerTierToString(*profile->holdTier) : std::string{}) + ")");
+    }
+    else
+    {
+        m_highPerformanceThreshold = m_baseHighPerformanceThreshold;
+        m_powerSaveThreshold = m_basePowerSaveThreshold;
+        Logger::info("No schedule profile active - using base thresholds");
+    }
+    return true;
+}
+
+PowerTier ActivityMonitor::targetTier() const
+{
+    if (m_domains.empty())
+    {
+        return targetTier(m_isActive);
+    }
+
+    // With control domains the system-wide tier is the highest domain tier
+    PowerTier tier = PowerTier::POWER_SAVE;
+    for (const auto& state : m_domains)
+    {
+        tier = std::max(tier, targetTier(state.isActive));
+    }
+    return tier;
+}
+
+PowerTier ActivityMonitor::targetTier(bool isActive) const
+{
+    if (m_activeProfile)
+    {
+        if (m_activeProfile->holdTier)
+        {
+            return *m_activeProfile->holdTier;
+        }
+        PowerTier tier = isActive ? m_activeProfile->activeTier : m_activeProfile->idleTier;
+        return m_memoryBound ? std::min(tier, PowerTier::BALANCED_PERFORMANCE) : tier;
+    }
+    if (!isActive)
+    {
+        return PowerTier::POWER_SAVE;
+    }
+    // Memory-bound load waits on DRAM, so the top tier would buy power but little speed
+    return m_memoryBound ? PowerTier::BALANCED_PERFORMANCE : PowerTier::PERFORMANCE;
+}
+
+bool ActivityMonitor::initializeControlDomains()
+{
+    std::vector<ControlDomain> domains = m_systemMonitor->getControlDomains(m_controlDomainScope);
+    if (domains.size() < 2)
+    {
+        Logger::info("Per-domain control (" + controlDomainScopeToString(m_controlDomainScope) + ") requested but " +
+                    std::to_string(domains.size()) + " control domain(s) found - using system-wide control");
+        return false;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    for (auto& domain : domains)
+    {
+        Logger::info("Control domain " + domain.name + ": " + std::to_string(domain.cpus.size()) + " CPU(s)");
+        DomainState state;
+        state.domain = std::move(domain);
+        state.lastStateChangeTime = now;
+        m_domains.push_back(std::move(state));
+    }
+    return true;
+}
+
+void ActivityMonitor::refreshControlDomains()
+{
+    std::vector<ControlDomain> domains = m_systemMonitor->getControlDomains(m_controlDomainScope);
+    if (domains.size() < 2)
+    {
+        Logger::warning("Only " + std::to_string(domains.size()) + " control domain(s) left after a CPU change - keeping the previous domains");
+        return;
+    }
+
+    // Domains that survive keep their decision state; the rest start idle like at startup
+    auto now = std::chrono::steady_clock::now();
+    std::vector<DomainState> states;
+    for (auto& domain : domains)
+    {
+        auto previous = std::find_if(m_domains.begin(), m_domains.end(),
+                                     [&domain](const DomainState& state) { return state.domain.name == domain.name; });
+        DomainState state;
+        if (previous != m_domains.end())
+        {
+            state = std::move(*previous);
+        }
+        else
+        {
+            Logger::info("Control domain " + domain.name + " appeared: " + std::to_string(domain.cpus.size()) + " CPU(s)");
+            state.lastStateChangeTime = now;
+        }
+        state.domain = std::move(domain);
+        states.push_back(std::move(state));
+    }
+    m_domains = std::move(states);
+}
+
+bool ActivityMonitor::evaluateDomains(const std::vector<double>& utilization,
+                                      std::chrono::steady_clock::time_point now, bool initial)
+{
+    bool holding = m_activeProfile && m_activeProfile->holdTier;
+    bool changed = false;
+
+    for (auto& state : m_domains)
+    {
+        // Without topology every CPU weighs the same, which is the plain mean
+        state.utilization = m_topology.weightedUtilization(utilization, state.domain.cpus);
+
+        Logger::debug("Domain " + state.domain.name + " utilization: " + formatNumber(state.utilization * 100) + "%");
+
+        if (initial)
+        {
+            state.isActive = state.utilization > m_highPerformanceThreshold;
+            continue;
+        }
+        if (holding)
+        {
+            continue;
+        }
+
+        bool wasActive = state.isActive;
+        if (!state.isActive && state.utilization > m_highPerformanceThreshold)
+        {
+            state.isActive = true;
+        }
+        else if (state.isActive && state.utilization < m_powerSaveThreshold)
+        {
+            state.isActive = false;
+        }
+
+        if (wasActive == state.isActive)
+        {
+            continue;
+        }
+
+        auto timeSinceLastChange = std::chrono::duration_cast<std::chrono::seconds>(now - state.lastStateChangeTime).count();
+        if (timeSinceLastChange < MINIMUM_STATE_CHANGE_INTERVAL)
+        {
+            state.isActive = wasActive;
+            Logger::debug("Domain " + state.domain.name + " state change suppressed for energy efficiency (last change " +
+                         std::to_string(timeSinceLastChange) + "s ago)");
+            continue;
+        }
+
+        Logger::info("Domain " + state.domain.name + (state.isActive ? " became active (utilization: " : " became idle (utilization: ") +
+                    formatNumber(state.utilization * 100) + "% " + (state.isActive ? "> " : "< ") +
+                    formatNumber((state.isActive ? m_highPerformanceThreshold : m_powerSaveThreshold) * 100) + "%)");
+        state.lastStateChangeTime = now;
+        changed = true;
+    }
+
+    m_isActive = std::any_of(m_domains.begin(), m_domains.end(), [](const DomainState& state) { return state.isActive; });
+    return changed;
+}
+
+void ActivityMonitor::notifyDomainStateChanges()
+{
+    for (auto& state : m_domains)
+    {
+        PowerTier tier = targetTier(state.isActive);
+        if (!state.tierApplied || tier != state.currentTier)
+        {
+            state.tierApplied = m_domainTierCallback(state.domain, tier);
+            if (state.tierApplied)
+            {
+                state.currentTier = tier;
+            }
+        }
+    }
+}
+
+void ActivityMonitor::notifyStateChange()
+{
+    if (!m_domains.empty())
+    {
+        notifyDomainStateChanges();
     }
+
+    if (m_tierCallback)
+    {
+        PowerTier tier = targetTier();
+        if (!m_tierApplied || tier != m_currentTier)
+        {
+            m_tierRetryPending = !m_tierCallback(tier);
+            m_currentTier = tier;
+            m_tierApplied = true;
+        }
+        else if (m_tierRetryPending)
+        {
+            m_tierRetryPending = !(m_tierRetryCallback ? m_tierRetryCallback(tier) : m_tierCallback(tier));
+        }
+    }
+    else if (m_callback)
+    {
+        m_callback(m_isActive);
+    }
+}
+
+bool ActivityMonitor::tierPending() const
+{
+    if (std::any_of(m_domains.begin(), m_domains.end(), [](const DomainState& state) { return !state.tierApplied; }))
+    {
+        return true;
+    }
+    return m_tierCallback && m_tierRetryPending;
+}
+
+bool ActivityMonitor::updateWorkloadClass(std::chrono::steady_clock::time_point now)
+{
+    if (!m_perfSampler)
+    {
+        return false;
+    }
+
+    auto counters = m_perfSampler->sample();
+    if (!counters)
+    {
+        return false;
+    }
+
+    WorkloadClass workloadClass = m_workloadClassifier.update(*counters);
+    Logger::debug("Workload: " + workloadClassToString(workloadClass) + " (IPC " + formatNumber(m_workloadClassifier.getIpc()) +
+                 ", memory-bound " + formatNumber(m_workloadClassifier.getMemoryBoundedness() * 100) + "%)");
+
+    bool memoryBound = workloadClass == WorkloadClass::MEMORY_BOUND;
+    if (memoryBound == m_memoryBound)
+    {
+        return false;
+    }
+
+    // The class only matters while a tier above balanced performance is selected
+    if (targetTier() < PowerTier::BALANCED_PERFORMANCE)
+    {
+        m_memoryBound = memoryBound;
+        return false;
+    }
+
+    auto timeSinceLastChange = std::chrono::duration_cast<std::chrono::seconds>(now - m_lastStateChangeTime).count();
+    if (timeSinceLastChange < MINIMUM_STATE_CHANGE_INTERVAL)
+    {
+        Logger::debug("Workload class change suppressed for energy efficiency (last change " + std::to_string(timeSinceLastChange) + "s ago)");
+        return false;
+    }
+
+    m_memoryBound = memoryBound;
+    Logger::info(std::string(memoryBound ? "Load became memory-bound" : "Load is no longer memory-bound") + " (IPC " +
+                formatNumber(m_workloadClassifier.getIpc()) + ", memory-bound " +
+                formatNumber(m_workloadClassifier.getMemoryBoundedness() * 100) + "%)");
+    return true;
 }
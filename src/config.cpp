@@ -6,10 +6,14 @@
 #include <sstream>
 #include <algorithm>
 #include <span>
+#include <cctype>
 #include <cmath>
 #include <limits>
 
-Config::Config() : m_monitoringFrequency{0}, m_highPerformanceThreshold{0.0}, m_powerSaveThreshold{0.0}
+Config::Config() : m_monitoringFrequency{0}, m_highPerformanceThreshold{0.0}, m_powerSaveThreshold{0.0},
+                   m_controlDomainScope{ControlDomainScope::SYSTEM}, m_pmQosPerCpu{false}, m_irqMaxRate{1000}, m_uclampMin{25}, m_uclampMax{50},
+                   m_perfCounters{false}, m_memoryBoundThreshold{0.5}, m_externalChangePolicy{ExternalChangePolicy::BACKOFF},
+                   m_turboControl{false}
 {
 }
 
@@ -332,6 +336,283 @@ bool Config::parseKeyValue(const std::string& key, const std::string& value)
                 Logger::warning("power_save_threshold value " + value + " out of range (0.05-0.9)");
             }
         }
+        else if (key.starts_with("schedule_profile."))
+        {
+            return m_schedule.addProfile(key.substr(std::string("schedule_profile.").size()), value);
+        }
+        else if (key == "schedule")
+        {
+            return m_schedule.addWindow(value);
+        }
+        else if (key == "power_backend")
+        {
+            return parsePowerBackendOrder(value);
+        }
+        else if (key == "frequency_cap_target")
+        {
+            double target = std::stod(value);
+            if (target >= 0.3 && target <= 0.95)
+            {
+                m_frequencyCapTarget = target;
+                return true;
+            }
+            else
+            {
+                Logger::warning("frequency_cap_target value " + value + " out of range (0.3-0.95)");
+            }
+        }
+        else if (key == "pm_qos_latency_us")
+        {
+            int latency = std::stoi(value);
+            if (latency >= 0 && latency <= 100000)
+            {
+                m_pmQosLatency = latency;
+                return true;
+            }
+            else
+            {
+                Logger::warning("pm_qos_latency_us value " + value + " out of range (0-100000)");
+            }
+        }
+        else if (key == "pm_qos_per_cpu")
+        {
+            if (value == "true" || value == "false")
+            {
+                m_pmQosPerCpu = value == "true";
+                return true;
+            }
+            Logger::warning("pm_qos_per_cpu value " + value + " is invalid (expected true or false)");
+        }
+        else if (key == "park_cpus")
+        {
+            return parseParkCpus(value);
+        }
+        else if (key == "irq_housekeeping_cpus")
+        {
+            auto cpus = parseCpuList(value);
+            if (cpus)
+            {
+                m_irqHousekeepingCpus = std::move(*cpus);
+                return true;
+            }
+            Logger::warning("irq_housekeeping_cpus value " + value + " is invalid (expected a CPU list such as 0-1)");
+        }
+        else if (key == "irq_max_rate")
+        {
+            int rate = std::stoi(value);
+            if (rate >= 10 && rate <= 1000000)
+            {
+                m_irqMaxRate = rate;
+                return true;
+            }
+            else
+            {
+                Logger::warning("irq_max_rate value " + value + " out of range (10-1000000)");
+            }
+        }
+        else if (key == "cpuset_cgroups")
+        {
+            auto cgroups = parseCgroupList(value);
+            if (cgroups)
+            {
+                m_cpusetCgroups = std::move(*cgroups);
+                return true;
+            }
+            Logger::warning("cpuset_cgroups value " + value + " is invalid (expected cgroup paths such as system.slice)");
+        }
+        else if (key == "uclamp_min_cgroups")
+        {
+            auto cgroups = parseCgroupList(value);
+            if (cgroups)
+            {
+                m_uclampMinCgroups = std::move(*cgroups);
+                return true;
+            }
+            Logger::warning("uclamp_min_cgroups value " + value + " is invalid (expected cgroup paths such as system.slice)");
+        }
+        else if (key == "uclamp_min")
+        {
+            int percent = std::stoi(value);
+            if (percent >= 1 && percent <= 100)
+            {
+                m_uclampMin = percent;
+                return true;
+            }
+            else
+            {
+                Logger::warning("uclamp_min value " + value + " out of range (1-100)");
+            }
+        }
+        else if (key == "uclamp_max_cgroups")
+        {
+            auto cgroups = parseCgroupList(value);
+            if (cgroups)
+            {
+                m_uclampMaxCgroups = std::move(*cgroups);
+                return true;
+            }
+            Logger::warning("uclamp_max_cgroups value " + value + " is invalid (expected cgroup paths such as system.slice)");
+        }
+        else if (key == "uclamp_max")
+        {
+            int percent = std::stoi(value);
+            if (percent >= 1 && percent <= 100)
+            {
+                m_uclampMax = percent;
+                return true;
+            }
+            else
+            {
+                Logger::warning("uclamp_max value " + value + " out of range (1-100)");
+            }
+        }
+        else if (key == "idle_injection_power_limit")
+        {
+            double watts = std::stod(value);
+            if (watts >= 1.0 && watts <= 1000.0)
+            {
+                m_idleInjectionPowerLimit = watts;
+                return true;
+            }
+            else
+            {
+                Logger::warning("idle_injection_power_limit value " + value + " out of range (1-1000)");
+            }
+        }
+        else if (key == "idle_injection_thermal_limit")
+        {
+            double limit = std::stod(value);
+            if (limit >= 50.0 && limit <= 105.0)
+            {
+                m_idleInjectionThermalLimit = limit;
+                return true;
+            }
+            else
+            {
+                Logger::warning("idle_injection_thermal_limit value " + value + " out of range (50-105)");
+            }
+        }
+        else if (key == "idle_injection_cgroups")
+        {
+            auto cgroups = parseCgroupList(value);
+            if (cgroups)
+            {
+                m_idleInjectionCgroups = std::move(*cgroups);
+                return true;
+            }
+            Logger::warning("idle_injection_cgroups value " + value + " is invalid (expected cgroup paths such as system.slice)");
+        }
+        else if (key == "perf_counters")
+        {
+            if (value == "true" || value == "false")
+            {
+                m_perfCounters = value == "true";
+                return true;
+            }
+            Logger::warning("perf_counters value " + value + " is invalid (expected true or false)");
+        }
+        else if (key == "memory_bound_threshold")
+        {
+            double threshold = std::stod(value);
+            if (threshold >= 0.2 && threshold <= 0.9)
+            {
+                m_memoryBoundThreshold = threshold;
+                return true;
+            }
+            else
+            {
+                Logger::warning("memory_bound_threshold value " + value + " out of range (0.2-0.9)");
+            }
+        }
+        else if (key == "external_change_policy")
+        {
+            auto policy = parseExternalChangePolicy(value);
+            if (policy)
+            {
+                m_externalChangePolicy = *policy;
+                return true;
+            }
+            Logger::warning("external_change_policy value " + value + " is invalid (expected off, adopt, backoff or reapply)");
+        }
+        else if (key == "smt_off_utilization")
+        {
+            double utilization = std::stod(value);
+            if (utilization >= 0.01 && utilization <= 0.2)
+            {
+                m_smtOffUtilization = utilization;
+                return true;
+            }
+            else
+            {
+                Logger::warning("smt_off_utilization value " + value + " out of range (0.01-0.2)");
+            }
+        }
+        else if (key == "turbo_control")
+        {
+            if (value == "true" || value == "false")
+            {
+                m_turboControl = value == "true";
+                return true;
+            }
+            Logger::warning("turbo_control value " + value + " is invalid (expected true or false)");
+        }
+        else if (key == "turbo_burst_threshold")
+        {
+            double threshold = std::stod(value);
+            if (threshold >= 0.5 && threshold <= 1.0)
+            {
+                m_turboSettings.burstThreshold = threshold;
+                return true;
+            }
+            else
+            {
+                Logger::warning("turbo_burst_threshold value " + value + " out of range (0.5-1.0)");
+            }
+        }
+        else if (key == "turbo_budget")
+        {
+            double budget = std::stod(value);
+            if (budget >= 0.05 && budget <= 1.0)
+            {
+                m_turboSettings.budget = budget;
+                return true;
+            }
+            else
+            {
+                Logger::warning("turbo_budget value " + value + " out of range (0.05-1.0)");
+            }
+        }
+        else if (key == "turbo_thermal_limit")
+        {
+            double limit = std::stod(value);
+            if (limit >= 50.0 && limit <= 105.0)
+            {
+                m_turboSettings.thermalLimit = limit;
+                return true;
+            }
+            else
+            {
+                Logger::warning("turbo_thermal_limit value " + value + " out of range (50-105 degrees Celsius)");
+            }
+        }
+        else if (key == "control_domains")
+        {
+            auto scope = parseControlDomainScope(value);
+            if (scope)
+            {
+                m_controlDomainScope = *scope;
+                return true;
+            }
+            Logger::warning("control_domains value " + value + " is invalid (expected system, cpufreq_policy or package)");
+        }
+        else if (key.starts_with("knob."))
+        {
+            return parseKnobSetting(key.substr(std::string("knob.").size()), value);
+        }
+        else if (key.starts_with("energy_model."))
+        {
+            return parseEnergyModel(key.substr(std::string("energy_model.").size()), value);
+        }
         else
         {
             Logger::warning("Unknown configuration key: " + key);
@@ -382,5 +663,217 @@ bool Config::validateConfiguration() const
                        "%) may rarely trigger power save mode");
     }
 
+    if (!m_schedule.validate())
+    {
+        return false;
+    }
+
+    // Profiles that override only one threshold must still keep the hysteresis gap
+    for (const auto& profile : m_schedule.getProfiles())
+    {
+        double high = profile.highPerformanceThreshold.value_or(m_highPerformanceThreshold);
+        double low = profile.powerSaveThreshold.value_or(m_powerSaveThreshold);
+        if (low >= high)
+        {
+            Logger::error("Configuration error: schedule profile " + profile.name +
+                         " results in power_save_threshold (" + std::to_string(low) +
+                         ") not less than high_performance_threshold (" + std::to_string(high) + ")");
+            return false;
+        }
+    }
+
+    if (!m_schedule.empty())
+    {
+        Logger::info("Schedule: " + std::to_string(m_schedule.getWindows().size()) + " window(s), " +
+                    std::to_string(m_schedule.getProfiles().size()) + " profile(s)");
+    }
+
+    return true;
+}
+
+bool Config::parsePowerBackendOrder(const std::string& value)
+{
+    m_powerBackendOrder.clear();
+    if (value == "auto")
+    {
+        return true;
+    }
+
+    std::istringstream stream(value);
+    std::string name;
+    while (std::getline(stream, name, ','))
+    {
+        name = trim(std::span<const char>{name.data(), name.size()});
+        bool validName = !name.empty() && std::all_of(name.begin(), name.end(),
+            [](char c) { return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '-'; });
+        if (!validName)
+        {
+            Logger::warning("Invalid power_backend entry '" + name + "' (expected 'auto' or a comma separated list of backend names)");
+            m_powerBackendOrder.clear();
+            return false;
+        }
+        if (std::find(m_powerBackendOrder.begin(), m_powerBackendOrder.end(), name) != m_powerBackendOrder.end())
+        {
+            Logger::warning("Duplicate power_backend entry: " + name);
+            m_powerBackendOrder.clear();
+            return false;
+        }
+        m_powerBackendOrder.push_back(name);
+    }
+    return !m_powerBackendOrder.empty();
+}
+
+bool Config::parseKnobSetting(const std::string& tierName, const std::string& value)
+{
+    auto tier = parsePowerTier(tierName);
+    if (!tier)
+    {
+        Logger::warning("Unknown tier in knob." + tierName + " (expected power, balance_power, balance_performance or performance)");
+        return false;
+    }
+
+    // knob.<tier> = <path or sysctl>=<value>
+    size_t equalPos = value.find('=');
+    if (equalPos == std::string::npos)
+    {
+        Logger::warning("Invalid knob entry '" + value + "' (expected <path or sysctl name>=<value>)");
+        return false;
+    }
+
+    std::string target = trim(std::span<const char>{value.data(), equalPos});
+    std::string knobValue = trim(std::span<const char>{value.data() + equalPos + 1, value.size() - equalPos - 1});
+
+    bool validTarget = false;
+    if (target.starts_with("/"))
+    {
+        validTarget = SecurityUtils::validatePathTraversal(target) &&
+                      std::none_of(target.begin(), target.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)); });
+    }
+    else
+    {
+        // Sysctl names separate components with '.' or, as in sysctl.d(5), with '/'
+        validTarget = !target.empty() && SecurityUtils::validatePathTraversal(target) &&
+                      std::all_of(target.begin(), target.end(), [](char c) {
+                          return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '-' || c == '.' || c == '/';
+                      });
+    }
+    if (!validTarget)
+    {
+        Logger::warning("Invalid knob target '" + target + "' (expected an absolute path or a sysctl name)");
+        return false;
+    }
+
+    bool validValue = !knobValue.empty() && std::none_of(knobValue.begin(), knobValue.end(),
+        [](char c) { return std::iscntrl(static_cast<unsigned char>(c)); });
+    if (!validValue)
+    {
+        Logger::warning("Invalid value for knob " + target);
+        return false;
+    }
+
+    m_knobProfiles[static_cast<size_t>(*tier)].push_back({target, knobValue});
     return true;
 }
+
+bool Config::parseEnergyModel(const std::string& domainName, const std::string& value)
+{
+    // energy_model.cpu<N> = <frequency_khz>:<power>,... for the performance domain holding CPU N
+    if (domainName.size() < 4 || !domainName.starts_with("cpu") ||
+        !std::all_of(domainName.begin() + 3, domainName.end(), [](unsigned char c) { return std::isdigit(c); }))
+    {
+        Logger::warning("Invalid energy model domain energy_model." + domainName + " (expected energy_model.cpu<N>)");
+        return false;
+    }
+
+    auto points = EnergyModel::parseTable(value);
+    if (!points)
+    {
+        Logger::warning("Invalid energy model table for " + domainName + " (expected <frequency_khz>:<power>,...)");
+        return false;
+    }
+
+    m_energyModelTables[std::stoi(domainName.substr(3))] = std::move(*points);
+    return true;
+}
+
+std::optional<std::vector<int>> Config::parseCpuList(const std::string& value)
+{
+    // <cpu list>, e.g. 4-7,10
+    std::vector<int> cpus;
+    std::istringstream stream(value);
+    std::string range;
+    while (std::getline(stream, range, ','))
+    {
+        size_t dash = range.find('-');
+        std::string firstText = range.substr(0, dash);
+        std::string lastText = dash == std::string::npos ? firstText : range.substr(dash + 1);
+        if (firstText.empty() || lastText.empty() ||
+            !std::all_of(firstText.begin(), firstText.end(), [](unsigned char c) { return std::isdigit(c); }) ||
+            !std::all_of(lastText.begin(), lastText.end(), [](unsigned char c) { return std::isdigit(c); }) ||
+            firstText.size() > 5 || lastText.size() > 5)
+        {
+            return std::nullopt;
+        }
+
+        int first = std::stoi(firstText);
+        int last = std::stoi(lastText);
+        if (last < first || last >= MAX_CPUS)
+        {
+            return std::nullopt;
+        }
+        for (int cpu = first; cpu <= last; ++cpu)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    if (cpus.empty())
+    {
+        return std::nullopt;
+    }
+    return cpus;
+}
+
+bool Config::parseParkCpus(const std::string& value)
+{
+    // CPU 0 is the boot CPU and never parked
+    auto cpus = parseCpuList(value);
+    if (!cpus || cpus->front() == 0)
+    {
+        Logger::warning("park_cpus value " + value + " is invalid (expected a list of CPUs 1-" +
+                        std::to_string(MAX_CPUS - 1) + " such as 4-7,10)");
+        return false;
+    }
+    m_parkCpus = std::move(*cpus);
+    return true;
+}
+
+std::optional<std::vector<std::string>> Config::parseCgroupList(const std::string& value)
+{
+    // <cgroup>[,<cgroup>...], paths relative to the cgroup root
+    std::vector<std::string> cgroups;
+    std::istringstream stream(value);
+    std::string cgroup;
+    while (std::getline(stream, cgroup, ','))
+    {
+        cgroup = trim(cgroup);
+        bool validChars = std::all_of(cgroup.begin(), cgroup.end(), [](unsigned char c) {
+            return std::isalnum(c) || c == '.' || c == '-' || c == '_' || c == '@' || c == ':' || c == '/';
+        });
+        // The cgroup root itself cannot be configured, and paths must stay below it
+        if (cgroup.empty() || !validChars || cgroup.front() == '/' || cgroup.back() == '/' ||
+            ("/" + cgroup + "/").find("/../") != std::string::npos || ("/" + cgroup + "/").find("/./") != std::string::npos)
+        {
+            return std::nullopt;
+        }
+        cgroups.push_back(cgroup);
+    }
+
+    if (cgroups.empty())
+    {
+        return std::nullopt;
+    }
+    return cgroups;
+}
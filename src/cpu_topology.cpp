@@ -0,0 +1,172 @@
+#include "cpu_topology.h"
+#include <algorithm>
+#include <iomanip>
+#include <set>
+#include <sstream>
+#include <utility>
+
+CpuTopology::CpuTopology(std::vector<CpuInfo> cpus)
+    : m_cpus(std::move(cpus))
+{
+    std::sort(m_cpus.begin(), m_cpus.end(), [](const CpuInfo& a, const CpuInfo& b) { return a.cpu < b.cpu; });
+
+    double maxCapacity = 0.0;
+    for (const auto& info : m_cpus)
+    {
+        maxCapacity = std::max(maxCapacity, info.capacity);
+    }
+    for (auto& info : m_cpus)
+    {
+        info.capacity = maxCapacity > 0.0 ? info.capacity / maxCapacity : 1.0;
+    }
+}
+
+bool CpuTopology::isHybrid() const
+{
+    bool hasPerformance = countCpus(CoreType::PERFORMANCE) > 0;
+    bool hasEfficiency = countCpus(CoreType::EFFICIENCY) > 0;
+    bool mixedCapacity = std::any_of(m_cpus.begin(), m_cpus.end(),
+        [](const CpuInfo& info) { return info.capacity < 0.99; });
+    return (hasPerformance && hasEfficiency) || mixedCapacity;
+}
+
+double CpuTopology::getCapacity() const
+{
+    double capacity = 0.0;
+    for (const auto& info : m_cpus)
+    {
+        capacity += info.capacity;
+    }
+    return capacity;
+}
+
+double CpuTopology::getCapacity(const std::vector<int>& cpus) const
+{
+    double capacity = 0.0;
+    for (int cpu : cpus)
+    {
+        const CpuInfo* info = find(cpu);
+        capacity += info ? info->capacity : 0.0;
+    }
+    return capacity;
+}
+
+double CpuTopology::weightedUtilization(const std::vector<double>& utilization, const std::vector<int>& cpus) const
+{
+    double used = 0.0;
+    double capacity = 0.0;
+    for (int cpu : cpus)
+    {
+        if (cpu < 0 || static_cast<size_t>(cpu) >= utilization.size())
+        {
+            continue;
+        }
+        // Without a topology every CPU counts as full capacity; with one, missing CPUs are offline
+        const CpuInfo* info = find(cpu);
+        if (!info && !m_cpus.empty())
+        {
+            continue;
+        }
+        double weight = info ? info->capacity : 1.0;
+        used += utilization[static_cast<size_t>(cpu)] * weight;
+        capacity += weight;
+    }
+    return capacity > 0.0 ? used / capacity : 0.0;
+}
+
+std::vector<int> CpuTopology::getEfficiencyCpus() const
+{
+    std::vector<int> cpus;
+    if (countCpus(CoreType::EFFICIENCY) > 0)
+    {
+        for (const auto& info : m_cpus)
+        {
+            if (info.type == CoreType::EFFICIENCY)
+            {
+                cpus.push_back(info.cpu);
+            }
+        }
+        return cpus;
+    }
+
+    double minCapacity = 1.0;
+    for (const auto& info : m_cpus)
+    {
+        minCapacity = std::min(minCapacity, info.capacity);
+    }
+    if (minCapacity >= 0.99)
+    {
+        return cpus;
+    }
+    for (const auto& info : m_cpus)
+    {
+        if (info.capacity < minCapacity + 0.01)
+        {
+            cpus.push_back(info.cpu);
+        }
+    }
+    return cpus;
+}
+
+int CpuTopology::countCpus(CoreType type) const
+{
+    return static_cast<int>(std::count_if(m_cpus.begin(), m_cpus.end(),
+        [type](const CpuInfo& info) { return info.type == type; }));
+}
+
+int CpuTopology::getPhysicalCoreCount() const
+{
+    std::set<std::pair<int, int>> cores;
+    for (const auto& info : m_cpus)
+    {
+        cores.emplace(info.package, info.core);
+    }
+    return static_cast<int>(cores.size());
+}
+
+int CpuTopology::getPackageCount() const
+{
+    std::set<int> packages;
+    for (const auto& info : m_cpus)
+    {
+        packages.insert(info.package);
+    }
+    return static_cast<int>(packages.size());
+}
+
+std::string CpuTopology::describe() const
+{
+    std::ostringstream oss;
+    if (countCpus(CoreType::PERFORMANCE) > 0 || countCpus(CoreType::EFFICIENCY) > 0)
+    {
+        // Count physical cores of each type, not SMT threads
+        std::set<std::pair<int, int>> performanceCores;
+        std::set<std::pair<int, int>> efficiencyCores;
+        for (const auto& info : m_cpus)
+        {
+            if (info.type == CoreType::PERFORMANCE)
+            {
+                performanceCores.emplace(info.package, info.core);
+            }
+            else if (info.type == CoreType::EFFICIENCY)
+            {
+                efficiencyCores.emplace(info.package, info.core);
+            }
+        }
+        oss << performanceCores.size() << "P+" << efficiencyCores.size() << "E cores, ";
+    }
+    else
+    {
+        oss << getPhysicalCoreCount() << " cores, ";
+    }
+    oss << m_cpus.size() << " CPUs, " << getPackageCount() << " package(s), capacity "
+        << std::fixed << std::setprecision(2) << getCapacity();
+    return oss.str();
+}
+
+const CpuInfo* CpuTopology::find(int cpu) const
+{
+    auto it = std::lower_bound(m_cpus.begin(), m_cpus.end(), cpu,
+        [](const CpuInfo& info, int value) { return info.cpu < value; });
+    return it != m_cpus.end() && it->cpu == cpu ? &*it : nullptr;
+}
@@ -0,0 +1,94 @@
+#include "energy_model.h"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <utility>
+
+EnergyModel::EnergyModel(std::vector<OperatingPoint> points)
+{
+    for (auto& point : points)
+    {
+        if (point.frequencyKhz <= 0)
+        {
+            continue;
+        }
+        if (point.cost <= 0.0)
+        {
+            point.cost = point.power / static_cast<double>(point.frequencyKhz);
+        }
+        m_points.push_back(point);
+    }
+    std::sort(m_points.begin(), m_points.end(),
+              [](const OperatingPoint& a, const OperatingPoint& b) { return a.frequencyKhz < b.frequencyKhz; });
+    if (m_points.empty())
+    {
+        return;
+    }
+
+    // Walk down from the fastest point, tracking the cheapest point at or above each frequency.
+    // Inefficient points, which a faster point beats on cost, are never selected
+    double maxFrequency = static_cast<double>(m_points.back().frequencyKhz);
+    size_t cheapest = m_points.size() - 1;
+    size_t next = m_points.size() - 1;
+    for (size_t percent = TABLE_RESOLUTION + 1; percent-- > 0;)
+    {
+        double required = maxFrequency * static_cast<double>(percent) / static_cast<double>(TABLE_RESOLUTION);
+        while (next > 0 && static_cast<double>(m_points[next - 1].frequencyKhz) >= required)
+        {
+            --next;
+            if (m_points[next].cost <= m_points[cheapest].cost)
+            {
+                cheapest = next;
+            }
+        }
+        m_table[percent] = cheapest;
+    }
+}
+
+const OperatingPoint& EnergyModel::select(double demand) const
+{
+    double percent = std::ceil(std::clamp(demand, 0.0, 1.0) * static_cast<double>(TABLE_RESOLUTION));
+    return m_points[m_table[static_cast<size_t>(percent)]];
+}
+
+std::optional<std::vector<OperatingPoint>> EnergyModel::parseTable(const std::string& table)
+{
+    std::vector<OperatingPoint> points;
+    std::istringstream stream(table);
+    std::string entry;
+
+    while (std::getline(stream, entry, ','))
+    {
+        size_t colon = entry.find(':');
+        if (colon == std::string::npos)
+        {
+            return std::nullopt;
+        }
+        try
+        {
+            size_t frequencyEnd = 0;
+            size_t powerEnd = 0;
+            std::string frequencyText = entry.substr(0, colon);
+            std::string powerText = entry.substr(colon + 1);
+            OperatingPoint point;
+            point.frequencyKhz = std::stoi(frequencyText, &frequencyEnd);
+            point.power = std::stod(powerText, &powerEnd);
+            if (frequencyEnd != frequencyText.size() || powerEnd != powerText.size() ||
+                point.frequencyKhz <= 0 || point.power <= 0.0)
+            {
+                return std::nullopt;
+            }
+            points.push_back(point);
+        }
+        catch (const std::exception&)
+        {
+            return std::nullopt;
+        }
+    }
+
+    if (points.empty())
+    {
+        return std::nullopt;
+    }
+    return points;
+}
@@ -0,0 +1,146 @@
+#include "external_change_guard.h"
+#include "logger.h"
+#include <algorithm>
+
+ExternalChangeGuard::ExternalChangeGuard(IPowerManager& powerManager, ExternalChangePolicy policy,
+                                         std::chrono::seconds checkInterval)
+    : m_powerManager{powerManager}
+    , m_policy{policy}
+    , m_checkInterval{checkInterval}
+    , m_streak{0}
+    , m_conflicts{0}
+{
+}
+
+bool ExternalChangeGuard::setTier(PowerTier tier, std::chrono::steady_clock::time_point now)
+{
+    m_tier = tier;
+    if (m_warmStartTier)
+    {
+        bool inEffect = *m_warmStartTier == tier && m_powerManager.confirmTier(tier);
+        m_warmStartTier.reset();
+        if (inEffect)
+        {
+            Logger::info("Power tier " + powerTierToString(tier) + " is already in effect - skipping the " +
+                         m_powerManager.getBackendName() + " switch (warm start)");
+            return true;
+        }
+    }
+    if (isHolding(now))
+    {
+        Logger::debug("Power tier " + powerTierToString(tier) + " deferred until the external change hold-off ends");
+        return true;
+    }
+    return m_powerManager.setTier(tier);
+}
+
+bool ExternalChangeGuard::setDomainTier(const ControlDomain& domain, PowerTier tier,
+                                        std::chrono::steady_clock::time_point now)
+{
+    m_domainTiers.insert_or_assign(domain.name, std::make_pair(domain, tier));
+    if (isHolding(now))
+    {
+        Logger::debug("Power tier " + powerTierToString(tier) + " for " + domain.name +
+                      " deferred until the external change hold-off ends");
+        return true;
+    }
+    return m_powerManager.setDomainTier(domain, tier);
+}
+
+void ExternalChangeGuard::update(std::chrono::steady_clock::time_point now)
+{
+    if (m_policy == ExternalChangePolicy::OFF)
+    {
+        return;
+    }
+
+    if (m_holdUntil && now >= *m_holdUntil)
+    {
+        m_holdUntil.reset();
+        Logger::info("External change hold-off ended - applying the current power tier again");
+        reassert();
+    }
+
+    if (m_lastCheck && now - *m_lastCheck < m_checkInterval)
+    {
+        return;
+    }
+    m_lastCheck = now;
+
+    std::vector<ExternalChange> changes = m_powerManager.detectExternalChanges();
+    if (changes.empty())
+    {
+        // An agent that stayed quiet for a whole hold-off is no longer fighting
+        if (m_streak > 0 && !m_holdUntil && now - m_lastConflict >= holdOff())
+        {
+            m_streak = 0;
+        }
+        return;
+    }
+
+    ++m_conflicts;
+    m_lastConflict = now;
+    for (const auto& change : changes)
+    {
+        Logger::warning("External change to " + change.setting + ": " + change.expected + " -> " + change.actual +
+                        " (writer: " + change.writer + ")");
+    }
+
+    if (isHolding(now))
+    {
+        return;  // Already yielding; the hold-off end applies our tier again
+    }
+
+    switch (m_policy)
+    {
+        case ExternalChangePolicy::ADOPT:
+            Logger::info("Keeping the external " + m_powerManager.getBackendName() + " settings until the next tier change");
+            break;
+        case ExternalChangePolicy::BACKOFF:
+            m_holdUntil = now + holdOff();
+            Logger::info("Backing off from " + m_powerManager.getBackendName() + " switches for " +
+                         std::to_string(holdOff().count()) + " s");
+            ++m_streak;
+            break;
+        case ExternalChangePolicy::REAPPLY:
+            Logger::info("Applying the current power tier again; next re-apply in " +
+                         std::to_string(holdOff().count()) + " s at the earliest");
+            reassert();
+            m_holdUntil = now + holdOff();
+            ++m_streak;
+            break;
+        default:
+            break;
+    }
+}
+
+void ExternalChangeGuard::resync()
+{
+    for (const auto& change : m_powerManager.detectExternalChanges())
+    {
+        Logger::info("Changed while suspended: " + change.setting + ": " + change.expected + " -> " + change.actual);
+    }
+    // Re-reads the mode, so a backend that caches it stops reporting the pre-suspend one
+    std::string mode = m_powerManager.getCurrentMode();
+    Logger::debug(m_powerManager.getBackendName() + " mode after resume: " + mode);
+}
+
+std::chrono::seconds ExternalChangeGuard::holdOff() const
+{
+    // Backing off starts longer than re-applying, since yielding is the point of it
+    std::chrono::seconds base = m_policy == ExternalChangePolicy::REAPPLY ? std::chrono::seconds(60) : std::chrono::seconds(300);
+    std::chrono::seconds limit = m_policy == ExternalChangePolicy::REAPPLY ? std::chrono::seconds(1800) : std::chrono::seconds(3600);
+    return std::min(base * (1 << std::min(m_streak, 6)), limit);
+}
+
+void ExternalChangeGuard::reassert()
+{
+    if (m_tier)
+    {
+        m_powerManager.setTier(*m_tier);
+    }
+    for (const auto& [name, domainTier] : m_domainTiers)
+    {
+        m_powerManager.setDomainTier(domainTier.first, domainTier.second);
+    }
+}
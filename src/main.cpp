@@ -13,13 +13,18 @@
 #include "activity_monitor.h"
 #include "logger.h"
 #include "config.h"
+#include "external_change_guard.h"
 #include "platform/platform_factory.h"
+#include "warm_start_state.h"
+#include <algorithm>
 #include <iostream>
 #include <thread>
 #include <chrono>
 #include <cstdio>
 #include <cstdlib>
+#include <filesystem>
 #include <memory>
+#include <optional>
 
 void printUsage(const char* programName)
 {
@@ -40,18 +45,352 @@ void printVersion()
               << "Copyright (c) 2025 DDOSoft Solutions (www.ddosoft.com)\n";
 }
 
-void configurePowerManagement(ActivityMonitor& activityMonitor, std::unique_ptr<IPowerManager>& powerManager)
+void configurePowerManagement(ActivityMonitor& activityMonitor, std::unique_ptr<IKnobManager>& knobManager,
+                              std::unique_ptr<IFrequencyController>& frequencyController,
+                              std::unique_ptr<ITurboController>& turboController,
+                              std::unique_ptr<ISmtController>& smtController,
+                              std::unique_ptr<ICpuParkingController>& cpuParking,
+                              std::unique_ptr<IPmQosController>& pmQosController,
+                              std::unique_ptr<IIrqAffinityController>& irqAffinity,
+                              std::unique_ptr<ICpusetController>& cpuset,
+                              std::unique_ptr<IUclampController>& uclamp,
+                              std::unique_ptr<IIdleInjectionController>& idleInjection,
+                              ExternalChangeGuard& externalChangeGuard)
 {
-    activityMonitor.setActivityCallback([&powerManager](bool isActive) {
-        if (isActive)
+    activityMonitor.setTierCallback([&activityMonitor, &externalChangeGuard, &knobManager, &frequencyController,
+                                     &turboController, &smtController, &cpuParking, &pmQosController,
+                                     &irqAffinity, &cpuset, &uclamp](PowerTier tier) {
+        Logger::info("Applying power tier: " + powerTierToString(tier));
+        // Parked CPUs come back before anything raises performance
+        if (cpuParking)
         {
-            powerManager->setPerformanceMode();
+            cpuParking->setTier(tier);
         }
-        else
+        if (cpuset)
+        {
+            cpuset->setTier(tier);
+        }
+        if (uclamp)
+        {
+            uclamp->setTier(tier);
+        }
+        // With control domains the backend is driven per domain; the system tier only drives the knobs
+        bool applied = true;
+        if (!activityMonitor.usesControlDomains())
+        {
+            applied = externalChangeGuard.setTier(tier, std::chrono::steady_clock::now());
+        }
+        if (knobManager)
+        {
+            knobManager->applyTier(tier);
+        }
+        if (frequencyController)
         {
-            powerManager->setPowerSavingMode();
+            frequencyController->setTier(tier);
         }
+        // After the backend, which may write the turbo switch itself
+        if (turboController)
+        {
+            turboController->setTier(tier);
+        }
+        if (smtController)
+        {
+            smtController->setTier(tier);
+        }
+        if (pmQosController)
+        {
+            pmQosController->setTier(tier);
+        }
+        if (irqAffinity)
+        {
+            irqAffinity->setTier(tier);
+        }
+        return applied;
+    });
+    // A retry only switches the backend; the other actuators took the tier when it was requested
+    activityMonitor.setTierRetryCallback([&activityMonitor, &externalChangeGuard](PowerTier tier) {
+        return activityMonitor.usesControlDomains() || externalChangeGuard.setTier(tier, std::chrono::steady_clock::now());
     });
+    // Re-read the backend before the monitor applies the tier again
+    activityMonitor.setResumeCallback([&externalChangeGuard]() { externalChangeGuard.resync(); });
+    activityMonitor.setDomainTierCallback([&externalChangeGuard](const ControlDomain& domain, PowerTier tier) {
+        Logger::info("Applying power tier " + powerTierToString(tier) + " to control domain " + domain.name);
+        return externalChangeGuard.setDomainTier(domain, tier, std::chrono::steady_clock::now());
+    });
+    if (turboController && cpuParking)
+    {
+        turboController->setBoostCallback([&cpuParking]() { cpuParking->unpark(); });
+    }
+    if (frequencyController || turboController || smtController || pmQosController || irqAffinity || idleInjection ||
+        externalChangeGuard.isEnabled())
+    {
+        activityMonitor.setUtilizationCallback([&frequencyController, &turboController, &smtController, &pmQosController,
+                                                &irqAffinity, &idleInjection, &externalChangeGuard](const std::vector<double>& utilization) {
+            // Before the controllers, so a conflict is seen before anything else is written
+            externalChangeGuard.update(std::chrono::steady_clock::now());
+            if (frequencyController)
+            {
+                frequencyController->update(utilization);
+            }
+            if (turboController)
+            {
+                turboController->update(utilization);
+            }
+            if (smtController)
+            {
+                smtController->update(utilization);
+            }
+            if (pmQosController)
+            {
+                pmQosController->update(utilization);
+            }
+            if (irqAffinity)
+            {
+                irqAffinity->update(std::chrono::steady_clock::now());
+            }
+            // Last, so the budget sees the frequency caps already in place
+            if (idleInjection)
+            {
+                idleInjection->update(std::chrono::steady_clock::now());
+            }
+        });
+    }
+}
+
+void configureFrequencyController(std::unique_ptr<IFrequencyController>& frequencyController, const Config& config)
+{
+    auto target = config.getFrequencyCapTarget();
+    if (!target)
+    {
+        frequencyController.reset();
+        return;
+    }
+
+    if (!frequencyController || !frequencyController->initialize(*target, config.getEnergyModelTables()))
+    {
+        Logger::warning("frequency_cap_target is set but CPU frequencies cannot be capped on this system - ignoring");
+        frequencyController.reset();
+    }
+}
+
+void configureTurboController(std::unique_ptr<ITurboController>& turboController, const Config& config)
+{
+    auto settings = config.getTurboSettings();
+    if (!settings)
+    {
+        turboController.reset();
+        return;
+    }
+
+    if (!turboController || !turboController->initialize(*settings))
+    {
+        Logger::warning("turbo_control is enabled but turbo cannot be switched on this system - ignoring");
+        turboController.reset();
+    }
+}
+
+void configureSmtController(std::unique_ptr<ISmtController>& smtController, const Config& config)
+{
+    auto offUtilization = config.getSmtOffUtilization();
+    if (!offUtilization)
+    {
+        smtController.reset();
+        return;
+    }
+
+    if (!smtController || !smtController->initialize(*offUtilization))
+    {
+        Logger::warning("smt_off_utilization is set but SMT cannot be switched on this system - ignoring");
+        smtController.reset();
+    }
+}
+
+void configureCpuParking(std::unique_ptr<ICpuParkingController>& cpuParking, const Config& config)
+{
+    if (config.getParkCpus().empty())
+    {
+        cpuParking.reset();
+        return;
+    }
+
+    if (!cpuParking || !cpuParking->initialize(config.getParkCpus()))
+    {
+        Logger::warning("park_cpus is set but none of the CPUs can be parked on this system - ignoring");
+        cpuParking.reset();
+    }
+}
+
+void configurePmQos(std::unique_ptr<IPmQosController>& pmQosController, const Config& config)
+{
+    auto latency = config.getPmQosLatency();
+    if (!latency)
+    {
+        pmQosController.reset();
+        return;
+    }
+
+    if (!pmQosController || !pmQosController->initialize(*latency, config.getPmQosPerCpu()))
+    {
+        Logger::warning("pm_qos_latency_us is set but CPU latency requests are not available on this system - ignoring");
+        pmQosController.reset();
+    }
+}
+
+void configureIrqAffinity(std::unique_ptr<IIrqAffinityController>& irqAffinity, const Config& config)
+{
+    if (config.getIrqHousekeepingCpus().empty())
+    {
+        irqAffinity.reset();
+        return;
+    }
+
+    if (!irqAffinity || !irqAffinity->initialize(config.getIrqHousekeepingCpus(), config.getIrqMaxRate()))
+    {
+        Logger::warning("irq_housekeeping_cpus is set but interrupt affinity cannot be changed on this system - ignoring");
+        irqAffinity.reset();
+    }
+}
+
+void configureCpuset(std::unique_ptr<ICpusetController>& cpuset, const Config& config, const CpuTopology& topology)
+{
+    if (config.getCpusetCgroups().empty())
+    {
+        cpuset.reset();
+        return;
+    }
+
+    // Parked CPUs are offline in the power save tier and cannot take the work
+    std::vector<int> cpus = topology.getEfficiencyCpus();
+    const auto& parked = config.getParkCpus();
+    std::erase_if(cpus, [&parked](int cpu) { return std::find(parked.begin(), parked.end(), cpu) != parked.end(); });
+    if (cpus.empty())
+    {
+        Logger::warning("cpuset_cgroups is set but this system has no efficiency CPUs outside park_cpus - ignoring");
+        cpuset.reset();
+        return;
+    }
+
+    if (!cpuset || !cpuset->initialize(config.getCpusetCgroups(), cpus))
+    {
+        Logger::warning("cpuset_cgroups is set but none of the cgroups has a writable cpuset on this system - ignoring");
+        cpuset.reset();
+    }
+}
+
+void configureUclamp(std::unique_ptr<IUclampController>& uclamp, const Config& config)
+{
+    if (config.getUclampMinCgroups().empty() && config.getUclampMaxCgroups().empty())
+    {
+        uclamp.reset();
+        return;
+    }
+
+    if (!uclamp || !uclamp->initialize(config.getUclampMinCgroups(), config.getUclampMin(),
+                                       config.getUclampMaxCgroups(), config.getUclampMax()))
+    {
+        Logger::warning("uclamp cgroups are set but none of them has utilization clamps on this system - ignoring");
+        uclamp.reset();
+    }
+}
+
+void configureIdleInjection(std::unique_ptr<IIdleInjectionController>& idleInjection, const Config& config)
+{
+    auto powerLimit = config.getIdleInjectionPowerLimit();
+    auto thermalLimit = config.getIdleInjectionThermalLimit();
+    if (!powerLimit && !thermalLimit)
+    {
+        idleInjection.reset();
+        return;
+    }
+
+    if (!idleInjection || !idleInjection->initialize(powerLimit, thermalLimit, config.getIdleInjectionCgroups()))
+    {
+        Logger::warning("An idle injection budget is set but CPUs cannot be forced idle or the budget cannot be measured on this system - ignoring");
+        idleInjection.reset();
+    }
+}
+
+void configurePerfCounters(ActivityMonitor& activityMonitor, const Config& config)
+{
+    if (!config.getPerfCounters())
+    {
+        return;
+    }
+
+    auto sampler = PlatformFactory::createPerfSampler();
+    if (!sampler || !sampler->initialize())
+    {
+        Logger::warning("perf_counters is enabled but hardware performance counters are not available - tiers follow utilization only");
+        return;
+    }
+    activityMonitor.setPerfSampler(std::move(sampler), config.getMemoryBoundThreshold());
+}
+
+std::optional<WarmStartState> configureWarmStart(const WarmStartStore& warmStartStore, const IPowerManager& powerManager,
+                                                 ExternalChangeGuard& externalChangeGuard)
+{
+    std::optional<WarmStartState> previous = warmStartStore.load();
+    if (!previous)
+    {
+        return std::nullopt;
+    }
+
+    Logger::info("Previous run: " + previous->backend + " backend, tier " +
+                 (previous->tier ? powerTierToString(*previous->tier) : std::string("per domain")) + " (" +
+                 std::to_string(previous->runs) + " run(s), " + std::to_string(previous->actuation.total()) +
+                 " verified switch(es), " + std::to_string(previous->conflicts) + " external conflict(s))");
+    // Another backend applies other settings, so its tier says nothing about this one
+    if (previous->tier && previous->backend == powerManager.getBackendName())
+    {
+        externalChangeGuard.setWarmStartTier(*previous->tier);
+    }
+    return previous;
+}
+
+void saveWarmStart(const WarmStartStore& warmStartStore, const std::optional<WarmStartState>& previous,
+                   const IPowerManager& powerManager, const ExternalChangeGuard& externalChangeGuard)
+{
+    WarmStartState state;
+    state.backend = powerManager.getBackendName();
+    state.tier = externalChangeGuard.getTier();
+    state.actuation = powerManager.getActuationMetrics();
+    state.conflicts = externalChangeGuard.getConflicts();
+    state.runs = 1;
+    // The counters accumulate while the backend stays the same
+    if (previous && previous->backend == state.backend)
+    {
+        state.runs += previous->runs;
+        state.actuation.succeeded += previous->actuation.succeeded;
+        state.actuation.partial += previous->actuation.partial;
+        state.actuation.failed += previous->actuation.failed;
+        state.conflicts += previous->conflicts;
+    }
+    warmStartStore.save(state);
+}
+
+bool configureKnobProfiles(std::unique_ptr<IKnobManager>& knobManager, const Config& config)
+{
+    const KnobProfiles& profiles = config.getKnobProfiles();
+    bool hasKnobs = std::any_of(profiles.begin(), profiles.end(), [](const auto& tier) { return !tier.empty(); });
+    if (!hasKnobs)
+    {
+        knobManager.reset();
+        return true;
+    }
+
+    if (!knobManager)
+    {
+        Logger::warning("Knob profiles are configured but not supported on this platform - ignoring");
+        return true;
+    }
+
+    if (!knobManager->load(profiles))
+    {
+        Logger::error("Failed to load knob profiles");
+        std::cerr << "Failed to load knob profiles - check the knob.* entries in the configuration" << std::endl;
+        return false;
+    }
+    return true;
 }
 
 bool validatePowerManagement(const std::unique_ptr<IPowerManager>& powerManager)
@@ -74,6 +413,7 @@ void configureMonitoring(ActivityMonitor& activityMonitor, const Config& config)
     Logger::info("Configuring activity monitor...");
     activityMonitor.setLoadThresholds(config.getHighPerformanceThreshold(), config.getPowerSaveThreshold());
     activityMonitor.setMonitoringFrequency(config.getMonitoringFrequency());
+    activityMonitor.setSchedule(config.getSchedule());
 
     Logger::info("High performance threshold: " + std::to_string(config.getHighPerformanceThreshold()));
     Logger::info("Power save threshold: " + std::to_string(config.getPowerSaveThreshold()));
@@ -164,15 +504,82 @@ int main(int argc, char* argv[])
     Logger::info("Configuration loaded successfully");
 
     ActivityMonitor activityMonitor;
-    auto powerManager = PlatformFactory::createPowerManager();
+    std::filesystem::path backendCache = std::filesystem::path(platformUtils->getDefaultStateDirectory()) / "power_backend.cache";
+    auto powerManager = PlatformFactory::createPowerManager(config.getPowerBackendOrder(), backendCache.string());
 
     if (!validatePowerManagement(powerManager))
     {
         return 1;
     }
 
+    auto knobManager = PlatformFactory::createKnobManager();
+    if (!configureKnobProfiles(knobManager, config))
+    {
+        return 1;
+    }
+
+    auto frequencyController = PlatformFactory::createFrequencyController();
+    configureFrequencyController(frequencyController, config);
+
+    auto turboController = PlatformFactory::createTurboController();
+    configureTurboController(turboController, config);
+
+    // The controllers move these settings between tier switches, which is not an external change
+    std::vector<std::string> controlledSettings;
+    if (frequencyController)
+    {
+        controlledSettings = frequencyController->getControlledAttributes();
+    }
+    if (turboController)
+    {
+        auto switches = turboController->getControlledAttributes();
+        controlledSettings.insert(controlledSettings.end(), switches.begin(), switches.end());
+    }
+    powerManager->ignoreExternalChanges(controlledSettings);
+
+    auto smtController = PlatformFactory::createSmtController();
+    configureSmtController(smtController, config);
+
+    auto cpuParking = PlatformFactory::createCpuParkingController();
+    configureCpuParking(cpuParking, config);
+
+    auto pmQosController = PlatformFactory::createPmQosController();
+    configurePmQos(pmQosController, config);
+
+    auto irqAffinity = PlatformFactory::createIrqAffinityController();
+    configureIrqAffinity(irqAffinity, config);
+
+    auto cpuset = PlatformFactory::createCpusetController();
+    configureCpuset(cpuset, config, activityMonitor.getCpuTopology());
+
+    auto uclamp = PlatformFactory::createUclampController();
+    configureUclamp(uclamp, config);
+
+    auto idleInjection = PlatformFactory::createIdleInjectionController();
+    configureIdleInjection(idleInjection, config);
+
     configureMonitoring(activityMonitor, config);
-    configurePowerManagement(activityMonitor, powerManager);
+    configurePerfCounters(activityMonitor, config);
+    activityMonitor.setSleepMonitor(PlatformFactory::createSleepMonitor());
+    if (config.getControlDomainScope() != ControlDomainScope::SYSTEM)
+    {
+        if (powerManager->supportsControlDomains())
+        {
+            activityMonitor.setControlDomainScope(config.getControlDomainScope());
+        }
+        else
+        {
+            Logger::warning("control_domains=" + controlDomainScopeToString(config.getControlDomainScope()) +
+                            " is not supported by the " + powerManager->getBackendName() +
+                            " backend - using system-wide control");
+        }
+    }
+    ExternalChangeGuard externalChangeGuard(*powerManager, config.getExternalChangePolicy());
+    WarmStartStore warmStartStore((std::filesystem::path(platformUtils->getDefaultStateDirectory()) / "warm_start.state").string());
+    std::optional<WarmStartState> previousRun = configureWarmStart(warmStartStore, *powerManager, externalChangeGuard);
+    configurePowerManagement(activityMonitor, knobManager, frequencyController, turboController,
+                             smtController, cpuParking, pmQosController, irqAffinity, cpuset,
+                             uclamp, idleInjection, externalChangeGuard);
 
     if (!activityMonitor.start())
     {
@@ -202,6 +609,60 @@ int main(int argc, char* argv[])
     try
     {
         activityMonitor.stop();
+        if (idleInjection)
+        {
+            idleInjection->restore();
+        }
+        if (irqAffinity)
+        {
+            irqAffinity->restore();
+        }
+        if (pmQosController)
+        {
+            pmQosController->release();
+        }
+        if (uclamp)
+        {
+            uclamp->restore();
+        }
+        if (cpuset)
+        {
+            cpuset->restore();
+        }
+        if (cpuParking)
+        {
+            cpuParking->restore();
+        }
+        if (smtController)
+        {
+            smtController->restore();
+        }
+        if (turboController)
+        {
+            turboController->restore();
+        }
+        if (frequencyController)
+        {
+            frequencyController->restore();
+        }
+        if (knobManager)
+        {
+            knobManager->restore();
+        }
+
+        ActuationMetrics actuation = powerManager->getActuationMetrics();
+        if (actuation.total() > 0)
+        {
+            Logger::info("Verified " + powerManager->getBackendName() + " switches: " + std::to_string(actuation.succeeded) +
+                         " succeeded, " + std::to_string(actuation.partial) + " partial, " +
+                         std::to_string(actuation.failed) + " failed");
+        }
+        if (externalChangeGuard.getConflicts() > 0)
+        {
+            Logger::info("External power-setting conflicts: " + std::to_string(externalChangeGuard.getConflicts()) +
+                         " (policy " + externalChangePolicyToString(config.getExternalChangePolicy()) + ")");
+        }
+        saveWarmStart(warmStartStore, previousRun, *powerManager, externalChangeGuard);
     }
     catch (const std::exception& e)
     {
@@ -0,0 +1,38 @@
+#include "pi_controller.h"
+#include <algorithm>
+#include <cmath>
+
+PiController::PiController(const PiControllerSettings& settings, double initialOutput)
+    : m_settings{settings}
+    , m_integral{0.0}
+    , m_output{0.0}
+{
+    reset(initialOutput);
+}
+
+double PiController::update(double setpoint, double measurement)
+{
+    double error = measurement - setpoint;
+    if (std::abs(error) < m_settings.deadband)
+    {
+        error = 0.0;
+    }
+
+    m_integral = clamp(m_integral + m_settings.ki * error);
+    double target = clamp(m_integral + m_settings.kp * error);
+
+    // Limit the slew so one noisy sample cannot swing the output across its range
+    m_output = std::clamp(target, m_output - m_settings.maxStep, m_output + m_settings.maxStep);
+    return m_output;
+}
+
+void PiController::reset(double output)
+{
+    m_output = clamp(output);
+    m_integral = m_output;
+}
+
+double PiController::clamp(double value) const
+{
+    return std::clamp(value, m_settings.outputMin, m_settings.outputMax);
+}
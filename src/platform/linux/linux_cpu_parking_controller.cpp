@@ -0,0 +1,127 @@
+#include "platform/icpu_parking_controller.h"
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Linux core parking through /sys/devices/system/cpu/cpuN/online
+ * Only CPUs that were online at startup are parked, so CPUs an administrator
+ * took offline stay offline on restore
+ */
+class LinuxCpuParkingController : public ICpuParkingController
+{
+public:
+    explicit LinuxCpuParkingController(const std::string& cpuSysfsRoot)
+        : m_cpuRoot{cpuSysfsRoot}
+    {
+    }
+
+    virtual ~LinuxCpuParkingController() override = default;
+
+    bool initialize(const std::vector<int>& cpus) override
+    {
+        m_cpus.clear();
+        m_parked.clear();
+        for (int cpu : cpus)
+        {
+            // The boot CPU usually has no online attribute and cannot be taken down
+            auto online = LinuxSysfs::readAttribute(onlinePath(cpu));
+            if (cpu <= 0 || !online)
+            {
+                Logger::warning("CPU " + std::to_string(cpu) + " does not support hotplug - not parking it");
+                continue;
+            }
+            if (*online != "1")
+            {
+                Logger::info("CPU " + std::to_string(cpu) + " is already offline - not parking it");
+                continue;
+            }
+            m_cpus.push_back(cpu);
+        }
+
+        if (m_cpus.empty())
+        {
+            return false;
+        }
+        Logger::info("CPU parking: " + std::to_string(m_cpus.size()) + " CPU(s) go offline in the power save tier");
+        return true;
+    }
+
+    void setTier(PowerTier tier) override
+    {
+        if (tier != PowerTier::POWER_SAVE)
+        {
+            unpark();
+            return;
+        }
+
+        int parked = 0;
+        for (int cpu : m_cpus)
+        {
+            if (std::find(m_parked.begin(), m_parked.end(), cpu) != m_parked.end())
+            {
+                continue;
+            }
+            if (LinuxSysfs::writeAttribute(onlinePath(cpu), "0"))
+            {
+                m_parked.push_back(cpu);
+                ++parked;
+            }
+            else
+            {
+                // The kernel refuses when the CPU is the last one of its kind or holds pinned work
+                Logger::warning("Failed to park CPU " + std::to_string(cpu));
+            }
+        }
+        if (parked > 0)
+        {
+            Logger::info("Parked " + std::to_string(parked) + " CPU(s)");
+        }
+    }
+
+    void unpark() override
+    {
+        if (m_parked.empty())
+        {
+            return;
+        }
+
+        std::vector<int> stillParked;
+        for (int cpu : m_parked)
+        {
+            if (!LinuxSysfs::writeAttribute(onlinePath(cpu), "1"))
+            {
+                Logger::error("Failed to bring CPU " + std::to_string(cpu) + " back online");
+                stillParked.push_back(cpu);
+            }
+        }
+        Logger::info("Unparked " + std::to_string(m_parked.size() - stillParked.size()) + " CPU(s)");
+        m_parked = std::move(stillParked);
+    }
+
+    bool restore() override
+    {
+        unpark();
+        return m_parked.empty();
+    }
+
+private:
+    std::string onlinePath(int cpu) const
+    {
+        return m_cpuRoot + "/cpu" + std::to_string(cpu) + "/online";
+    }
+
+    std::string m_cpuRoot;
+    std::vector<int> m_cpus;        ///< CPUs eligible for parking
+    std::vector<int> m_parked;      ///< CPUs this controller took offline
+};
+
+// Factory function for creating the Linux CPU parking controller
+std::unique_ptr<ICpuParkingController> createLinuxCpuParkingController(const std::string& cpuSysfsRoot)
+{
+    return std::make_unique<LinuxCpuParkingController>(cpuSysfsRoot);
+}
@@ -0,0 +1,153 @@
+#include "platform/icpuset_controller.h"
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+/**
+ * Linux cpuset confinement through cgroup v2 cpuset.cpus
+ * Each cgroup is changed with a single write, read back and put back to its
+ * original list if the kernel did not take the new one, so a cgroup is either
+ * fully confined or untouched. An empty original list means "inherit from the
+ * parent" and is restored as such
+ */
+class LinuxCpusetController : public ICpusetController
+{
+public:
+    explicit LinuxCpusetController(const std::string& cgroupRoot)
+        : m_cgroupRoot{cgroupRoot}
+    {
+    }
+
+    virtual ~LinuxCpusetController() override = default;
+
+    bool initialize(const std::vector<std::string>& cgroups, const std::vector<int>& cpus) override
+    {
+        m_original.clear();
+        m_confined.clear();
+        m_cpus = cpus;
+        m_target.clear();
+        for (int cpu : cpus)
+        {
+            m_target += (m_target.empty() ? "" : ",") + std::to_string(cpu);
+        }
+
+        for (const auto& cgroup : cgroups)
+        {
+            // cpuset.cpus only exists once the parent enables the cpuset controller
+            auto original = LinuxSysfs::readAttribute(cpusPath(cgroup));
+            if (!original)
+            {
+                Logger::warning("cgroup " + cgroup + " has no cpuset.cpus (cpuset controller not enabled for it) - not confining it");
+                continue;
+            }
+            m_original[cgroup] = *original;
+        }
+
+        if (m_original.empty() || m_cpus.empty())
+        {
+            return false;
+        }
+        Logger::info("cpuset: " + std::to_string(m_original.size()) + " cgroup(s) confined to CPUs " + m_target +
+                     " in the power save tier");
+        return true;
+    }
+
+    void setTier(PowerTier tier) override
+    {
+        if (tier != PowerTier::POWER_SAVE)
+        {
+            restore();
+            return;
+        }
+
+        for (const auto& [cgroup, original] : m_original)
+        {
+            if (m_confined.contains(cgroup))
+            {
+                continue;
+            }
+            if (writeCpus(cgroup, m_target, m_cpus))
+            {
+                m_confined.insert(cgroup);
+                Logger::debug("Confined cgroup " + cgroup + " to CPUs " + m_target);
+            }
+            else
+            {
+                Logger::warning("Failed to confine cgroup " + cgroup + " to CPUs " + m_target + " - left unchanged");
+            }
+        }
+    }
+
+    bool restore() override
+    {
+        bool success = true;
+        for (auto it = m_confined.begin(); it != m_confined.end();)
+        {
+            const std::string& original = m_original[*it];
+            if (writeCpus(*it, original, LinuxSysfs::parseCpuList(original)))
+            {
+                Logger::debug("Released cgroup " + *it);
+                it = m_confined.erase(it);
+            }
+            else
+            {
+                Logger::error("Failed to restore cgroup " + *it + " cpuset.cpus to '" + original + "'");
+                success = false;
+                ++it;
+            }
+        }
+        return success;
+    }
+
+private:
+    std::string cpusPath(const std::string& cgroup) const
+    {
+        return m_cgroupRoot + "/" + cgroup + "/cpuset.cpus";
+    }
+
+    /**
+     * Write a CPU list and confirm the kernel kept it, putting the previous list back otherwise
+     * @return true if the cgroup now holds exactly the requested CPUs
+     */
+    bool writeCpus(const std::string& cgroup, const std::string& list, const std::vector<int>& expected)
+    {
+        std::string path = cpusPath(cgroup);
+        auto previous = LinuxSysfs::readAttribute(path);
+        if (!previous)
+        {
+            return false;
+        }
+
+        // A lone newline clears the list; an empty write would not reach the kernel
+        if (!LinuxSysfs::writeAttribute(path, list.empty() ? "\n" : list))
+        {
+            return false;
+        }
+
+        // The kernel reformats the list (0,1,2 reads back as 0-2), so compare CPUs
+        auto current = LinuxSysfs::readAttribute(path);
+        if (current && LinuxSysfs::parseCpuList(*current) == expected)
+        {
+            return true;
+        }
+        LinuxSysfs::writeAttribute(path, previous->empty() ? "\n" : *previous);
+        return false;
+    }
+
+    std::string m_cgroupRoot;
+    std::vector<int> m_cpus;
+    std::string m_target;                       ///< confinement CPU list as written to cpuset.cpus
+    std::map<std::string, std::string> m_original;  ///< cpuset.cpus before the daemon touched it
+    std::set<std::string> m_confined;
+};
+
+// Factory function for creating the Linux cpuset controller
+std::unique_ptr<ICpusetController> createLinuxCpusetController(const std::string& cgroupRoot)
+{
+    return std::make_unique<LinuxCpusetController>(cgroupRoot);
+}
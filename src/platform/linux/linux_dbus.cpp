@@ -0,0 +1,648 @@
+#include "platform/linux/linux_dbus.h"
+#include "logger.h"
+#include <chrono>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+    constexpr uint8_t FIELD_PATH = 1;
+    constexpr uint8_t FIELD_INTERFACE = 2;
+    constexpr uint8_t FIELD_MEMBER = 3;
+    constexpr uint8_t FIELD_ERROR_NAME = 4;
+    constexpr uint8_t FIELD_REPLY_SERIAL = 5;
+    constexpr uint8_t FIELD_DESTINATION = 6;
+    constexpr uint8_t FIELD_SENDER = 7;
+    constexpr uint8_t FIELD_SIGNATURE = 8;
+
+    // The specification limits messages to 128 MiB
+    constexpr size_t MAX_MESSAGE_SIZE = 128U * 1024U * 1024U;
+    constexpr size_t FIXED_HEADER_SIZE = 16;
+
+    uint32_t decodeUint32(const std::vector<uint8_t>& data, size_t offset, bool bigEndian)
+    {
+        uint32_t value = 0;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            size_t shift = bigEndian ? (3 - i) * 8 : i * 8;
+            value |= static_cast<uint32_t>(data[offset + i]) << shift;
+        }
+        return value;
+    }
+
+    void writeStringField(DBusWriter& writer, uint8_t code, const char* signature, const std::string& value)
+    {
+        if (value.empty())
+        {
+            return;
+        }
+        writer.align(8);
+        writer.writeByte(code);
+        writer.writeSignature(signature);
+        if (std::strcmp(signature, "g") == 0)
+        {
+            writer.writeSignature(value);
+        }
+        else
+        {
+            writer.writeString(value);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// DBusWriter
+// ---------------------------------------------------------------------------
+
+void DBusWriter::align(size_t boundary)
+{
+    while (m_data.size() % boundary != 0)
+    {
+        m_data.push_back(0);
+    }
+}
+
+void DBusWriter::writeByte(uint8_t value)
+{
+    m_data.push_back(value);
+}
+
+void DBusWriter::writeUint32(uint32_t value)
+{
+    align(4);
+    for (int i = 0; i < 4; ++i)
+    {
+        m_data.push_back(static_cast<uint8_t>((value >> (i * 8)) & 0xFF));
+    }
+}
+
+void DBusWriter::writeString(const std::string& value)
+{
+    writeUint32(static_cast<uint32_t>(value.size()));
+    m_data.insert(m_data.end(), value.begin(), value.end());
+    m_data.push_back(0);
+}
+
+void DBusWriter::writeSignature(const std::string& value)
+{
+    writeByte(static_cast<uint8_t>(value.size()));
+    m_data.insert(m_data.end(), value.begin(), value.end());
+    m_data.push_back(0);
+}
+
+void DBusWriter::writeVariantString(const std::string& value)
+{
+    writeSignature("s");
+    writeString(value);
+}
+
+// ---------------------------------------------------------------------------
+// DBusReader
+// ---------------------------------------------------------------------------
+
+DBusReader::DBusReader(const std::vector<uint8_t>& data, size_t offset, bool bigEndian)
+    : m_data{data}
+    , m_offset{offset}
+    , m_bigEndian{bigEndian}
+{
+}
+
+bool DBusReader::align(size_t boundary)
+{
+    size_t aligned = (m_offset + boundary - 1) / boundary * boundary;
+    if (aligned > m_data.size())
+    {
+        return false;
+    }
+    m_offset = aligned;
+    return true;
+}
+
+bool DBusReader::readByte(uint8_t& value)
+{
+    if (m_offset >= m_data.size())
+    {
+        return false;
+    }
+    value = m_data[m_offset++];
+    return true;
+}
+
+bool DBusReader::readUint32(uint32_t& value)
+{
+    if (!align(4) || m_offset + 4 > m_data.size())
+    {
+        return false;
+    }
+    value = decodeUint32(m_data, m_offset, m_bigEndian);
+    m_offset += 4;
+    return true;
+}
+
+bool DBusReader::readString(std::string& value)
+{
+    uint32_t length = 0;
+    if (!readUint32(length) || m_offset + length + 1 > m_data.size())
+    {
+        return false;
+    }
+    value.assign(reinterpret_cast<const char*>(m_data.data() + m_offset), length);
+    m_offset += length + 1;
+    return true;
+}
+
+bool DBusReader::readSignature(std::string& value)
+{
+    uint8_t length = 0;
+    if (!readByte(length) || m_offset + length + 1 > m_data.size())
+    {
+        return false;
+    }
+    value.assign(reinterpret_cast<const char*>(m_data.data() + m_offset), length);
+    m_offset += static_cast<size_t>(length) + 1;
+    return true;
+}
+
+bool DBusReader::readVariant(std::string& value)
+{
+    std::string signature;
+    if (!readSignature(signature))
+    {
+        return false;
+    }
+
+    if (signature == "s" || signature == "o")
+    {
+        return readString(value);
+    }
+    if (signature == "g")
+    {
+        return readSignature(value);
+    }
+    if (signature == "u" || signature == "b")
+    {
+        uint32_t number = 0;
+        if (!readUint32(number))
+        {
+            return false;
+        }
+        value = std::to_string(number);
+        return true;
+    }
+    if (signature == "i")
+    {
+        uint32_t number = 0;
+        if (!readUint32(number))
+        {
+            return false;
+        }
+        value = std::to_string(static_cast<int32_t>(number));
+        return true;
+    }
+    if (signature == "y")
+    {
+        uint8_t number = 0;
+        if (!readByte(number))
+        {
+            return false;
+        }
+        value = std::to_string(number);
+        return true;
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// DBusMessage
+// ---------------------------------------------------------------------------
+
+std::vector<uint8_t> DBusMessage::serialize() const
+{
+    DBusWriter writer;
+    writer.writeByte('l');
+    writer.writeByte(type);
+    writer.writeByte(flags);
+    writer.writeByte(1);
+    writer.writeUint32(static_cast<uint32_t>(body.size()));
+    writer.writeUint32(serial);
+    writer.writeUint32(0);  // header field array length, patched below
+
+    size_t fieldsStart = writer.data().size();
+    writeStringField(writer, FIELD_PATH, "o", path);
+    writeStringField(writer, FIELD_INTERFACE, "s", interface);
+    writeStringField(writer, FIELD_MEMBER, "s", member);
+    writeStringField(writer, FIELD_ERROR_NAME, "s", errorName);
+    if (replySerial != 0)
+    {
+        writer.align(8);
+        writer.writeByte(FIELD_REPLY_SERIAL);
+        writer.writeSignature("u");
+        writer.writeUint32(replySerial);
+    }
+    writeStringField(writer, FIELD_DESTINATION, "s", destination);
+    writeStringField(writer, FIELD_SENDER, "s", sender);
+    writeStringField(writer, FIELD_SIGNATURE, "g", signature);
+
+    uint32_t fieldsLength = static_cast<uint32_t>(writer.data().size() - fieldsStart);
+    for (size_t i = 0; i < 4; ++i)
+    {
+        writer.data()[12 + i] = static_cast<uint8_t>((fieldsLength >> (i * 8)) & 0xFF);
+    }
+
+    writer.align(8);
+    writer.data().insert(writer.data().end(), body.begin(), body.end());
+    return writer.data();
+}
+
+size_t DBusMessage::completeSize(const std::vector<uint8_t>& buffer)
+{
+    if (buffer.size() < FIXED_HEADER_SIZE)
+    {
+        return 0;
+    }
+
+    bool bigEndian = buffer[0] == 'B';
+    size_t bodyLength = decodeUint32(buffer, 4, bigEndian);
+    size_t fieldsLength = decodeUint32(buffer, 12, bigEndian);
+    size_t headerEnd = (FIXED_HEADER_SIZE + fieldsLength + 7) / 8 * 8;
+    size_t total = headerEnd + bodyLength;
+
+    if (total > MAX_MESSAGE_SIZE || buffer.size() < total)
+    {
+        return 0;
+    }
+    return total;
+}
+
+std::optional<DBusMessage> DBusMessage::parse(const std::vector<uint8_t>& buffer, size_t& consumed)
+{
+    size_t total = completeSize(buffer);
+    if (total == 0 || (buffer[0] != 'l' && buffer[0] != 'B') || buffer[3] != 1)
+    {
+        return std::nullopt;
+    }
+
+    DBusMessage message;
+    message.bigEndian = buffer[0] == 'B';
+    message.type = buffer[1];
+    message.flags = buffer[2];
+    message.serial = decodeUint32(buffer, 8, message.bigEndian);
+
+    size_t fieldsEnd = FIXED_HEADER_SIZE + decodeUint32(buffer, 12, message.bigEndian);
+    // Only this message's bytes: a field must not run into the next message in the buffer
+    std::vector<uint8_t> data(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(total));
+    DBusReader reader(data, FIXED_HEADER_SIZE, message.bigEndian);
+
+    while (reader.offset() < fieldsEnd)
+    {
+        uint8_t code = 0;
+        if (!reader.align(8) || !reader.readByte(code))
+        {
+            return std::nullopt;
+        }
+
+        // The specification types REPLY_SERIAL as UINT32
+        if (code == FIELD_REPLY_SERIAL)
+        {
+            std::string signature;
+            if (!reader.readSignature(signature) || signature != "u" || !reader.readUint32(message.replySerial))
+            {
+                return std::nullopt;
+            }
+            continue;
+        }
+
+        std::string value;
+        if (!reader.readVariant(value))
+        {
+            return std::nullopt;
+        }
+
+        switch (code)
+        {
+            case FIELD_PATH:        message.path = value; break;
+            case FIELD_INTERFACE:   message.interface = value; break;
+            case FIELD_MEMBER:      message.member = value; break;
+            case FIELD_ERROR_NAME:  message.errorName = value; break;
+            case FIELD_DESTINATION: message.destination = value; break;
+            case FIELD_SENDER:      message.sender = value; break;
+            case FIELD_SIGNATURE:   message.signature = value; break;
+            default:                break;  // Unknown fields must be ignored
+        }
+    }
+
+    size_t bodyStart = (fieldsEnd + 7) / 8 * 8;
+    message.body.assign(data.begin() + static_cast<std::ptrdiff_t>(bodyStart), data.end());
+    consumed = total;
+    return message;
+}
+
+// ---------------------------------------------------------------------------
+// DBusConnection
+// ---------------------------------------------------------------------------
+
+DBusConnection::DBusConnection(std::string address)
+    : m_address{std::move(address)}
+    , m_fd{-1}
+    , m_nextSerial{1}
+{
+}
+
+DBusConnection::~DBusConnection()
+{
+    disconnect();
+}
+
+std::string DBusConnection::systemBusAddress()
+{
+    const char* address = std::getenv("DBUS_SYSTEM_BUS_ADDRESS");
+    if (address && *address)
+    {
+        return address;
+    }
+    return "unix:path=/run/dbus/system_bus_socket";
+}
+
+bool DBusConnection::connect()
+{
+    if (isConnected())
+    {
+        return true;
+    }
+
+    // Use the first unix transport from a ';' separated address list
+    sockaddr_un socketAddress{};
+    socketAddress.sun_family = AF_UNIX;
+    socklen_t addressLength = 0;
+
+    std::istringstream addresses(m_address);
+    std::string entry;
+    while (addressLength == 0 && std::getline(addresses, entry, ';'))
+    {
+        if (!entry.starts_with("unix:"))
+        {
+            continue;
+        }
+
+        std::istringstream options(entry.substr(5));
+        std::string option;
+        while (std::getline(options, option, ','))
+        {
+            bool isPath = option.starts_with("path=");
+            bool isAbstract = option.starts_with("abstract=");
+            if (!isPath && !isAbstract)
+            {
+                continue;
+            }
+
+            std::string name = option.substr(isPath ? 5 : 9);
+            size_t offset = isAbstract ? 1 : 0;
+            if (name.empty() || name.size() + offset >= sizeof(socketAddress.sun_path))
+            {
+                continue;
+            }
+
+            std::memcpy(socketAddress.sun_path + offset, name.data(), name.size());
+            addressLength = static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + offset + name.size() + (isPath ? 1 : 0));
+            break;
+        }
+    }
+
+    if (addressLength == 0)
+    {
+        Logger::error("Unsupported D-Bus address: " + m_address);
+        return false;
+    }
+
+    m_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (m_fd < 0)
+    {
+        Logger::error("Failed to create D-Bus socket: " + std::string(std::strerror(errno)));
+        return false;
+    }
+
+    if (::connect(m_fd, reinterpret_cast<const sockaddr*>(&socketAddress), addressLength) != 0)
+    {
+        Logger::debug("Failed to connect to D-Bus at " + m_address + ": " + std::strerror(errno));
+        disconnect();
+        return false;
+    }
+
+    m_readBuffer.clear();
+    if (!authenticate())
+    {
+        Logger::error("D-Bus authentication failed at " + m_address);
+        disconnect();
+        return false;
+    }
+
+    DBusMessage hello;
+    hello.destination = "org.freedesktop.DBus";
+    hello.path = "/org/freedesktop/DBus";
+    hello.interface = "org.freedesktop.DBus";
+    hello.member = "Hello";
+
+    auto reply = call(hello);
+    if (!reply || reply->type != DBusMessage::METHOD_RETURN)
+    {
+        Logger::error("D-Bus Hello failed at " + m_address);
+        disconnect();
+        return false;
+    }
+
+    DBusReader reader = reply->bodyReader();
+    reader.readString(m_uniqueName);
+    Logger::debug("Connected to D-Bus at " + m_address + " as " + m_uniqueName);
+    return true;
+}
+
+void DBusConnection::disconnect()
+{
+    if (m_fd >= 0)
+    {
+        close(m_fd);
+        m_fd = -1;
+    }
+    m_readBuffer.clear();
+    m_uniqueName.clear();
+}
+
+std::optional<DBusMessage> DBusConnection::call(DBusMessage message, int timeoutMs)
+{
+    if (!isConnected())
+    {
+        return std::nullopt;
+    }
+
+    message.type = DBusMessage::METHOD_CALL;
+    message.serial = m_nextSerial++;
+    if (m_nextSerial == 0)
+    {
+        m_nextSerial = 1;  // Serial 0 is invalid
+    }
+
+    std::vector<uint8_t> wire = message.serialize();
+    if (!sendAll(wire.data(), wire.size()))
+    {
+        disconnect();
+        return std::nullopt;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (true)
+    {
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        if (remaining.count() <= 0)
+        {
+            Logger::warning("D-Bus call " + message.interface + "." + message.member + " timed out");
+            return std::nullopt;
+        }
+
+        auto reply = readMessage(static_cast<int>(remaining.count()));
+        if (!reply)
+        {
+            return std::nullopt;
+        }
+
+        if ((reply->type == DBusMessage::METHOD_RETURN || reply->type == DBusMessage::ERROR) &&
+            reply->replySerial == message.serial)
+        {
+            return reply;
+        }
+    }
+}
+
+bool DBusConnection::authenticate()
+{
+    // SASL EXTERNAL: the credential is the decimal uid, hex encoded
+    std::string uid = std::to_string(geteuid());
+    std::ostringstream hexUid;
+    for (char c : uid)
+    {
+        hexUid << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(static_cast<unsigned char>(c));
+    }
+
+    std::string request = std::string(1, '\0') + "AUTH EXTERNAL " + hexUid.str() + "\r\n";
+    if (!sendAll(request.data(), request.size()))
+    {
+        return false;
+    }
+
+    std::string response;
+    if (!readLine(response, 2000) || !response.starts_with("OK "))
+    {
+        return false;
+    }
+
+    const std::string begin = "BEGIN\r\n";
+    return sendAll(begin.data(), begin.size());
+}
+
+bool DBusConnection::sendAll(const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    while (size > 0)
+    {
+        ssize_t sent = send(m_fd, bytes, size, MSG_NOSIGNAL);
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            Logger::error("D-Bus send failed: " + std::string(std::strerror(errno)));
+            return false;
+        }
+        bytes += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+bool DBusConnection::readLine(std::string& line, int timeoutMs)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (true)
+    {
+        for (size_t i = 0; i + 1 < m_readBuffer.size(); ++i)
+        {
+            if (m_readBuffer[i] == '\r' && m_readBuffer[i + 1] == '\n')
+            {
+                line.assign(m_readBuffer.begin(), m_readBuffer.begin() + static_cast<std::ptrdiff_t>(i));
+                m_readBuffer.erase(m_readBuffer.begin(), m_readBuffer.begin() + static_cast<std::ptrdiff_t>(i + 2));
+                return true;
+            }
+        }
+
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        pollfd pfd{m_fd, POLLIN, 0};
+        if (remaining.count() <= 0 || poll(&pfd, 1, static_cast<int>(remaining.count())) <= 0)
+        {
+            return false;
+        }
+
+        uint8_t chunk[256];
+        ssize_t received = recv(m_fd, chunk, sizeof(chunk), 0);
+        if (received <= 0)
+        {
+            return false;
+        }
+        m_readBuffer.insert(m_readBuffer.end(), chunk, chunk + received);
+    }
+}
+
+std::optional<DBusMessage> DBusConnection::readMessage(int timeoutMs)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (true)
+    {
+        if (DBusMessage::completeSize(m_readBuffer) > 0)
+        {
+            size_t consumed = 0;
+            auto message = DBusMessage::parse(m_readBuffer, consumed);
+            if (!message)
+            {
+                Logger::error("Received malformed D-Bus message");
+                disconnect();
+                return std::nullopt;
+            }
+            m_readBuffer.erase(m_readBuffer.begin(), m_readBuffer.begin() + static_cast<std::ptrdiff_t>(consumed));
+            return message;
+        }
+
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        if (remaining.count() <= 0)
+        {
+            return std::nullopt;
+        }
+
+        pollfd pfd{m_fd, POLLIN, 0};
+        int ready = poll(&pfd, 1, static_cast<int>(remaining.count()));
+        if (ready < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (ready <= 0)
+        {
+            return std::nullopt;
+        }
+
+        uint8_t chunk[4096];
+        ssize_t received = recv(m_fd, chunk, sizeof(chunk), 0);
+        if (received <= 0)
+        {
+            Logger::warning("D-Bus connection closed by peer");
+            disconnect();
+            return std::nullopt;
+        }
+        m_readBuffer.insert(m_readBuffer.end(), chunk, chunk + received);
+    }
+}
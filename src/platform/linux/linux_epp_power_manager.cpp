@@ -0,0 +1,345 @@
+#include "platform/ipower_manager.h"
+#include "platform/linux/linux_package_control.h"
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_power_plan.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include "rate_limiter.h"
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Linux power manager for intel_pstate / amd-pstate in active mode
+ * Drives energy_performance_preference (and the intel_pstate perf ceiling) directly
+ * through sysfs instead of running TLP. min_perf_pct stays as the admin set it,
+ * since no tier needs a performance floor
+ */
+class LinuxEppPowerManager : public IPowerManager
+{
+public:
+    explicit LinuxEppPowerManager(const std::string& cpuSysfsRoot)
+        : m_cpuRoot{cpuSysfsRoot}
+        , m_driver{"none"}
+        , m_driverMode{"unknown"}
+        , m_uncore{cpuSysfsRoot}
+        , m_currentMode{"unknown"}
+        , m_rateLimiter(2, 60000)
+    {
+        // Rate limiter: max 2 power mode changes per 60000ms (60 seconds), same as the TLP backend
+        detectDriver();
+    }
+
+    virtual ~LinuxEppPowerManager() override = default;
+
+    /**
+     * Set system to performance tier (EPP performance)
+     * @return true if successful
+     */
+    bool setPerformanceMode() override
+    {
+        return setTier(PowerTier::PERFORMANCE);
+    }
+
+    /**
+     * Set system to power saving tier (EPP power)
+     * @return true if successful
+     */
+    bool setPowerSavingMode() override
+    {
+        return setTier(PowerTier::POWER_SAVE);
+    }
+
+    /**
+     * Apply a tier by writing only the attributes whose value changes
+     * @param tier requested tier
+     * @return true if every required attribute was written
+     */
+    bool setTier(PowerTier tier) override
+    {
+        const TierSettings& settings = TIER_SETTINGS[static_cast<size_t>(tier)];
+        PowerPlan plan = buildPlan(settings);
+        if (isAvailable() && m_planExecutor.isApplied(plan))
+        {
+            m_currentMode = isPerformanceTier(tier) ? "performance" : "powersaving";
+            return true;  // Already in the requested tier
+        }
+
+        // Rate limiting check
+        if (!m_rateLimiter.isAllowed("power_mode_change")) {
+            Logger::warning("Power mode change request rate limited - ignoring request");
+            return false;
+        }
+
+        if (!isAvailable())
+        {
+            Logger::error("EPP backend not available (driver: " + m_driver + ", mode: " + m_driverMode + ")");
+            return false;
+        }
+
+        PowerPlanResult result = m_planExecutor.apply(plan);
+
+        if (!result.success)
+        {
+            m_actuation.record(ActuationOutcome::FAILED);
+            Logger::error("Failed to apply EPP tier " + powerTierToString(tier) +
+                          (result.rolledBack ? " - previous tier restored" : ""));
+            return false;
+        }
+        if (!verifyActuation(m_planExecutor, plan, m_actuation, "EPP tier " + powerTierToString(tier)))
+        {
+            return false;
+        }
+
+        m_currentMode = isPerformanceTier(tier) ? "performance" : "powersaving";
+        Logger::info("Applied EPP tier " + powerTierToString(tier) + " (" + std::to_string(result.written) +
+                     " attribute write(s))");
+        return true;
+    }
+
+    /**
+     * Check that every policy already holds the tier's governor and EPP
+     * The perf limits are only read, since the kernel may have clamped them
+     * @param tier tier applied last
+     * @return true if the tier is in effect
+     */
+    bool confirmTier(PowerTier tier) override
+    {
+        if (!isAvailable() || !m_planExecutor.adoptIfApplied(buildPlan(TIER_SETTINGS[static_cast<size_t>(tier)])))
+        {
+            return false;
+        }
+
+        m_currentMode = isPerformanceTier(tier) ? "performance" : "powersaving";
+        return true;
+    }
+
+    /**
+     * Get current mode from the first policy's energy_performance_preference
+     * @return "performance", "powersaving", or "unknown"
+     */
+    std::string getCurrentMode() override
+    {
+        if (m_policies.empty())
+        {
+            return m_currentMode;
+        }
+
+        auto epp = LinuxSysfs::readAttribute(m_policies.front() + "/energy_performance_preference");
+        if (epp)
+        {
+            m_currentMode = (*epp == "performance" || *epp == "balance_performance") ? "performance" : "powersaving";
+        }
+        return m_currentMode;
+    }
+
+    /**
+     * Check that a pstate driver runs in active mode with EPP exposed
+     * @return true if EPP control is possible
+     */
+    bool isAvailable() override
+    {
+        return m_driverMode == "active" && !m_policies.empty();
+    }
+
+    std::string getBackendName() const override
+    {
+        return "epp";
+    }
+
+    bool supportsControlDomains() const override
+    {
+        return true;
+    }
+
+    /**
+     * Apply a tier's EPP to the policies of one domain
+     * Package domains also get the package's uncore frequency limit. The
+     * intel_pstate perf limits are system wide and stay as they are
+     * @param domain a policy ("policy0") or package ("package1") domain
+     * @param tier requested tier
+     * @return true if every attribute was written
+     */
+    bool setDomainTier(const ControlDomain& domain, PowerTier tier) override
+    {
+        std::vector<std::string> policies = selectDomainPolicies(domain, m_policies, m_cpuRoot);
+        const TierSettings& settings = TIER_SETTINGS[static_cast<size_t>(tier)];
+        PowerPlan plan;
+        for (const auto& policy : policies)
+        {
+            plan.push_back({policy + "/scaling_governor", "powersave", "scaling_governor", 0, false});
+            plan.push_back({policy + "/energy_performance_preference", settings.epp, "energy_performance_preference", 1, false});
+        }
+        if (domain.scope == ControlDomainScope::PACKAGE)
+        {
+            PowerPlan uncore = m_uncore.buildPlan(domain.package, tier, 2);
+            plan.insert(plan.end(), uncore.begin(), uncore.end());
+        }
+        if (isAvailable() && !policies.empty() && m_planExecutor.isApplied(plan))
+        {
+            return true;  // Domain already in the requested tier
+        }
+
+        // Each domain has its own budget so one busy cluster cannot starve the others
+        if (!m_rateLimiter.isAllowed("domain_tier_change:" + domain.name)) {
+            Logger::warning("Tier change for domain " + domain.name + " rate limited - ignoring request");
+            return false;
+        }
+
+        if (!isAvailable() || policies.empty())
+        {
+            Logger::error("EPP backend cannot control domain " + domain.name);
+            return false;
+        }
+
+        PowerPlanResult result = m_planExecutor.apply(plan);
+        if (!result.success)
+        {
+            m_actuation.record(ActuationOutcome::FAILED);
+            Logger::error("Failed to apply EPP tier " + powerTierToString(tier) + " to " + domain.name);
+            return false;
+        }
+        if (!verifyActuation(m_planExecutor, plan, m_actuation, "EPP tier " + powerTierToString(tier) + " on " + domain.name))
+        {
+            return false;
+        }
+
+        Logger::info("Applied EPP tier " + powerTierToString(tier) + " to " + domain.name + " (" +
+                     std::to_string(result.written) + " attribute write(s))");
+        return true;
+    }
+
+    /**
+     * Write the first policy's current EPP back unchanged
+     * @return true if the attribute is writable
+     */
+    bool reapplyCurrentMode() override
+    {
+        if (!isAvailable())
+        {
+            return false;
+        }
+
+        std::string path = m_policies.front() + "/energy_performance_preference";
+        auto epp = LinuxSysfs::readAttribute(path);
+        return epp && LinuxSysfs::writeAttribute(path, *epp);
+    }
+
+    ActuationMetrics getActuationMetrics() const override
+    {
+        return m_actuation;
+    }
+
+    std::vector<ExternalChange> detectExternalChanges() override
+    {
+        return m_planExecutor.detectExternalChanges();
+    }
+
+    void ignoreExternalChanges(const std::vector<std::string>& settings) override
+    {
+        m_planExecutor.ignoreExternalChanges(settings);
+    }
+
+private:
+    struct TierSettings
+    {
+        const char* epp;
+        int maxPerfPct;
+    };
+
+    // Indexed by PowerTier
+    static constexpr std::array<TierSettings, 4> TIER_SETTINGS = {{
+        {"power", 70},
+        {"balance_power", 85},
+        {"balance_performance", 100},
+        {"performance", 100},
+    }};
+
+    static bool isPerformanceTier(PowerTier tier)
+    {
+        return tier == PowerTier::PERFORMANCE || tier == PowerTier::BALANCED_PERFORMANCE;
+    }
+
+    /**
+     * Detect the pstate driver and its operating mode
+     */
+    void detectDriver()
+    {
+        std::vector<std::string> policies = LinuxSysfs::listCpufreqPolicies(m_cpuRoot);
+        if (policies.empty())
+        {
+            Logger::debug("EPP backend: no cpufreq policies found under " + m_cpuRoot);
+            return;
+        }
+
+        m_driver = LinuxSysfs::readAttribute(policies.front() + "/scaling_driver").value_or("none");
+
+        if (m_driver == "intel_pstate")
+        {
+            m_driverMode = LinuxSysfs::readAttribute(m_cpuRoot + "/intel_pstate/status").value_or("active");
+            m_hasPerfPct = LinuxSysfs::exists(m_cpuRoot + "/intel_pstate/max_perf_pct");
+        }
+        else if (m_driver == "amd-pstate-epp" || m_driver == "amd-pstate")
+        {
+            m_driverMode = LinuxSysfs::readAttribute(m_cpuRoot + "/amd_pstate/status")
+                               .value_or(m_driver == "amd-pstate-epp" ? "active" : "passive");
+        }
+        else
+        {
+            m_driverMode = "unsupported";
+        }
+
+        for (const auto& policy : policies)
+        {
+            if (LinuxSysfs::exists(policy + "/energy_performance_preference"))
+            {
+                m_policies.push_back(policy);
+            }
+        }
+
+        Logger::debug("EPP backend: driver " + m_driver + ", mode " + m_driverMode + ", " +
+                      std::to_string(m_policies.size()) + " EPP-capable policies");
+    }
+
+    /**
+     * Build the attribute plan for a tier
+     * EPP can only be changed while the powersave governor is active in intel_pstate active mode,
+     * and the perf ceiling goes last. The kernel raises a ceiling below min_perf_pct to the
+     * minimum, so it is only read back
+     */
+    PowerPlan buildPlan(const TierSettings& settings)
+    {
+        PowerPlan plan;
+        for (const auto& policy : m_policies)
+        {
+            plan.push_back({policy + "/scaling_governor", "powersave", "scaling_governor", 0, false});
+            plan.push_back({policy + "/energy_performance_preference", settings.epp, "energy_performance_preference", 1, false});
+        }
+
+        if (m_hasPerfPct)
+        {
+            plan.push_back({m_cpuRoot + "/intel_pstate/max_perf_pct", std::to_string(settings.maxPerfPct),
+                            "max_perf_pct", 2, true});
+        }
+        return plan;
+    }
+
+    std::string m_cpuRoot;
+    std::string m_driver;
+    std::string m_driverMode;
+    bool m_hasPerfPct{false};
+    std::vector<std::string> m_policies;
+    LinuxUncoreFrequency m_uncore;
+    LinuxPowerPlanExecutor m_planExecutor;
+    std::string m_currentMode;
+    RateLimiter m_rateLimiter;
+    ActuationMetrics m_actuation;
+};
+
+// Factory function for creating the Linux EPP power manager
+std::unique_ptr<IPowerManager> createLinuxEppPowerManager(const std::string& cpuSysfsRoot)
+{
+    return std::make_unique<LinuxEppPowerManager>(cpuSysfsRoot);
+}
@@ -0,0 +1,411 @@
+#include "platform/ifrequency_controller.h"
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include "pi_controller.h"
+#include "rate_limiter.h"
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Linux frequency cap controller writing scaling_max_freq per cpufreq policy
+ * Policies covered by an energy model (debugfs or configuration) are capped at
+ * the cheapest operating point that meets the measured demand plus headroom;
+ * the others run a PI loop that steers their utilization towards the target
+ */
+class LinuxFrequencyController : public IFrequencyController
+{
+public:
+    LinuxFrequencyController(const std::string& cpuSysfsRoot, const std::string& energyModelRoot)
+        : m_cpuRoot{cpuSysfsRoot}
+        , m_energyModelRoot{energyModelRoot}
+        , m_targetUtilization{0.0}
+        , m_tier{PowerTier::POWER_SAVE}
+        , m_rateLimiter(MAX_WRITES_PER_MINUTE, 60000)
+    {
+        // Rate limiter: max 6 cap writes per policy per 60000ms (60 seconds)
+    }
+
+    virtual ~LinuxFrequencyController() override = default;
+
+    /**
+     * Read the frequency steps, current cap and energy model of every policy
+     * @param targetUtilization utilization to steer towards
+     * @param configuredModels tables from the configuration, preferred over debugfs
+     * @return false if no policy exposes a usable frequency range
+     */
+    bool initialize(double targetUtilization, const EnergyModelTables& configuredModels) override
+    {
+        m_targetUtilization = targetUtilization;
+        m_domains.clear();
+        std::vector<std::pair<std::vector<int>, std::vector<OperatingPoint>>> platformModels = readPlatformModels();
+        int modelled = 0;
+
+        for (const auto& policy : LinuxSysfs::listCpufreqPolicies(m_cpuRoot))
+        {
+            Domain domain;
+            domain.policy = policy;
+            domain.cpus = LinuxSysfs::readPolicyCpus(policy);
+            domain.frequencies = readFrequencies(policy);
+            auto original = LinuxSysfs::readAttribute(policy + "/scaling_max_freq");
+            if (domain.cpus.empty() || domain.frequencies.size() < 2 || !original)
+            {
+                Logger::debug("Frequency cap controller: " + policy + " has no usable frequency range - skipping");
+                continue;
+            }
+
+            domain.original = *original;
+            domain.current = *original;
+            PiControllerSettings settings;
+            settings.outputMin = static_cast<double>(domain.frequencies.front()) / static_cast<double>(domain.frequencies.back());
+            domain.controller = std::make_unique<PiController>(settings, 1.0);
+
+            // The table is built here, so each tick is a single lookup
+            for (const auto& [cpu, points] : configuredModels)
+            {
+                if (!domain.model && covers(domain.cpus, {cpu}))
+                {
+                    domain.model.emplace(points);
+                }
+            }
+            for (const auto& [cpus, points] : platformModels)
+            {
+                if (!domain.model && covers(domain.cpus, cpus))
+                {
+                    domain.model.emplace(points);
+                }
+            }
+            if (domain.model && domain.model->empty())
+            {
+                domain.model.reset();
+            }
+            modelled += domain.model ? 1 : 0;
+            m_domains.push_back(std::move(domain));
+        }
+
+        if (m_domains.empty())
+        {
+            return false;
+        }
+        Logger::info("Frequency cap controller: " + std::to_string(m_domains.size()) + " policy(s), " +
+                     std::to_string(modelled) + " with an energy model, target utilization " +
+                     std::to_string(static_cast<int>(m_targetUtilization * 100)) + "%");
+        return true;
+    }
+
+    /**
+     * Move every policy's cap one PI step towards its target
+     * Writes only happen when the cap lands on a different frequency step
+     * @param utilization busy fraction per CPU
+     */
+    void update(const std::vector<double>& utilization) override
+    {
+        for (auto& domain : m_domains)
+        {
+            // PI domains run uncapped in the performance tier
+            if (!domain.model && m_tier == PowerTier::PERFORMANCE)
+            {
+                continue;
+            }
+
+            double sum = 0.0;
+            int count = 0;
+            for (int cpu : domain.cpus)
+            {
+                if (cpu >= 0 && static_cast<size_t>(cpu) < utilization.size())
+                {
+                    sum += utilization[static_cast<size_t>(cpu)];
+                    ++count;
+                }
+            }
+            if (count == 0)
+            {
+                continue;
+            }
+
+            double busy = sum / count;
+            if (domain.model)
+            {
+                writeCap(domain, frequencyFor(domain, selectOperatingPoint(domain, busy)));
+                continue;
+            }
+            double fraction = domain.controller->update(m_targetUtilization, busy);
+            writeCap(domain, frequencyFor(domain, fraction));
+        }
+    }
+
+    /**
+     * Lift the PI domains' caps in the performance tier and resume control otherwise
+     * Energy model domains keep selecting, with performance headroom
+     * @param tier active tier
+     */
+    void setTier(PowerTier tier) override
+    {
+        bool lift = tier == PowerTier::PERFORMANCE;
+        bool lifted = m_tier == PowerTier::PERFORMANCE;
+        m_tier = tier;
+        if (lift == lifted)
+        {
+            return;
+        }
+
+        for (auto& domain : m_domains)
+        {
+            if (lift && !domain.model)
+            {
+                // Tier switches are already rate limited, so lifting is never held back
+                domain.controller->reset(1.0);
+                writeCap(domain, domain.frequencies.back(), true);
+            }
+        }
+        Logger::debug(std::string("Frequency cap controller ") + (lift ? "lifted PI caps" : "resumed PI control") +
+                      " for tier " + powerTierToString(tier));
+    }
+
+    /**
+     * Write back every policy's original scaling_max_freq
+     * @return true if every policy was restored
+     */
+    bool restore() override
+    {
+        bool success = true;
+        for (auto& domain : m_domains)
+        {
+            if (domain.current == domain.original)
+            {
+                continue;
+            }
+            if (LinuxSysfs::writeAttribute(domain.policy + "/scaling_max_freq", domain.original))
+            {
+                domain.current = domain.original;
+            }
+            else
+            {
+                Logger::error("Failed to restore scaling_max_freq of " + domain.policy + " to " + domain.original);
+                success = false;
+            }
+        }
+        return success;
+    }
+
+    size_t getDomainCount() const override
+    {
+        return m_domains.size();
+    }
+
+    std::vector<std::string> getControlledAttributes() const override
+    {
+        std::vector<std::string> paths;
+        for (const auto& domain : m_domains)
+        {
+            paths.push_back(domain.policy + "/scaling_max_freq");
+        }
+        return paths;
+    }
+
+private:
+    static constexpr int MAX_WRITES_PER_MINUTE = 6;
+    static constexpr int RANGE_STEP_KHZ = 100000;
+    static constexpr double PERFORMANCE_HEADROOM = 0.5;
+
+    struct Domain
+    {
+        std::string policy;
+        std::vector<int> cpus;
+        std::vector<int> frequencies;           ///< kHz, ascending
+        std::string original;                   ///< scaling_max_freq before the controller started
+        std::string current;                    ///< last value written or read
+        std::unique_ptr<PiController> controller;   ///< output is the cap as a fraction of the highest frequency
+        std::optional<EnergyModel> model;
+    };
+
+    /**
+     * Energy model selection for one policy
+     * Demand is the busy fraction scaled by the current cap, so it is expressed
+     * in work per time rather than relative to whatever frequency ran
+     * @return selected cap as a fraction of the policy's highest frequency
+     */
+    double selectOperatingPoint(const Domain& domain, double busy) const
+    {
+        double maxFrequency = static_cast<double>(domain.frequencies.back());
+        double currentFrequency = maxFrequency;
+        try
+        {
+            currentFrequency = std::stod(domain.current);
+        }
+        catch (const std::exception&)
+        {
+            // Unknown cap - assume uncapped
+        }
+
+        double headroom = 1.0 / m_targetUtilization - 1.0;
+        if (m_tier == PowerTier::PERFORMANCE)
+        {
+            headroom = std::max(headroom, PERFORMANCE_HEADROOM);
+        }
+        double demand = busy * currentFrequency * (1.0 + headroom);
+        const OperatingPoint& point = domain.model->select(demand / static_cast<double>(domain.model->getMaxFrequency()));
+        return static_cast<double>(point.frequencyKhz) / maxFrequency;
+    }
+
+    /**
+     * Check whether a policy holds any of the CPUs
+     */
+    static bool covers(const std::vector<int>& policyCpus, const std::vector<int>& cpus)
+    {
+        return std::any_of(cpus.begin(), cpus.end(), [&policyCpus](int cpu) {
+            return std::find(policyCpus.begin(), policyCpus.end(), cpu) != policyCpus.end();
+        });
+    }
+
+    /**
+     * Read the kernel energy model from debugfs
+     * Each performance domain directory lists its cpus and one ps:<frequency>
+     * directory per operating point with frequency, power and cost
+     * @return CPUs and operating points per performance domain
+     */
+    std::vector<std::pair<std::vector<int>, std::vector<OperatingPoint>>> readPlatformModels() const
+    {
+        std::vector<std::pair<std::vector<int>, std::vector<OperatingPoint>>> models;
+        std::error_code ec;
+        for (std::filesystem::directory_iterator it(m_energyModelRoot, ec), end; !ec && it != end; it.increment(ec))
+        {
+            // Device (GPU) performance domains have no cpus attribute
+            std::vector<int> cpus = LinuxSysfs::parseCpuList(LinuxSysfs::readAttribute(it->path().string() + "/cpus").value_or(""));
+            if (cpus.empty())
+            {
+                continue;
+            }
+
+            std::vector<OperatingPoint> points;
+            std::error_code stateError;
+            for (std::filesystem::directory_iterator state(it->path(), stateError), stateEnd; !stateError && state != stateEnd; state.increment(stateError))
+            {
+                if (!state->path().filename().string().starts_with("ps:"))
+                {
+                    continue;
+                }
+                std::string dir = state->path().string();
+                auto frequency = readInt(dir + "/frequency");
+                auto power = readInt(dir + "/power");
+                if (frequency && power)
+                {
+                    points.push_back({*frequency, static_cast<double>(*power), static_cast<double>(readInt(dir + "/cost").value_or(0))});
+                }
+            }
+
+            if (!points.empty())
+            {
+                Logger::debug("Energy model " + it->path().filename().string() + ": " + std::to_string(points.size()) + " operating point(s)");
+                models.emplace_back(std::move(cpus), std::move(points));
+            }
+        }
+        return models;
+    }
+
+    /**
+     * Frequency steps of a policy
+     * scaling_available_frequencies where the driver lists them (acpi-cpufreq),
+     * otherwise the cpuinfo range in 100 MHz steps (intel_pstate, amd-pstate, cppc)
+     */
+    static std::vector<int> readFrequencies(const std::string& policy)
+    {
+        std::vector<int> frequencies;
+        std::istringstream stream(LinuxSysfs::readAttribute(policy + "/scaling_available_frequencies").value_or(""));
+        int frequency;
+        while (stream >> frequency)
+        {
+            frequencies.push_back(frequency);
+        }
+
+        if (frequencies.empty())
+        {
+            auto minimum = readInt(policy + "/cpuinfo_min_freq");
+            auto maximum = readInt(policy + "/cpuinfo_max_freq");
+            if (minimum && maximum && *minimum < *maximum)
+            {
+                for (int step = *minimum; step < *maximum; step += RANGE_STEP_KHZ)
+                {
+                    frequencies.push_back(step);
+                }
+                frequencies.push_back(*maximum);
+            }
+        }
+
+        std::sort(frequencies.begin(), frequencies.end());
+        frequencies.erase(std::unique(frequencies.begin(), frequencies.end()), frequencies.end());
+        return frequencies;
+    }
+
+    static std::optional<int> readInt(const std::string& path)
+    {
+        auto value = LinuxSysfs::readAttribute(path);
+        if (!value)
+        {
+            return std::nullopt;
+        }
+        try
+        {
+            return std::stoi(*value);
+        }
+        catch (const std::exception&)
+        {
+            return std::nullopt;
+        }
+    }
+
+    /**
+     * Lowest frequency step that still provides the requested share of the maximum
+     * Rounding up keeps the cap from undercutting demand
+     */
+    static int frequencyFor(const Domain& domain, double fraction)
+    {
+        double wanted = fraction * static_cast<double>(domain.frequencies.back());
+        auto it = std::find_if(domain.frequencies.begin(), domain.frequencies.end(),
+                               [wanted](int frequency) { return static_cast<double>(frequency) >= wanted - 0.5; });
+        return it != domain.frequencies.end() ? *it : domain.frequencies.back();
+    }
+
+    void writeCap(Domain& domain, int frequency, bool force = false)
+    {
+        std::string value = std::to_string(frequency);
+        if (value == domain.current)
+        {
+            return;
+        }
+        if (!force && !m_rateLimiter.isAllowed(domain.policy))
+        {
+            Logger::debug("Frequency cap change for " + domain.policy + " rate limited");
+            return;
+        }
+
+        if (LinuxSysfs::writeAttribute(domain.policy + "/scaling_max_freq", value))
+        {
+            Logger::debug("Capped " + domain.policy + " at " + std::to_string(frequency / 1000) + " MHz");
+            domain.current = value;
+        }
+        else
+        {
+            Logger::warning("Failed to write scaling_max_freq " + value + " to " + domain.policy);
+        }
+    }
+
+    std::string m_cpuRoot;
+    std::string m_energyModelRoot;
+    double m_targetUtilization;
+    PowerTier m_tier;
+    std::vector<Domain> m_domains;
+    RateLimiter m_rateLimiter;
+};
+
+// Factory function for creating the Linux frequency cap controller
+std::unique_ptr<IFrequencyController> createLinuxFrequencyController(const std::string& cpuSysfsRoot,
+                                                                     const std::string& energyModelRoot)
+{
+    return std::make_unique<LinuxFrequencyController>(cpuSysfsRoot, energyModelRoot);
+}
@@ -0,0 +1,326 @@
+#include "platform/ipower_manager.h"
+#include "platform/linux/linux_package_control.h"
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_power_plan.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include "rate_limiter.h"
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Linux power manager driving the generic cpufreq scaling_governor
+ * Works with any cpufreq driver (acpi-cpufreq, cppc, intel_pstate passive, ...)
+ */
+class LinuxGovernorPowerManager : public IPowerManager
+{
+public:
+    explicit LinuxGovernorPowerManager(const std::string& cpuSysfsRoot)
+        : m_cpuRoot{cpuSysfsRoot}
+        , m_uncore{cpuSysfsRoot}
+        , m_currentMode{"unknown"}
+        , m_rateLimiter(2, 60000)
+    {
+        // Rate limiter: max 2 power mode changes per 60000ms (60 seconds), same as the TLP backend
+        detectGovernors();
+    }
+
+    virtual ~LinuxGovernorPowerManager() override = default;
+
+    /**
+     * Switch every policy to the performance governor
+     * @return true if successful
+     */
+    bool setPerformanceMode() override
+    {
+        return setTier(PowerTier::PERFORMANCE);
+    }
+
+    /**
+     * Switch every policy to the powersave governor
+     * @return true if successful
+     */
+    bool setPowerSavingMode() override
+    {
+        return setTier(PowerTier::POWER_SAVE);
+    }
+
+    /**
+     * Apply the governor for a tier to every policy whose governor differs
+     * @param tier requested tier
+     * @return true if every policy was switched
+     */
+    bool setTier(PowerTier tier) override
+    {
+        std::string governor = governorForTier(tier);
+        PowerPlan plan;
+        for (const auto& policy : m_policies)
+        {
+            plan.push_back({policy + "/scaling_governor", governor, "scaling_governor", 0, false});
+        }
+        if (isAvailable() && m_planExecutor.isApplied(plan))
+        {
+            m_currentMode = governorToMode(governor);
+            return true;  // Already in the requested tier
+        }
+
+        // Rate limiting check
+        if (!m_rateLimiter.isAllowed("power_mode_change")) {
+            Logger::warning("Power mode change request rate limited - ignoring request");
+            return false;
+        }
+
+        if (!isAvailable())
+        {
+            Logger::error("cpufreq governor backend not available");
+            return false;
+        }
+
+        PowerPlanResult result = m_planExecutor.apply(plan);
+        if (!result.success)
+        {
+            m_actuation.record(ActuationOutcome::FAILED);
+            Logger::error("Failed to apply governor tier " + powerTierToString(tier) +
+                          (result.rolledBack ? " - previous governors restored" : ""));
+            return false;
+        }
+        if (!verifyActuation(m_planExecutor, plan, m_actuation, "Governor tier " + powerTierToString(tier)))
+        {
+            return false;
+        }
+
+        m_currentMode = governorToMode(governor);
+        Logger::info("Applied governor " + governor + " for tier " + powerTierToString(tier) +
+                     " (" + std::to_string(result.written) + " policy write(s))");
+        return true;
+    }
+
+    /**
+     * Check that every policy already runs the tier's governor
+     * @param tier tier applied last
+     * @return true if the tier is in effect
+     */
+    bool confirmTier(PowerTier tier) override
+    {
+        if (!isAvailable())
+        {
+            return false;
+        }
+
+        std::string governor = governorForTier(tier);
+        PowerPlan plan;
+        for (const auto& policy : m_policies)
+        {
+            plan.push_back({policy + "/scaling_governor", governor, "scaling_governor", 0, false});
+        }
+        if (!m_planExecutor.adoptIfApplied(plan))
+        {
+            return false;
+        }
+
+        m_currentMode = governorToMode(governor);
+        return true;
+    }
+
+    /**
+     * Get current mode from the first policy's governor
+     * @return "performance", "powersaving", or "unknown"
+     */
+    std::string getCurrentMode() override
+    {
+        if (m_policies.empty())
+        {
+            return m_currentMode;
+        }
+
+        auto governor = LinuxSysfs::readAttribute(m_policies.front() + "/scaling_governor");
+        if (governor)
+        {
+            m_currentMode = governorToMode(*governor);
+        }
+        return m_currentMode;
+    }
+
+    /**
+     * Check that the performance and powersave governors are offered
+     * @return true if governor switching is possible
+     */
+    bool isAvailable() override
+    {
+        return !m_policies.empty() && hasGovernor("performance") && hasGovernor("powersave");
+    }
+
+    std::string getBackendName() const override
+    {
+        return "governor";
+    }
+
+    bool supportsControlDomains() const override
+    {
+        return true;
+    }
+
+    /**
+     * Apply the governor for a tier to the policies of one domain
+     * Package domains also get the package's uncore frequency limit
+     * @param domain a policy ("policy0") or package ("package1") domain
+     * @param tier requested tier
+     * @return true if every attribute was written
+     */
+    bool setDomainTier(const ControlDomain& domain, PowerTier tier) override
+    {
+        std::vector<std::string> policies = selectDomainPolicies(domain, m_policies, m_cpuRoot);
+        std::string governor = governorForTier(tier);
+        PowerPlan plan;
+        for (const auto& policy : policies)
+        {
+            plan.push_back({policy + "/scaling_governor", governor, "scaling_governor", 0, false});
+        }
+        if (domain.scope == ControlDomainScope::PACKAGE)
+        {
+            PowerPlan uncore = m_uncore.buildPlan(domain.package, tier, 1);
+            plan.insert(plan.end(), uncore.begin(), uncore.end());
+        }
+        if (isAvailable() && !policies.empty() && m_planExecutor.isApplied(plan))
+        {
+            return true;  // Domain already in the requested tier
+        }
+
+        // Each domain has its own budget so one busy cluster cannot starve the others
+        if (!m_rateLimiter.isAllowed("domain_tier_change:" + domain.name)) {
+            Logger::warning("Tier change for domain " + domain.name + " rate limited - ignoring request");
+            return false;
+        }
+
+        if (!isAvailable() || policies.empty())
+        {
+            Logger::error("cpufreq governor backend cannot control domain " + domain.name);
+            return false;
+        }
+
+        PowerPlanResult result = m_planExecutor.apply(plan);
+        if (!result.success)
+        {
+            m_actuation.record(ActuationOutcome::FAILED);
+            Logger::error("Failed to apply governor tier " + powerTierToString(tier) + " to " + domain.name);
+            return false;
+        }
+        if (!verifyActuation(m_planExecutor, plan, m_actuation, "Governor tier " + powerTierToString(tier) + " on " + domain.name))
+        {
+            return false;
+        }
+
+        Logger::info("Applied governor " + governor + " for tier " + powerTierToString(tier) + " to " + domain.name);
+        return true;
+    }
+
+    /**
+     * Write the first policy's current governor back unchanged
+     * @return true if the attribute is writable
+     */
+    bool reapplyCurrentMode() override
+    {
+        if (m_policies.empty())
+        {
+            return false;
+        }
+
+        std::string path = m_policies.front() + "/scaling_governor";
+        auto governor = LinuxSysfs::readAttribute(path);
+        return governor && LinuxSysfs::writeAttribute(path, *governor);
+    }
+
+    ActuationMetrics getActuationMetrics() const override
+    {
+        return m_actuation;
+    }
+
+    std::vector<ExternalChange> detectExternalChanges() override
+    {
+        return m_planExecutor.detectExternalChanges();
+    }
+
+    void ignoreExternalChanges(const std::vector<std::string>& settings) override
+    {
+        m_planExecutor.ignoreExternalChanges(settings);
+    }
+
+private:
+    /**
+     * Read the governors offered by the first policy
+     */
+    void detectGovernors()
+    {
+        m_policies = LinuxSysfs::listCpufreqPolicies(m_cpuRoot);
+        if (m_policies.empty())
+        {
+            Logger::debug("Governor backend: no cpufreq policies found under " + m_cpuRoot);
+            return;
+        }
+
+        std::istringstream stream(LinuxSysfs::readAttribute(m_policies.front() + "/scaling_available_governors").value_or(""));
+        std::string governor;
+        while (stream >> governor)
+        {
+            m_governors.push_back(governor);
+        }
+
+        // Dynamic governors for the balanced tiers, most capable first
+        for (const char* candidate : {"schedutil", "ondemand", "conservative"})
+        {
+            if (hasGovernor(candidate))
+            {
+                m_balancedGovernor = candidate;
+                break;
+            }
+        }
+
+        Logger::debug("Governor backend: " + std::to_string(m_policies.size()) + " policies, balanced governor " +
+                      (m_balancedGovernor.empty() ? std::string("none") : m_balancedGovernor));
+    }
+
+    bool hasGovernor(const std::string& governor) const
+    {
+        return std::find(m_governors.begin(), m_governors.end(), governor) != m_governors.end();
+    }
+
+    std::string governorForTier(PowerTier tier) const
+    {
+        switch (tier)
+        {
+            case PowerTier::PERFORMANCE:
+                return "performance";
+            case PowerTier::BALANCED_PERFORMANCE:
+                return m_balancedGovernor.empty() ? "performance" : m_balancedGovernor;
+            case PowerTier::BALANCED_POWER:
+                return m_balancedGovernor.empty() ? "powersave" : m_balancedGovernor;
+            case PowerTier::POWER_SAVE:
+            default:
+                return "powersave";
+        }
+    }
+
+    static std::string governorToMode(const std::string& governor)
+    {
+        return governor == "powersave" ? "powersaving" : "performance";
+    }
+
+    std::string m_cpuRoot;
+    std::vector<std::string> m_policies;
+    std::vector<std::string> m_governors;
+    std::string m_balancedGovernor;
+    LinuxUncoreFrequency m_uncore;
+    LinuxPowerPlanExecutor m_planExecutor;
+    std::string m_currentMode;
+    RateLimiter m_rateLimiter;
+    ActuationMetrics m_actuation;
+};
+
+// Factory function for creating the Linux cpufreq governor power manager
+std::unique_ptr<IPowerManager> createLinuxGovernorPowerManager(const std::string& cpuSysfsRoot)
+{
+    return std::make_unique<LinuxGovernorPowerManager>(cpuSysfsRoot);
+}
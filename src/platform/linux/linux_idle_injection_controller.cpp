@@ -0,0 +1,402 @@
+#include "platform/iidle_injection_controller.h"
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_sysfs.h"
+#include "pi_controller.h"
+#include "logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Linux idle injection
+ * intel_powerclamp exposes idle injection as a thermal cooling device whose
+ * cur_state is the forced idle percentage. Without it the configured cgroups
+ * are throttled through cpu.max, which idles the CPUs only as far as those
+ * cgroups were keeping them busy. The budget is package power from RAPL
+ * energy counters and/or the CPU temperature; a PI loop turns the relative
+ * overshoot into the injection level
+ */
+class LinuxIdleInjectionController : public IIdleInjectionController
+{
+public:
+    explicit LinuxIdleInjectionController(const std::string& rootPrefix)
+        : m_root{rootPrefix}
+        , m_cpuCount{1}
+        , m_maxInjection{0.0}
+        , m_controller{PiControllerSettings{}, 0.0}
+        , m_injection{0.0}
+        , m_observed{0.0}
+        , m_injected{0.0}
+        , m_delayInjecting{0.0}
+        , m_timeInjecting{0.0}
+        , m_delayFree{0.0}
+        , m_timeFree{0.0}
+    {
+    }
+
+    virtual ~LinuxIdleInjectionController() override = default;
+
+    bool initialize(std::optional<double> powerLimitWatts, std::optional<double> thermalLimit,
+                    const std::vector<std::string>& cgroups) override
+    {
+        m_powerLimit = powerLimitWatts;
+        m_thermalLimit = thermalLimit;
+
+        if (m_powerLimit)
+        {
+            m_raplZones = findRaplZones();
+            if (m_raplZones.empty())
+            {
+                Logger::warning("Idle injection: no RAPL energy counters to measure package power");
+                return false;
+            }
+        }
+        if (m_thermalLimit)
+        {
+            m_thermalZones = LinuxSysfs::findCpuThermalZones(m_root + "/sys/class/thermal");
+            if (m_thermalZones.empty())
+            {
+                Logger::warning("Idle injection: no thermal zone to measure the CPU temperature");
+                return false;
+            }
+        }
+
+        if (!findPowerclamp() && !findCgroups(cgroups))
+        {
+            return false;
+        }
+
+        // Gains stay below the defaults: injection shows up in power within a sample, but in temperature only slowly
+        PiControllerSettings settings;
+        settings.kp = 0.4;
+        settings.ki = 0.15;
+        settings.deadband = 0.02;
+        settings.outputMax = m_maxInjection;
+        settings.maxStep = 0.1;
+        m_controller = PiController(settings, 0.0);
+
+        std::string budget = m_powerLimit ? std::to_string(static_cast<int>(*m_powerLimit)) + " W" : "";
+        if (m_thermalLimit)
+        {
+            budget += (budget.empty() ? "" : ", ") + std::to_string(static_cast<int>(*m_thermalLimit)) + "C";
+        }
+        Logger::info("Idle injection: up to " + std::to_string(static_cast<int>(m_maxInjection * 100)) + "% through " +
+                     (m_powerclamp.empty() ? std::to_string(m_cpuMax.size()) + " cgroup cpu.max limit(s)" : "intel_powerclamp") +
+                     " to hold " + budget);
+        return true;
+    }
+
+    void update(std::chrono::steady_clock::time_point now) override
+    {
+        auto energy = readEnergy();
+        auto runDelay = readRunDelay();
+        if (m_lastSample)
+        {
+            double seconds = std::chrono::duration<double>(now - *m_lastSample).count();
+            if (seconds > 0.0)
+            {
+                accountRunDelay(runDelay, seconds);
+                m_observed += seconds;
+                m_injected += m_injection * seconds;
+
+                auto error = budgetError(energy, seconds);
+                if (error)
+                {
+                    apply(m_controller.update(0.0, *error));
+                }
+            }
+        }
+
+        m_lastSample = now;
+        m_lastEnergy = energy;
+        m_lastRunDelay = runDelay;
+    }
+
+    IdleInjectionMetrics getMetrics() const override
+    {
+        IdleInjectionMetrics metrics;
+        metrics.injection = m_injection;
+        metrics.averageInjection = m_observed > 0.0 ? m_injected / m_observed : 0.0;
+        metrics.runDelayInjecting = m_timeInjecting > 0.0 ? m_delayInjecting / m_timeInjecting : 0.0;
+        metrics.runDelayFree = m_timeFree > 0.0 ? m_delayFree / m_timeFree : 0.0;
+        return metrics;
+    }
+
+    bool restore() override
+    {
+        bool success = true;
+        if (!m_powerclamp.empty() && m_injection > 0.0 && !LinuxSysfs::writeAttribute(m_powerclamp + "/cur_state", "0"))
+        {
+            Logger::error("Failed to stop idle injection");
+            success = false;
+        }
+        for (const auto& [path, original] : m_cpuMax)
+        {
+            if (m_injection > 0.0 && !LinuxSysfs::writeAttribute(path, original))
+            {
+                Logger::error("Failed to restore " + path + " to " + original);
+                success = false;
+            }
+        }
+        m_injection = 0.0;
+        m_controller.reset(0.0);
+
+        IdleInjectionMetrics metrics = getMetrics();
+        if (m_observed > 0.0)
+        {
+            Logger::info("Idle injection: " + std::to_string(static_cast<int>(std::lround(metrics.averageInjection * 100))) +
+                         "% on average, run-queue delay " + formatDelay(metrics.runDelayInjecting) + " ms/s while injecting, " +
+                         formatDelay(metrics.runDelayFree) + " ms/s otherwise");
+        }
+        return success;
+    }
+
+private:
+    static constexpr int CPU_MAX_PERIOD_US = 100000;
+    static constexpr double CGROUP_MAX_INJECTION = 0.75;     ///< cgroups always keep a quarter of the machine
+    static constexpr double THERMAL_ERROR_SCALE = 10.0;     ///< degrees that count as a 100% overshoot
+
+    /**
+     * Top-level RAPL package zones (intel-rapl:N); subzones such as intel-rapl:0:0 are parts of a package
+     */
+    std::vector<std::string> findRaplZones() const
+    {
+        std::vector<std::string> zones;
+        std::error_code ec;
+        for (std::filesystem::directory_iterator it(m_root + "/sys/class/powercap", ec), end; !ec && it != end; it.increment(ec))
+        {
+            std::string name = it->path().filename().string();
+            if (name.starts_with("intel-rapl:") && std::count(name.begin(), name.end(), ':') == 1 &&
+                LinuxSysfs::exists(it->path().string() + "/energy_uj"))
+            {
+                zones.push_back(it->path().string());
+            }
+        }
+        return zones;
+    }
+
+    bool findPowerclamp()
+    {
+        std::error_code ec;
+        for (std::filesystem::directory_iterator it(m_root + "/sys/class/thermal", ec), end; !ec && it != end; it.increment(ec))
+        {
+            std::string device = it->path().string();
+            if (!it->path().filename().string().starts_with("cooling_device") ||
+                LinuxSysfs::readAttribute(device + "/type").value_or("") != "intel_powerclamp")
+            {
+                continue;
+            }
+            try
+            {
+                int maxState = std::stoi(LinuxSysfs::readAttribute(device + "/max_state").value_or(""));
+                if (maxState > 0)
+                {
+                    m_powerclamp = device;
+                    m_maxInjection = std::min(maxState, 100) / 100.0;
+                    return true;
+                }
+            }
+            catch (const std::exception&)
+            {
+                // Unreadable max_state; the device is unusable
+            }
+        }
+        return false;
+    }
+
+    bool findCgroups(const std::vector<std::string>& cgroups)
+    {
+        for (const auto& cgroup : cgroups)
+        {
+            std::string path = m_root + "/sys/fs/cgroup/" + cgroup + "/cpu.max";
+            auto original = LinuxSysfs::readAttribute(path);
+            if (!original || original->empty())
+            {
+                Logger::warning("cgroup " + cgroup + " has no cpu.max (cpu controller not enabled for it) - not throttling it");
+                continue;
+            }
+            m_cpuMax[path] = *original;
+        }
+        if (m_cpuMax.empty())
+        {
+            return false;
+        }
+
+        std::vector<int> online = LinuxSysfs::parseCpuList(
+            LinuxSysfs::readAttribute(m_root + "/sys/devices/system/cpu/online").value_or(""));
+        m_cpuCount = std::max<size_t>(online.size(), 1);
+        m_maxInjection = CGROUP_MAX_INJECTION;
+        return true;
+    }
+
+    /**
+     * Relative overshoot of the most violated budget: 0.1 is 10% over the power
+     * limit or one degree over the thermal limit, negative values are headroom
+     */
+    std::optional<double> budgetError(const std::optional<uint64_t>& energy, double seconds) const
+    {
+        std::optional<double> error;
+        // Counters wrap at max_energy_range_uj; the wrapped sample is skipped
+        if (m_powerLimit && energy && m_lastEnergy && *energy >= *m_lastEnergy)
+        {
+            double watts = static_cast<double>(*energy - *m_lastEnergy) / 1e6 / seconds;
+            error = (watts - *m_powerLimit) / *m_powerLimit;
+            Logger::debug("Package power " + std::to_string(watts) + " W");
+        }
+        if (m_thermalLimit)
+        {
+            if (auto temperature = LinuxSysfs::readHottestTemperature(m_thermalZones))
+            {
+                double thermalError = (*temperature - *m_thermalLimit) / THERMAL_ERROR_SCALE;
+                error = std::max(error.value_or(thermalError), thermalError);
+            }
+        }
+        return error;
+    }
+
+    void apply(double injection)
+    {
+        // Whole percent steps: powerclamp states are percentages and smaller cpu.max changes are noise
+        long percent = std::lround(injection * 100.0);
+        if (percent == std::lround(m_injection * 100.0))
+        {
+            return;
+        }
+        injection = static_cast<double>(percent) / 100.0;
+
+        bool success = true;
+        if (!m_powerclamp.empty())
+        {
+            success = LinuxSysfs::writeAttribute(m_powerclamp + "/cur_state", std::to_string(percent));
+        }
+        for (const auto& [path, original] : m_cpuMax)
+        {
+            long quota = std::lround((1.0 - injection) * CPU_MAX_PERIOD_US * static_cast<double>(m_cpuCount));
+            std::string value = percent > 0 ? std::to_string(quota) + " " + std::to_string(CPU_MAX_PERIOD_US) : original;
+            success = LinuxSysfs::writeAttribute(path, value) && success;
+        }
+
+        if (!success)
+        {
+            Logger::warning("Failed to set idle injection to " + std::to_string(percent) + "%");
+            return;
+        }
+        Logger::debug("Idle injection " + std::to_string(percent) + "%");
+        m_injection = injection;
+    }
+
+    std::optional<uint64_t> readEnergy() const
+    {
+        if (!m_powerLimit)
+        {
+            return std::nullopt;
+        }
+        uint64_t total = 0;
+        for (const auto& zone : m_raplZones)
+        {
+            try
+            {
+                total += std::stoull(LinuxSysfs::readAttribute(zone + "/energy_uj").value_or(""));
+            }
+            catch (const std::exception&)
+            {
+                return std::nullopt;
+            }
+        }
+        return total;
+    }
+
+    /**
+     * Per-CPU run-queue wait in nanoseconds, the eighth counter of each cpuN line of /proc/schedstat
+     */
+    std::vector<uint64_t> readRunDelay() const
+    {
+        std::vector<uint64_t> delays;
+        std::ifstream file(m_root + "/proc/schedstat");
+        for (std::string line; std::getline(file, line);)
+        {
+            std::istringstream fields(line);
+            std::string name;
+            fields >> name;
+            if (!name.starts_with("cpu") || name.size() == 3)
+            {
+                continue;
+            }
+            std::vector<uint64_t> counters;
+            for (uint64_t value; fields >> value;)
+            {
+                counters.push_back(value);
+            }
+            delays.push_back(counters.size() > 7 ? counters[7] : 0);
+        }
+        return delays;
+    }
+
+    void accountRunDelay(const std::vector<uint64_t>& runDelay, double seconds)
+    {
+        if (runDelay.empty() || runDelay.size() != m_lastRunDelay.size())
+        {
+            return;
+        }
+        uint64_t waited = 0;
+        for (size_t cpu = 0; cpu < runDelay.size(); ++cpu)
+        {
+            waited += runDelay[cpu] >= m_lastRunDelay[cpu] ? runDelay[cpu] - m_lastRunDelay[cpu] : 0;
+        }
+        double msPerCpuSecond = static_cast<double>(waited) / 1e6 / static_cast<double>(runDelay.size()) / seconds;
+        if (m_injection > 0.0)
+        {
+            m_delayInjecting += msPerCpuSecond * seconds;
+            m_timeInjecting += seconds;
+        }
+        else
+        {
+            m_delayFree += msPerCpuSecond * seconds;
+            m_timeFree += seconds;
+        }
+    }
+
+    static std::string formatDelay(double msPerSecond)
+    {
+        std::ostringstream oss;
+        oss.precision(1);
+        oss << std::fixed << msPerSecond;
+        return oss.str();
+    }
+
+    std::string m_root;
+    std::optional<double> m_powerLimit;
+    std::optional<double> m_thermalLimit;
+    std::vector<std::string> m_raplZones;
+    std::vector<std::string> m_thermalZones;
+    std::string m_powerclamp;                       ///< intel_powerclamp cooling device, empty if absent
+    std::map<std::string, std::string> m_cpuMax;    ///< cpu.max files and their values before throttling
+    size_t m_cpuCount;                              ///< online CPUs, the unit of a cpu.max quota
+    double m_maxInjection;
+    PiController m_controller;                      ///< output is the forced idle fraction
+    double m_injection;
+    std::optional<std::chrono::steady_clock::time_point> m_lastSample;
+    std::optional<uint64_t> m_lastEnergy;
+    std::vector<uint64_t> m_lastRunDelay;
+    double m_observed;                              ///< seconds covered by samples
+    double m_injected;                              ///< injection integrated over time
+    double m_delayInjecting;
+    double m_timeInjecting;
+    double m_delayFree;
+    double m_timeFree;
+};
+
+// Factory function for creating the Linux idle injection controller
+std::unique_ptr<IIdleInjectionController> createLinuxIdleInjectionController(const std::string& rootPrefix)
+{
+    return std::make_unique<LinuxIdleInjectionController>(rootPrefix);
+}
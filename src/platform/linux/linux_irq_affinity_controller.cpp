@@ -0,0 +1,297 @@
+#include "platform/iirq_affinity_controller.h"
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Linux interrupt consolidation through /proc/irq/N/smp_affinity_list
+ * Per-CPU and managed interrupts (timers, IPIs, multi-queue NVMe and network
+ * queues) reject affinity writes; they are left alone and never restored.
+ * Counters come from /proc/interrupts, so a busy device keeps its spread until
+ * it stays quiet for QUIET_INTERVALS intervals in a row
+ */
+class LinuxIrqAffinityController : public IIrqAffinityController
+{
+public:
+    explicit LinuxIrqAffinityController(const std::string& rootPrefix)
+        : m_root{rootPrefix}
+        , m_maxIrqRate{0}
+        , m_powerSave{false}
+        , m_consolidated{false}
+        , m_busy{false}
+        , m_quietIntervals{0}
+    {
+    }
+
+    virtual ~LinuxIrqAffinityController() override = default;
+
+    bool initialize(const std::vector<int>& housekeepingCpus, int maxIrqRate) override
+    {
+        m_maxIrqRate = maxIrqRate;
+        m_original.clear();
+
+        // Offline housekeeping CPUs would make every write fail
+        std::vector<int> online = LinuxSysfs::parseCpuList(
+            LinuxSysfs::readAttribute(m_root + "/sys/devices/system/cpu/online").value_or(""));
+        std::vector<int> cpus;
+        for (int cpu : housekeepingCpus)
+        {
+            if (online.empty() || std::find(online.begin(), online.end(), cpu) != online.end())
+            {
+                cpus.push_back(cpu);
+            }
+            else
+            {
+                Logger::warning("Housekeeping CPU " + std::to_string(cpu) + " is offline - not routing interrupts to it");
+            }
+        }
+        if (cpus.empty())
+        {
+            return false;
+        }
+        m_target.clear();
+        for (int cpu : cpus)
+        {
+            m_target += (m_target.empty() ? "" : ",") + std::to_string(cpu);
+        }
+
+        // IRQ 0 is the legacy timer and never movable
+        std::error_code ec;
+        for (std::filesystem::directory_iterator it(m_root + "/proc/irq", ec), end; !ec && it != end; it.increment(ec))
+        {
+            std::string name = it->path().filename().string();
+            if (name.empty() || name.size() > 9 ||
+                !std::all_of(name.begin(), name.end(), [](unsigned char c) { return std::isdigit(c); }))
+            {
+                continue;
+            }
+            int irq = std::stoi(name);
+            auto affinity = LinuxSysfs::readAttribute(affinityPath(irq));
+            if (irq > 0 && affinity && !affinity->empty())
+            {
+                m_original[irq] = *affinity;
+            }
+        }
+
+        if (m_original.empty())
+        {
+            return false;
+        }
+        Logger::info("IRQ affinity: " + std::to_string(m_original.size()) + " interrupt(s) move to CPUs " + m_target +
+                     " in the power save tier unless one exceeds " + std::to_string(maxIrqRate) + "/s");
+        return true;
+    }
+
+    void setTier(PowerTier tier) override
+    {
+        m_powerSave = tier == PowerTier::POWER_SAVE;
+        if (!m_powerSave)
+        {
+            restore();
+            return;
+        }
+        if (!m_busy)
+        {
+            consolidate();
+        }
+    }
+
+    void update(std::chrono::steady_clock::time_point now) override
+    {
+        sample(now);
+        if (m_busy && m_consolidated)
+        {
+            Logger::info("Busy interrupt source - spreading interrupts again");
+            restore();
+        }
+        else if (!m_busy && m_powerSave && !m_consolidated)
+        {
+            consolidate();
+        }
+    }
+
+    std::vector<double> getInterruptRates() const override
+    {
+        return m_cpuRates;
+    }
+
+    bool restore() override
+    {
+        if (!m_consolidated)
+        {
+            return true;
+        }
+
+        bool success = true;
+        for (const auto& [irq, affinity] : m_original)
+        {
+            if (m_unmovable.contains(irq))
+            {
+                continue;
+            }
+            // The device may have been removed while consolidated
+            if (!LinuxSysfs::writeAttribute(affinityPath(irq), affinity) && LinuxSysfs::exists(affinityPath(irq)))
+            {
+                Logger::error("Failed to restore IRQ " + std::to_string(irq) + " affinity to " + affinity);
+                success = false;
+            }
+        }
+        m_consolidated = false;
+        Logger::debug("Restored interrupt affinities");
+        return success;
+    }
+
+private:
+    static constexpr int QUIET_INTERVALS = 3;
+
+    std::string affinityPath(int irq) const
+    {
+        return m_root + "/proc/irq/" + std::to_string(irq) + "/smp_affinity_list";
+    }
+
+    void consolidate()
+    {
+        int moved = 0;
+        for (const auto& [irq, affinity] : m_original)
+        {
+            if (m_unmovable.contains(irq))
+            {
+                continue;
+            }
+            if (LinuxSysfs::writeAttribute(affinityPath(irq), m_target))
+            {
+                ++moved;
+            }
+            else
+            {
+                Logger::debug("IRQ " + std::to_string(irq) + " affinity is not movable");
+                m_unmovable.insert(irq);
+            }
+        }
+        m_consolidated = true;
+        Logger::debug("Moved " + std::to_string(moved) + " interrupt(s) to CPUs " + m_target);
+    }
+
+    /**
+     * Read /proc/interrupts and derive per-interrupt and per-CPU rates
+     * Only numbered device interrupts count; local timer and IPI rows are per-CPU by nature
+     */
+    void sample(std::chrono::steady_clock::time_point now)
+    {
+        std::ifstream file(m_root + "/proc/interrupts");
+        std::string header;
+        if (!file.is_open() || !std::getline(file, header))
+        {
+            return;
+        }
+        size_t cpuCount = 0;
+        std::istringstream columns(header);
+        for (std::string column; columns >> column;)
+        {
+            ++cpuCount;
+        }
+
+        std::map<int, uint64_t> irqCounts;
+        std::vector<uint64_t> cpuCounts(cpuCount, 0);
+        for (std::string line; std::getline(file, line);)
+        {
+            std::istringstream fields(line);
+            std::string label;
+            fields >> label;
+            if (label.size() < 2 || label.back() != ':' || label.size() > 10 ||
+                !std::all_of(label.begin(), label.end() - 1, [](unsigned char c) { return std::isdigit(c); }))
+            {
+                continue;
+            }
+            int irq = std::stoi(label);
+            uint64_t total = 0;
+            uint64_t count;
+            for (size_t cpu = 0; cpu < cpuCount && fields >> count; ++cpu)
+            {
+                cpuCounts[cpu] += count;
+                total += count;
+            }
+            irqCounts[irq] = total;
+        }
+
+        if (m_lastSample)
+        {
+            double seconds = std::chrono::duration<double>(now - *m_lastSample).count();
+            if (seconds > 0.0)
+            {
+                m_cpuRates.assign(cpuCount, 0.0);
+                for (size_t cpu = 0; cpu < cpuCount && cpu < m_lastCpuCounts.size(); ++cpu)
+                {
+                    m_cpuRates[cpu] = cpuCounts[cpu] >= m_lastCpuCounts[cpu]
+                                          ? static_cast<double>(cpuCounts[cpu] - m_lastCpuCounts[cpu]) / seconds
+                                          : 0.0;
+                }
+
+                bool busy = false;
+                for (const auto& [irq, total] : irqCounts)
+                {
+                    auto last = m_lastIrqCounts.find(irq);
+                    if (!m_original.contains(irq) || m_unmovable.contains(irq) || last == m_lastIrqCounts.end() ||
+                        total < last->second)
+                    {
+                        continue;
+                    }
+                    double rate = static_cast<double>(total - last->second) / seconds;
+                    if (rate > m_maxIrqRate)
+                    {
+                        Logger::debug("IRQ " + std::to_string(irq) + " at " + std::to_string(static_cast<int>(rate)) + "/s");
+                        busy = true;
+                    }
+                }
+
+                // One busy interval spreads the interrupts; consolidating again takes several quiet ones
+                if (busy)
+                {
+                    m_busy = true;
+                    m_quietIntervals = 0;
+                }
+                else if (m_busy && ++m_quietIntervals >= QUIET_INTERVALS)
+                {
+                    m_busy = false;
+                }
+            }
+        }
+
+        m_lastSample = now;
+        m_lastIrqCounts = std::move(irqCounts);
+        m_lastCpuCounts = std::move(cpuCounts);
+    }
+
+    std::string m_root;
+    std::string m_target;                       ///< housekeeping CPU list written to smp_affinity_list
+    int m_maxIrqRate;
+    bool m_powerSave;
+    bool m_consolidated;
+    bool m_busy;                                ///< a movable interrupt exceeded the rate limit since the last quiet streak
+    int m_quietIntervals;                       ///< consecutive intervals without a busy interrupt while busy
+    std::map<int, std::string> m_original;      ///< affinity lists before the daemon touched them
+    std::set<int> m_unmovable;                  ///< interrupts that rejected the write
+    std::optional<std::chrono::steady_clock::time_point> m_lastSample;
+    std::map<int, uint64_t> m_lastIrqCounts;
+    std::vector<uint64_t> m_lastCpuCounts;
+    std::vector<double> m_cpuRates;
+};
+
+// Factory function for creating the Linux IRQ affinity controller
+std::unique_ptr<IIrqAffinityController> createLinuxIrqAffinityController(const std::string& rootPrefix)
+{
+    return std::make_unique<LinuxIrqAffinityController>(rootPrefix);
+}
@@ -0,0 +1,278 @@
+#include "platform/iknob_manager.h"
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include "security_utils.h"
+#include <algorithm>
+#include <chrono>
+#include <glob.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * Linux knob manager writing sysfs and procfs attributes
+ * Targets are glob-expanded once at load, restricted to /sys and /proc/sys and
+ * kept open, so a tier switch costs one pwrite per changed attribute
+ */
+class LinuxKnobManager : public IKnobManager
+{
+public:
+    explicit LinuxKnobManager(const std::string& rootPrefix)
+        : m_root{rootPrefix}
+    {
+    }
+
+    virtual ~LinuxKnobManager() override
+    {
+        closeAll();
+    }
+
+    LinuxKnobManager(const LinuxKnobManager&) = delete;
+    LinuxKnobManager& operator=(const LinuxKnobManager&) = delete;
+
+    /**
+     * Expand the targets of every tier, open them and snapshot their values
+     * Paths that match nothing and attributes that cannot be opened are skipped
+     * with a warning. A sysctl name is rejected if it does not exist, since a
+     * dotted name may have been split at a dot inside a component
+     * @param profiles knob settings of every tier
+     * @return false if a target resolves outside the allowed directories or names a missing sysctl
+     */
+    bool load(const KnobProfiles& profiles) override
+    {
+        closeAll();
+
+        for (size_t tier = 0; tier < profiles.size(); ++tier)
+        {
+            for (const auto& setting : profiles[tier])
+            {
+                std::vector<std::string> paths = expand(setting.target);
+                if (paths.empty() && !setting.target.starts_with("/"))
+                {
+                    Logger::error("Sysctl " + setting.target + " does not exist on this system" +
+                                  (setting.target.find('/') == std::string::npos
+                                       ? " - write it with '/' separators if a component contains a dot"
+                                       : ""));
+                    return false;
+                }
+                if (paths.empty())
+                {
+                    Logger::warning("Knob " + setting.target + " matches no attribute on this system - ignoring");
+                    continue;
+                }
+
+                for (const auto& path : paths)
+                {
+                    if (!isAllowed(path))
+                    {
+                        return false;
+                    }
+                    Knob* knob = findOrOpen(path);
+                    if (!knob)
+                    {
+                        continue;
+                    }
+                    // A later entry for the same attribute wins
+                    knob->values[tier] = setting.value;
+                }
+            }
+        }
+
+        if (!m_knobs.empty())
+        {
+            Logger::info("Loaded knob profiles: " + std::to_string(m_knobs.size()) + " attribute(s)");
+        }
+        return true;
+    }
+
+    /**
+     * Write the attributes whose value differs from the tier's value
+     * Knobs the tier does not list go back to their snapshot
+     * @param tier tier to apply
+     * @return true if every write succeeded
+     */
+    bool applyTier(PowerTier tier) override
+    {
+        size_t index = static_cast<size_t>(tier);
+        int written = 0;
+        int failed = 0;
+        auto start = std::chrono::steady_clock::now();
+
+        for (auto& knob : m_knobs)
+        {
+            const std::optional<std::string>& target = knob.values[index] ? knob.values[index] : knob.original;
+            if (!target || knob.current == target)
+            {
+                continue;
+            }
+
+            if (LinuxSysfs::writeDescriptor(knob.fd, *target))
+            {
+                knob.current = target;
+                ++written;
+            }
+            else
+            {
+                Logger::warning("Failed to write knob " + knob.path + " = " + *target);
+                knob.current.reset();
+                ++failed;
+            }
+        }
+
+        if (written > 0 || failed > 0)
+        {
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+            Logger::info("Applied knob profile " + powerTierToString(tier) + " (" + std::to_string(written) + " write(s), " +
+                         std::to_string(failed) + " failure(s), " + std::to_string(elapsed.count()) + " us)");
+        }
+        return failed == 0;
+    }
+
+    /**
+     * Write back the snapshot, last loaded attribute first
+     * @return true if every changed attribute was restored
+     */
+    bool restore() override
+    {
+        bool success = true;
+        int restored = 0;
+        for (auto it = m_knobs.rbegin(); it != m_knobs.rend(); ++it)
+        {
+            if (!it->original || it->current == it->original)
+            {
+                continue;
+            }
+
+            if (LinuxSysfs::writeDescriptor(it->fd, *it->original))
+            {
+                it->current = it->original;
+                ++restored;
+            }
+            else
+            {
+                Logger::error("Failed to restore knob " + it->path + " to " + *it->original);
+                success = false;
+            }
+        }
+
+        if (restored > 0)
+        {
+            Logger::info("Restored " + std::to_string(restored) + " knob(s) to their original values");
+        }
+        return success;
+    }
+
+    size_t getKnobCount() const override
+    {
+        return m_knobs.size();
+    }
+
+private:
+    struct Knob
+    {
+        std::string path;
+        int fd{-1};
+        std::optional<std::string> original;                ///< value before the daemon touched it
+        std::optional<std::string> current;                 ///< last value written, unset if unknown
+        std::array<std::optional<std::string>, 4> values;   ///< per tier, indexed by PowerTier
+    };
+
+    /**
+     * Turn a configured target into attribute paths
+     * Sysctl names map to /proc/sys, paths are glob-expanded in sorted order.
+     * As in sysctl.d(5), a name containing '/' uses it as the separator and
+     * keeps its dots, e.g. net/ipv4/conf/eth0.100/rp_filter
+     */
+    std::vector<std::string> expand(const std::string& target) const
+    {
+        std::string pattern = target;
+        if (!pattern.starts_with("/"))
+        {
+            if (pattern.find('/') == std::string::npos)
+            {
+                std::replace(pattern.begin(), pattern.end(), '.', '/');
+            }
+            pattern = "/proc/sys/" + pattern;
+        }
+        pattern = m_root + pattern;
+
+        std::vector<std::string> paths;
+        glob_t matches{};
+        if (glob(pattern.c_str(), GLOB_ERR, nullptr, &matches) == 0)
+        {
+            for (size_t i = 0; i < matches.gl_pathc; ++i)
+            {
+                paths.emplace_back(matches.gl_pathv[i]);
+            }
+        }
+        globfree(&matches);
+        return paths;
+    }
+
+    /**
+     * Check that an attribute lies below /sys or /proc/sys
+     * Symlinks are resolved first, so /sys/class links into /sys/devices stay allowed
+     */
+    bool isAllowed(const std::string& path) const
+    {
+        std::string allowedDir = m_root + (path.starts_with(m_root + "/proc/") ? "/proc/sys" : "/sys");
+        if (!SecurityUtils::isPathWithinDirectory(path, allowedDir))
+        {
+            Logger::error("Security: knob " + path + " is outside " + allowedDir);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Open and snapshot an attribute the first time it is seen
+     * @return the knob, or nullptr if the attribute cannot be opened
+     */
+    Knob* findOrOpen(const std::string& path)
+    {
+        auto it = std::find_if(m_knobs.begin(), m_knobs.end(), [&path](const Knob& knob) { return knob.path == path; });
+        if (it != m_knobs.end())
+        {
+            return &*it;
+        }
+
+        Knob knob;
+        knob.path = path;
+        knob.fd = LinuxSysfs::openAttribute(path);
+        if (knob.fd < 0)
+        {
+            Logger::warning("Cannot open knob " + path + " for reading and writing - ignoring");
+            return nullptr;
+        }
+        knob.original = LinuxSysfs::readDescriptor(knob.fd);
+        knob.current = knob.original;
+        if (!knob.original)
+        {
+            Logger::warning("Cannot read knob " + path + " - it will not be restored on exit");
+        }
+
+        m_knobs.push_back(std::move(knob));
+        return &m_knobs.back();
+    }
+
+    void closeAll()
+    {
+        for (auto& knob : m_knobs)
+        {
+            close(knob.fd);
+        }
+        m_knobs.clear();
+    }
+
+    std::string m_root;
+    std::vector<Knob> m_knobs;      ///< in load order
+};
+
+// Factory function for creating the Linux knob manager
+std::unique_ptr<IKnobManager> createLinuxKnobManager(const std::string& rootPrefix)
+{
+    return std::make_unique<LinuxKnobManager>(rootPrefix);
+}
@@ -0,0 +1,127 @@
+#include "platform/linux/linux_package_control.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <filesystem>
+
+namespace
+{
+    // Share of the boot-time uncore range allowed per tier, indexed by PowerTier
+    constexpr std::array<double, 4> UNCORE_RANGE_SHARE = {0.5, 0.75, 1.0, 1.0};
+
+    // Uncore ratios step in 100 MHz
+    constexpr int UNCORE_STEP_KHZ = 100000;
+
+    std::optional<int> readKhz(const std::string& path)
+    {
+        auto value = LinuxSysfs::readAttribute(path);
+        if (!value)
+        {
+            return std::nullopt;
+        }
+        try
+        {
+            return std::stoi(*value);
+        }
+        catch (const std::exception&)
+        {
+            return std::nullopt;
+        }
+    }
+}
+
+std::vector<std::string> selectDomainPolicies(const ControlDomain& domain, const std::vector<std::string>& policies,
+                                              const std::string& cpuRoot)
+{
+    std::vector<std::string> selected;
+    if (domain.scope == ControlDomainScope::CPUFREQ_POLICY)
+    {
+        // Matching against the known list also rejects names such as "../policy0"
+        std::string policy = cpuRoot + "/cpufreq/" + domain.name;
+        if (std::find(policies.begin(), policies.end(), policy) != policies.end())
+        {
+            selected.push_back(policy);
+        }
+    }
+    else if (domain.scope == ControlDomainScope::PACKAGE)
+    {
+        for (const auto& policy : policies)
+        {
+            std::vector<int> cpus = LinuxSysfs::readPolicyCpus(policy);
+            bool inPackage = std::any_of(cpus.begin(), cpus.end(), [&domain](int cpu) {
+                return std::find(domain.cpus.begin(), domain.cpus.end(), cpu) != domain.cpus.end();
+            });
+            if (inPackage)
+            {
+                selected.push_back(policy);
+            }
+        }
+    }
+    return selected;
+}
+
+LinuxUncoreFrequency::LinuxUncoreFrequency(const std::string& cpuRoot)
+{
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(cpuRoot + "/intel_uncore_frequency", ec), end; !ec && it != end; it.increment(ec))
+    {
+        UncoreDomain domain;
+        domain.path = it->path().string();
+        std::string name = it->path().filename().string();
+
+        // Legacy layout is package_XX_die_YY, the TPMI layout is uncoreNN with a package_id attribute
+        int die = 0;
+        if (std::sscanf(name.c_str(), "package_%d_die_%d", &domain.package, &die) != 2)
+        {
+            auto package = readKhz(domain.path + "/package_id");
+            if (!name.starts_with("uncore") || !package)
+            {
+                continue;
+            }
+            domain.package = *package;
+        }
+
+        auto initialMin = readKhz(domain.path + "/initial_min_freq_khz");
+        auto initialMax = readKhz(domain.path + "/initial_max_freq_khz");
+        if (!initialMin || !initialMax || *initialMax < *initialMin ||
+            !LinuxSysfs::exists(domain.path + "/max_freq_khz"))
+        {
+            continue;
+        }
+        domain.initialMinKhz = *initialMin;
+        domain.initialMaxKhz = *initialMax;
+        m_domains.push_back(std::move(domain));
+    }
+
+    std::sort(m_domains.begin(), m_domains.end(), [](const UncoreDomain& a, const UncoreDomain& b) { return a.path < b.path; });
+    if (!m_domains.empty())
+    {
+        Logger::debug("Uncore frequency control: " + std::to_string(m_domains.size()) + " domain(s)");
+    }
+}
+
+PowerPlan LinuxUncoreFrequency::buildPlan(int package, PowerTier tier, int stage) const
+{
+    PowerPlan plan;
+    double share = UNCORE_RANGE_SHARE[static_cast<size_t>(tier)];
+    for (const auto& domain : m_domains)
+    {
+        if (domain.package != package)
+        {
+            continue;
+        }
+
+        int range = domain.initialMaxKhz - domain.initialMinKhz;
+        int limit = domain.initialMinKhz + static_cast<int>(range * share) / UNCORE_STEP_KHZ * UNCORE_STEP_KHZ;
+        if (share >= 1.0)
+        {
+            limit = domain.initialMaxKhz;
+        }
+        // The driver rounds to its ratio, so the written value is read back
+        plan.push_back({domain.path + "/max_freq_khz", std::to_string(std::max(limit, domain.initialMinKhz)),
+                        "uncore_max_freq_khz", stage, true});
+    }
+    return plan;
+}
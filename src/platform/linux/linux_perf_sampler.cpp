@@ -0,0 +1,234 @@
+#include "platform/iperf_sampler.h"
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * Linux hardware counters through perf_event_open
+ * Each online CPU gets one counter group (cycles as leader, instructions and
+ * the memory event as members), so the three values are scheduled together
+ * and come back from a single read() of the leader. Values are scaled by
+ * enabled/running time when the PMU multiplexes groups
+ */
+class LinuxPerfSampler : public IPerfSampler
+{
+public:
+    explicit LinuxPerfSampler(const std::string& cpuSysfsRoot)
+        : m_cpuRoot{cpuSysfsRoot}
+        , m_memoryEvent{MEMORY_EVENTS.size()}
+    {
+    }
+
+    virtual ~LinuxPerfSampler() override
+    {
+        closeGroups();
+    }
+
+    LinuxPerfSampler(const LinuxPerfSampler&) = delete;
+    LinuxPerfSampler& operator=(const LinuxPerfSampler&) = delete;
+
+    bool initialize() override
+    {
+        std::vector<int> cpus = LinuxSysfs::parseCpuList(LinuxSysfs::readAttribute(m_cpuRoot + "/online").value_or(""));
+        if (cpus.empty())
+        {
+            return false;
+        }
+
+        // Stall counters are the better signal but missing on many PMUs (and on some core types of hybrids)
+        for (size_t event = 0; event < MEMORY_EVENTS.size(); ++event)
+        {
+            if (openGroups(cpus, event))
+            {
+                m_memoryEvent = event;
+                Logger::info("Performance counters: cycles, instructions and " + getMemoryEvent() + " on " +
+                             std::to_string(cpus.size()) + " CPU(s)");
+                return true;
+            }
+        }
+
+        Logger::info("Hardware performance counters are not available (" + m_openError + ", perf_event_paranoid " +
+                     LinuxSysfs::readAttribute("/proc/sys/kernel/perf_event_paranoid").value_or("unknown") +
+                     ") - workload classification disabled");
+        return false;
+    }
+
+    std::optional<PerfCounters> sample() override
+    {
+        if (m_groups.empty())
+        {
+            return std::nullopt;
+        }
+
+        PerfCounters delta;
+        delta.stalledCycles = MEMORY_EVENTS[m_memoryEvent].stalls ? std::optional<uint64_t>{0} : std::nullopt;
+        delta.llcMisses = MEMORY_EVENTS[m_memoryEvent].stalls ? std::nullopt : std::optional<uint64_t>{0};
+        bool primed = true;
+
+        for (auto& group : m_groups)
+        {
+            // nr, time_enabled, time_running, then one value per counter in group order
+            std::array<uint64_t, 3 + COUNTERS> buffer{};
+            ssize_t bytes = read(group.fds[0], buffer.data(), sizeof(buffer));
+            if (bytes != static_cast<ssize_t>(sizeof(buffer)) || buffer[0] != COUNTERS)
+            {
+                Logger::debug("Failed to read performance counters: " + std::string(std::strerror(errno)));
+                return std::nullopt;
+            }
+
+            std::array<uint64_t, COUNTERS> values{};
+            for (size_t counter = 0; counter < COUNTERS; ++counter)
+            {
+                values[counter] = buffer[2] > 0 ? static_cast<uint64_t>(static_cast<double>(buffer[3 + counter]) *
+                                                                        static_cast<double>(buffer[1]) / static_cast<double>(buffer[2]))
+                                                : 0;
+            }
+
+            if (!group.last)
+            {
+                primed = false;
+            }
+            else
+            {
+                // Scaled values can step back slightly when multiplexing changes; count that as no progress
+                auto since = [&](size_t counter) {
+                    return values[counter] >= (*group.last)[counter] ? values[counter] - (*group.last)[counter] : 0;
+                };
+                delta.cycles += since(0);
+                delta.instructions += since(1);
+                (delta.stalledCycles ? *delta.stalledCycles : *delta.llcMisses) += since(2);
+            }
+            group.last = values;
+        }
+
+        if (!primed)
+        {
+            return std::nullopt;
+        }
+        return delta;
+    }
+
+    std::string getMemoryEvent() const override
+    {
+        return m_memoryEvent < MEMORY_EVENTS.size() ? MEMORY_EVENTS[m_memoryEvent].name : "none";
+    }
+
+private:
+    static constexpr size_t COUNTERS = 3;
+
+    struct MemoryEvent
+    {
+        uint32_t type;
+        uint64_t config;
+        const char* name;
+        bool stalls;        ///< counts stalled cycles rather than cache misses
+    };
+
+    static constexpr std::array<MemoryEvent, 3> MEMORY_EVENTS = {{
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_BACKEND, "stalled-cycles-backend", true},
+        {PERF_TYPE_HW_CACHE,
+         PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+         "LLC-load-misses", false},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, "cache-misses", false},
+    }};
+
+    struct Group
+    {
+        std::vector<int> fds;                               ///< leader first
+        std::optional<std::array<uint64_t, COUNTERS>> last; ///< scaled totals at the previous sample
+    };
+
+    int openCounter(uint32_t type, uint64_t config, int cpu, int groupFd)
+    {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        if (groupFd < 0)
+        {
+            // The leader starts the whole group once every member is attached
+            attr.disabled = 1;
+        }
+
+        // pid -1 with a CPU counts everything that runs on that CPU
+        int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, -1, cpu, groupFd, PERF_FLAG_FD_CLOEXEC));
+        if (fd < 0)
+        {
+            m_openError = std::strerror(errno);
+        }
+        return fd;
+    }
+
+    bool openGroups(const std::vector<int>& cpus, size_t memoryEvent)
+    {
+        for (int cpu : cpus)
+        {
+            Group group;
+            int leader = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, cpu, -1);
+            if (leader >= 0)
+            {
+                group.fds.push_back(leader);
+                int instructions = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, cpu, leader);
+                if (instructions >= 0)
+                {
+                    group.fds.push_back(instructions);
+                    int memory = openCounter(MEMORY_EVENTS[memoryEvent].type, MEMORY_EVENTS[memoryEvent].config, cpu, leader);
+                    if (memory >= 0)
+                    {
+                        group.fds.push_back(memory);
+                    }
+                }
+            }
+
+            m_groups.push_back(std::move(group));
+            if (m_groups.back().fds.size() != COUNTERS)
+            {
+                closeGroups();
+                return false;
+            }
+        }
+
+        for (const auto& group : m_groups)
+        {
+            ioctl(group.fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(group.fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+        return true;
+    }
+
+    void closeGroups()
+    {
+        for (const auto& group : m_groups)
+        {
+            for (int fd : group.fds)
+            {
+                close(fd);
+            }
+        }
+        m_groups.clear();
+    }
+
+    std::string m_cpuRoot;
+    size_t m_memoryEvent;           ///< index into MEMORY_EVENTS, MEMORY_EVENTS.size() when none is open
+    std::vector<Group> m_groups;    ///< one per online CPU
+    std::string m_openError;        ///< reason the last perf_event_open failed
+};
+
+// Factory function for creating the Linux performance counter sampler
+std::unique_ptr<IPerfSampler> createLinuxPerfSampler(const std::string& cpuSysfsRoot)
+{
+    return std::make_unique<LinuxPerfSampler>(cpuSysfsRoot);
+}
@@ -137,6 +137,15 @@ public:
         return "/etc/ddogreen/ddogreen.conf";
     }
 
+    /**
+     * Get the default state directory for Linux
+     * @return /var/lib/ddogreen
+     */
+    std::string getDefaultStateDirectory() const override
+    {
+        return "/var/lib/ddogreen";
+    }
+
     /**
      * Check if platform utilities are available
      * @return true (always available on Linux)
@@ -0,0 +1,212 @@
+#include "platform/ipm_qos_controller.h"
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * Linux PM QoS controller
+ * The system-wide request is the open /dev/cpu_dma_latency descriptor: the
+ * kernel drops it when the descriptor closes, including when the process dies,
+ * so a crash cannot leave the CPUs pinned in shallow C-states. Per-CPU requests
+ * go through power/pm_qos_resume_latency_us and are written back on release
+ */
+class LinuxPmQosController : public IPmQosController
+{
+public:
+    LinuxPmQosController(const std::string& latencyDevice, const std::string& cpuSysfsRoot)
+        : m_device{latencyDevice}
+        , m_cpuRoot{cpuSysfsRoot}
+        , m_latencyUs{0}
+        , m_perCpu{false}
+        , m_fd{-1}
+        , m_performance{false}
+    {
+    }
+
+    virtual ~LinuxPmQosController() override
+    {
+        release();
+    }
+
+    LinuxPmQosController(const LinuxPmQosController&) = delete;
+    LinuxPmQosController& operator=(const LinuxPmQosController&) = delete;
+
+    bool initialize(int latencyUs, bool perCpu) override
+    {
+        m_latencyUs = latencyUs;
+        m_perCpu = perCpu;
+
+        if (perCpu)
+        {
+            // Snapshot every CPU's resume latency so release can write it back
+            for (int cpu = 0; LinuxSysfs::exists(m_cpuRoot + "/cpu" + std::to_string(cpu)); ++cpu)
+            {
+                if (auto value = LinuxSysfs::readAttribute(resumeLatencyPath(cpu)))
+                {
+                    m_original[cpu] = *value;
+                }
+            }
+            if (m_original.empty())
+            {
+                return false;
+            }
+        }
+        else if (access(m_device.c_str(), W_OK) != 0)
+        {
+            return false;
+        }
+
+        Logger::info("PM QoS: " + std::to_string(latencyUs) + " us wakeup latency bound in the performance tier (" +
+                     (perCpu ? "busy CPUs" : "system-wide") + ")");
+        return true;
+    }
+
+    void setTier(PowerTier tier) override
+    {
+        m_performance = tier == PowerTier::PERFORMANCE;
+        if (m_perCpu)
+        {
+            if (!m_performance)
+            {
+                releaseCpus();
+            }
+            // Busy CPUs are bound at the next utilization sample
+            return;
+        }
+
+        if (m_performance && m_fd < 0)
+        {
+            openRequest();
+        }
+        else if (!m_performance && m_fd >= 0)
+        {
+            closeRequest();
+        }
+    }
+
+    /**
+     * Bound the CPUs at or above BUSY_UTILIZATION and release the others
+     * @param utilization busy fraction per CPU
+     */
+    void update(const std::vector<double>& utilization) override
+    {
+        if (!m_perCpu || !m_performance)
+        {
+            return;
+        }
+
+        for (const auto& [cpu, original] : m_original)
+        {
+            bool busy = static_cast<size_t>(cpu) < utilization.size() &&
+                        utilization[static_cast<size_t>(cpu)] >= BUSY_UTILIZATION;
+            bool bound = m_bound.contains(cpu);
+            if (busy == bound)
+            {
+                continue;
+            }
+
+            std::string value = busy ? std::to_string(m_latencyUs) : original;
+            if (!LinuxSysfs::writeAttribute(resumeLatencyPath(cpu), value))
+            {
+                Logger::warning("Failed to write " + resumeLatencyPath(cpu) + " = " + value);
+                continue;
+            }
+            if (busy)
+            {
+                m_bound.insert(cpu);
+            }
+            else
+            {
+                m_bound.erase(cpu);
+            }
+        }
+    }
+
+    bool release() override
+    {
+        if (m_fd >= 0)
+        {
+            closeRequest();
+        }
+        return releaseCpus();
+    }
+
+private:
+    static constexpr double BUSY_UTILIZATION = 0.3;
+
+    std::string resumeLatencyPath(int cpu) const
+    {
+        return m_cpuRoot + "/cpu" + std::to_string(cpu) + "/power/pm_qos_resume_latency_us";
+    }
+
+    void openRequest()
+    {
+        // O_CLOEXEC keeps helpers such as tlp from inheriting, and so extending, the request
+        m_fd = open(m_device.c_str(), O_WRONLY | O_CLOEXEC);
+        if (m_fd < 0)
+        {
+            Logger::warning("Failed to open " + m_device + ": " + std::strerror(errno));
+            return;
+        }
+
+        int32_t value = m_latencyUs;
+        if (write(m_fd, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value)))
+        {
+            Logger::warning("Failed to write the latency request to " + m_device + ": " + std::strerror(errno));
+            closeRequest();
+            return;
+        }
+        Logger::debug("Holding " + std::to_string(m_latencyUs) + " us CPU latency request");
+    }
+
+    void closeRequest()
+    {
+        close(m_fd);
+        m_fd = -1;
+        Logger::debug("Released CPU latency request");
+    }
+
+    bool releaseCpus()
+    {
+        bool success = true;
+        for (auto it = m_bound.begin(); it != m_bound.end();)
+        {
+            if (LinuxSysfs::writeAttribute(resumeLatencyPath(*it), m_original[*it]))
+            {
+                it = m_bound.erase(it);
+            }
+            else
+            {
+                Logger::error("Failed to restore " + resumeLatencyPath(*it) + " to " + m_original[*it]);
+                success = false;
+                ++it;
+            }
+        }
+        return success;
+    }
+
+    std::string m_device;
+    std::string m_cpuRoot;
+    int m_latencyUs;
+    bool m_perCpu;
+    int m_fd;                               ///< open request on the latency device, -1 when none is held
+    bool m_performance;
+    std::map<int, std::string> m_original;  ///< per-CPU resume latency before the daemon touched it
+    std::set<int> m_bound;                  ///< CPUs currently holding the bound
+};
+
+// Factory function for creating the Linux PM QoS controller
+std::unique_ptr<IPmQosController> createLinuxPmQosController(const std::string& latencyDevice, const std::string& cpuSysfsRoot)
+{
+    return std::make_unique<LinuxPmQosController>(latencyDevice, cpuSysfsRoot);
+}
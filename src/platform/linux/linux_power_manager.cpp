@@ -1,22 +1,33 @@
 #include "platform/ipower_manager.h"
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_power_plan.h"
+#include "platform/linux/linux_tlp_compiler.h"
 #include "logger.h"
 #include "rate_limiter.h"
 #include <cstdlib>
 #include <memory>
 #include <array>
+#include <optional>
 #include <string>
+#include <vector>
 
 /**
  * Linux-specific power manager implementation
  * Uses TLP (ThinkPad-Linux-Power) for power management
+ * When the TLP configuration only uses supported parameters, its AC/BAT profiles
+ * are compiled once and applied as direct attribute writes instead of running tlp
  */
 class LinuxPowerManager : public IPowerManager
 {
 public:
-    LinuxPowerManager() : m_currentMode{"unknown"}, m_rateLimiter(2, 60000)
+    explicit LinuxPowerManager(const std::string& rootPrefix)
+        : m_currentMode{"unknown"}
+        , m_rateLimiter(2, 60000)
+        , m_tlpCompiler(rootPrefix)
     {
         // TLP availability will be checked by the caller
         // Rate limiter: max 2 power mode changes per 60000ms (60 seconds)
+        compileTlpProfiles();
     }
 
     virtual ~LinuxPowerManager() override = default;
@@ -38,22 +49,18 @@ public:
             return true;  // Already in performance mode
         }
 
-        Logger::info("Switching to performance mode (tlp ac)");
-        std::string output = executeCommandWithOutput("tlp ac 2>&1");
-
-        if (!output.empty())
+        if (applyNative(TlpProfile::AC))
         {
-            std::string cleanedOutput = cleanTLPOutput(output);
-            if (!cleanedOutput.empty())
-            {
-                Logger::info("TLP output: " + cleanedOutput);
-            }
+            m_currentMode = "performance";
+            Logger::info("Successfully switched to performance mode");
+            return true;
         }
 
-        // Check if command was successful (TLP doesn't always return proper exit codes)
-        if (output.find("Error") == std::string::npos && output.find("error") == std::string::npos)
+        Logger::info("Switching to performance mode (tlp ac)");
+        if (runTlp(TlpProfile::AC))
         {
             m_currentMode = "performance";
+            m_lastSwitchNative = false;
             Logger::info("Successfully switched to performance mode");
             return true;
         }
@@ -81,22 +88,18 @@ public:
             return true;  // Already in power saving mode
         }
 
-        Logger::info("Switching to power saving mode (tlp bat)");
-        std::string output = executeCommandWithOutput("tlp bat 2>&1");
-
-        if (!output.empty())
+        if (applyNative(TlpProfile::BAT))
         {
-            std::string cleanedOutput = cleanTLPOutput(output);
-            if (!cleanedOutput.empty())
-            {
-                Logger::info("TLP output: " + cleanedOutput);
-            }
+            m_currentMode = "powersaving";
+            Logger::info("Successfully switched to power saving mode");
+            return true;
         }
 
-        // Check if command was successful (TLP doesn't always return proper exit codes)
-        if (output.find("Error") == std::string::npos && output.find("error") == std::string::npos)
+        Logger::info("Switching to power saving mode (tlp bat)");
+        if (runTlp(TlpProfile::BAT))
         {
             m_currentMode = "powersaving";
+            m_lastSwitchNative = false;
             Logger::info("Successfully switched to power saving mode");
             return true;
         }
@@ -107,11 +110,201 @@ public:
         }
     }
 
+    /**
+     * Check that the tier's TLP profile is already in effect without running tlp
+     * The compiled profile's attributes are read back; parameters without native
+     * support, or a configuration that was not compiled, leave tlp-stat's mode report
+     * @param tier tier applied last
+     * @return true if the profile is in effect
+     */
+    bool confirmTier(PowerTier tier) override
+    {
+        bool performance = tier == PowerTier::PERFORMANCE || tier == PowerTier::BALANCED_PERFORMANCE;
+        TlpProfile profile = performance ? TlpProfile::AC : TlpProfile::BAT;
+        std::string expected = performance ? "performance" : "powersaving";
+
+        const CompiledTlpProfile& compiled = compiledProfile(profile);
+        bool compiledWrites = m_hasCompiledProfiles && !compiled.writes.empty();
+        if (compiledWrites && !m_planExecutor.adoptIfApplied(compiled.writes))
+        {
+            return false;
+        }
+
+        bool native = compiledWrites && compiled.isNativeCapable();
+        if (!native && readTlpMode() != expected)
+        {
+            return false;
+        }
+
+        m_currentMode = expected;
+        m_lastSwitchNative = native;
+        return true;
+    }
+
     /**
      * Get current TLP mode
      * @return "performance", "powersaving", or "unknown"
      */
     std::string getCurrentMode() override
+    {
+        // tlp-stat does not see natively applied profiles
+        if (m_lastSwitchNative)
+        {
+            return m_currentMode;
+        }
+
+        auto mode = readTlpMode();
+        if (mode)
+        {
+            m_currentMode = *mode;
+        }
+        return m_currentMode;
+    }
+
+    /**
+     * Check if TLP is installed and available
+     * @return true if TLP commands are accessible
+     */
+    bool isAvailable() override
+    {
+        return executeCommand("which tlp > /dev/null 2>&1");
+    }
+
+    std::string getBackendName() const override
+    {
+        return "tlp";
+    }
+
+    ActuationMetrics getActuationMetrics() const override
+    {
+        return m_actuation;
+    }
+
+    /**
+     * Report profile attributes changed since the last verified switch
+     * A changed profile is no longer the current mode, so the next switch is not skipped
+     */
+    std::vector<ExternalChange> detectExternalChanges() override
+    {
+        std::vector<ExternalChange> changes = m_planExecutor.detectExternalChanges();
+        if (!changes.empty())
+        {
+            m_currentMode = "unknown";
+        }
+        return changes;
+    }
+
+    void ignoreExternalChanges(const std::vector<std::string>& settings) override
+    {
+        m_planExecutor.ignoreExternalChanges(settings);
+    }
+
+    /**
+     * Re-run tlp for the mode TLP currently reports
+     * @return true if tlp accepted the command
+     */
+    bool reapplyCurrentMode() override
+    {
+        std::string mode = getCurrentMode();
+        if (mode == "unknown")
+        {
+            return false;
+        }
+
+        if (applyNative(mode == "performance" ? TlpProfile::AC : TlpProfile::BAT))
+        {
+            return true;
+        }
+
+        std::string output = executeCommandWithOutput(mode == "performance" ? "tlp ac 2>&1" : "tlp bat 2>&1");
+        return output.find("Error") == std::string::npos && output.find("error") == std::string::npos;
+    }
+
+private:
+    /**
+     * Compile the AC and BAT profiles from the TLP configuration
+     */
+    void compileTlpProfiles()
+    {
+        if (!m_tlpCompiler.load() || !m_tlpCompiler.isEnabled())
+        {
+            Logger::debug("No enabled TLP configuration found - using the tlp command");
+            return;
+        }
+
+        m_profiles[0] = m_tlpCompiler.compile(TlpProfile::AC);
+        m_profiles[1] = m_tlpCompiler.compile(TlpProfile::BAT);
+        m_hasCompiledProfiles = true;
+
+        for (TlpProfile profile : {TlpProfile::AC, TlpProfile::BAT})
+        {
+            const CompiledTlpProfile& compiled = compiledProfile(profile);
+            std::string name = profile == TlpProfile::AC ? "AC" : "BAT";
+            if (compiled.isNativeCapable())
+            {
+                Logger::info("TLP " + name + " profile compiled to " + std::to_string(compiled.writes.size()) +
+                             " native write(s)");
+                continue;
+            }
+
+            std::string parameters;
+            for (const auto& parameter : compiled.unsupported)
+            {
+                parameters += (parameters.empty() ? "" : ", ") + parameter;
+            }
+            Logger::info("TLP " + name + " profile uses parameters without native support (" + parameters +
+                         ") - tlp will be used for it");
+        }
+    }
+
+    /**
+     * Run tlp ac or tlp bat and confirm the profile took
+     * @param profile AC or BAT
+     * @return true if tlp reported no error and the readback matches
+     */
+    bool runTlp(TlpProfile profile)
+    {
+        std::string output = executeCommandWithOutput(profile == TlpProfile::AC ? "tlp ac 2>&1" : "tlp bat 2>&1");
+
+        if (!output.empty())
+        {
+            std::string cleanedOutput = cleanTLPOutput(output);
+            if (!cleanedOutput.empty())
+            {
+                Logger::info("TLP output: " + cleanedOutput);
+            }
+        }
+
+        // Check if command was successful (TLP doesn't always return proper exit codes)
+        if (output.find("Error") != std::string::npos || output.find("error") != std::string::npos)
+        {
+            m_actuation.record(ActuationOutcome::FAILED);
+            return false;
+        }
+
+        // The compiled profile lists the attributes tlp writes; without one only tlp's own mode report is left
+        std::string name = profile == TlpProfile::AC ? "AC" : "BAT";
+        const CompiledTlpProfile& compiled = compiledProfile(profile);
+        if (m_hasCompiledProfiles && !compiled.writes.empty())
+        {
+            return verifyActuation(m_planExecutor, compiled.writes, m_actuation, "tlp " + name + " profile");
+        }
+
+        std::string expected = profile == TlpProfile::AC ? "performance" : "powersaving";
+        bool switched = pollWithBackoff([this, &expected]() { return readTlpMode() == expected; }).has_value();
+        m_actuation.record(switched ? ActuationOutcome::SUCCEEDED : ActuationOutcome::FAILED);
+        if (!switched)
+        {
+            Logger::error("tlp " + name + " ran but tlp-stat does not report the new mode");
+        }
+        return switched;
+    }
+
+    /**
+     * Read the mode TLP reports through tlp-stat
+     * @return "performance" or "powersaving", std::nullopt if tlp-stat shows neither
+     */
+    std::optional<std::string> readTlpMode()
     {
         std::string output = executeCommandWithOutput("tlp-stat -s");
 
@@ -142,11 +335,11 @@ public:
 
                         if (mode == "AC")
                         {
-                            m_currentMode = "performance";
+                            return "performance";
                         }
                         else if (mode == "battery")
                         {
-                            m_currentMode = "powersaving";
+                            return "powersaving";
                         }
                     }
                 }
@@ -154,29 +347,57 @@ public:
         }
 
         // Fallback: check for older TLP_DEFAULT_MODE format
-        if (m_currentMode == "unknown")
+        if (output.find("TLP_DEFAULT_MODE=AC") != std::string::npos)
         {
-            if (output.find("TLP_DEFAULT_MODE=AC") != std::string::npos)
-            {
-                m_currentMode = "performance";
-            } else if (output.find("TLP_DEFAULT_MODE=BAT") != std::string::npos) {
-                m_currentMode = "powersaving";
-            }
+            return "performance";
+        } else if (output.find("TLP_DEFAULT_MODE=BAT") != std::string::npos) {
+            return "powersaving";
         }
 
-        return m_currentMode;
+        return std::nullopt;
+    }
+
+    const CompiledTlpProfile& compiledProfile(TlpProfile profile) const
+    {
+        return m_profiles[profile == TlpProfile::AC ? 0 : 1];
     }
 
     /**
-     * Check if TLP is installed and available
-     * @return true if TLP commands are accessible
+     * Apply a compiled TLP profile with direct attribute writes
+     * @param profile AC or BAT
+     * A failed attempt is not counted: the tlp fallback records the switch's outcome
+     * @return true if applied; false if the profile needs the tlp command or a write failed
      */
-    bool isAvailable() override
+    bool applyNative(TlpProfile profile)
     {
-        return executeCommand("which tlp > /dev/null 2>&1");
+        const CompiledTlpProfile& compiled = compiledProfile(profile);
+        if (!m_hasCompiledProfiles || !compiled.isNativeCapable())
+        {
+            return false;
+        }
+
+        std::string name = profile == TlpProfile::AC ? "AC" : "BAT";
+        Logger::info("Applying TLP " + name + " profile natively (" + std::to_string(compiled.writes.size()) + " write(s))");
+        PowerPlanResult result = m_planExecutor.apply(compiled.writes);
+        if (!result.success)
+        {
+            Logger::warning("Native TLP " + name + " profile failed at " + result.failedPath + " - falling back to tlp");
+            return false;
+        }
+        Logger::debug("TLP " + name + " profile: " + std::to_string(result.written) + " written, " +
+                      std::to_string(result.unchanged) + " unchanged");
+        ActuationMetrics native;
+        if (!verifyActuation(m_planExecutor, compiled.writes, native, "Native TLP " + name + " profile"))
+        {
+            Logger::warning("Falling back to tlp for the " + name + " profile");
+            return false;
+        }
+        m_actuation.record(native.partial > 0 ? ActuationOutcome::PARTIAL : ActuationOutcome::SUCCEEDED);
+
+        m_lastSwitchNative = true;
+        return true;
     }
 
-private:
     /**
      * Execute a command and return success status
      * @param command command to execute
@@ -245,10 +466,16 @@ private:
 
     std::string m_currentMode;
     RateLimiter m_rateLimiter;
+    LinuxTlpCompiler m_tlpCompiler;
+    std::array<CompiledTlpProfile, 2> m_profiles;   // AC, BAT
+    LinuxPowerPlanExecutor m_planExecutor;
+    bool m_hasCompiledProfiles{false};
+    bool m_lastSwitchNative{false};
+    ActuationMetrics m_actuation;
 };
 
 // Factory function for creating Linux power manager
-std::unique_ptr<IPowerManager> createLinuxPowerManager()
+std::unique_ptr<IPowerManager> createLinuxPowerManager(const std::string& rootPrefix)
 {
-    return std::make_unique<LinuxPowerManager>();
+    return std::make_unique<LinuxPowerManager>(rootPrefix);
 }
@@ -0,0 +1,371 @@
+#include "platform/linux/linux_power_plan.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <filesystem>
+#include <thread>
+
+PowerPlanResult LinuxPowerPlanExecutor::apply(const PowerPlan& plan)
+{
+    PowerPlanResult result;
+
+    // Original value of every attribute this apply writes, in write order
+    std::vector<std::pair<std::string, std::string>> previousValues;
+    auto start = std::chrono::steady_clock::now();
+
+    for (const SysfsWrite& write : executionOrder(plan))
+    {
+        auto current = cachedValue(write.path);
+        if (current && *current == write.value)
+        {
+            ++result.unchanged;
+            continue;
+        }
+
+        auto writeStart = std::chrono::steady_clock::now();
+        bool written = LinuxSysfs::writeAttribute(write.path, write.value);
+        auto latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - writeStart);
+
+        if (!written)
+        {
+            Logger::error("Power plan: failed to write " + write.value + " to " + write.path +
+                          " (" + write.knob + ") - rolling back " + std::to_string(previousValues.size()) + " write(s)");
+            m_cache.erase(write.path);
+            rollback(previousValues);
+            result.success = false;
+            result.rolledBack = !previousValues.empty();
+            result.failedPath = write.path;
+            return result;
+        }
+
+        bool firstWrite = std::none_of(previousValues.begin(), previousValues.end(),
+            [&write](const auto& previous) { return previous.first == write.path; });
+        if (firstWrite && current)
+        {
+            previousValues.emplace_back(write.path, *current);
+        }
+
+        m_cache[write.path] = write.value;
+        if (write.readBack)
+        {
+            m_cache.erase(write.path);
+            cachedValue(write.path);
+        }
+
+        recordLatency(write.path, latency);
+        result.timings.push_back({write.knob, write.path, latency});
+        ++result.written;
+        Logger::debug("Power plan: " + write.knob + " = " + write.value + " (" + std::to_string(latency.count()) + " us)");
+    }
+
+    auto total = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    if (result.written > 0)
+    {
+        auto slowest = std::max_element(result.timings.begin(), result.timings.end(),
+            [](const KnobTiming& a, const KnobTiming& b) { return a.latency < b.latency; });
+        Logger::debug("Power plan applied: " + std::to_string(result.written) + " written, " +
+                      std::to_string(result.unchanged) + " unchanged in " + std::to_string(total.count()) +
+                      " us (slowest " + slowest->knob + ": " + std::to_string(slowest->latency.count()) + " us)");
+    }
+    return result;
+}
+
+PlanVerification LinuxPowerPlanExecutor::verify(const PowerPlan& plan)
+{
+    // The last write to an attribute is the value it must end up with
+    std::map<std::string, const SysfsWrite*> targets;
+    PowerPlan ordered = executionOrder(plan);
+    for (const SysfsWrite& write : ordered)
+    {
+        targets[write.path] = &write;
+    }
+
+    PlanVerification verification;
+    bool retrying = false;
+    auto settled = pollWithBackoff([&]() {
+        if (retrying)
+        {
+            // In stage order, so e.g. the governor is back before EPP and min/max stay ordered
+            ++verification.retries;
+            for (const SysfsWrite& write : ordered)
+            {
+                auto target = targets.find(write.path);
+                if (target != targets.end() && target->second == &write)
+                {
+                    LinuxSysfs::writeAttribute(write.path, write.value);
+                }
+            }
+        }
+        retrying = true;
+
+        for (auto it = targets.begin(); it != targets.end();)
+        {
+            auto value = LinuxSysfs::readAttribute(it->first);
+            if (value)
+            {
+                m_cache[it->first] = *value;
+            }
+            else
+            {
+                m_cache.erase(it->first);
+            }
+
+            if (value && (it->second->readBack || *value == it->second->value))
+            {
+                ++verification.matched;
+                it = targets.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        return targets.empty();
+    });
+
+    // What the kernel holds now is what later checks compare against
+    for (const SysfsWrite& write : ordered)
+    {
+        auto current = m_cache.find(write.path);
+        if (!write.readBack && current != m_cache.end() && !m_ignored.count(write.path))
+        {
+            m_expected[write.path] = current->second;
+        }
+    }
+
+    if (!settled)
+    {
+        for (const auto& [path, write] : targets)
+        {
+            verification.mismatchedPaths.push_back(path);
+            auto current = m_cache.find(path);
+            Logger::warning("Power plan: " + write->knob + " did not take " + write->value + " (reads " +
+                            (current != m_cache.end() ? current->second : std::string("nothing")) + ")");
+        }
+    }
+    else if (verification.retries > 0)
+    {
+        Logger::debug("Power plan verified after " + std::to_string(verification.retries) + " rewrite(s)");
+    }
+    return verification;
+}
+
+std::vector<ExternalChange> LinuxPowerPlanExecutor::detectExternalChanges()
+{
+    std::vector<ExternalChange> changes;
+    for (auto& [path, expected] : m_expected)
+    {
+        auto value = LinuxSysfs::readAttribute(path);
+        if (!value || *value == expected)
+        {
+            continue;
+        }
+
+        changes.push_back({path, expected, *value, ""});
+        expected = *value;
+        m_cache[path] = *value;
+    }
+
+    if (!changes.empty())
+    {
+        std::string writer = identifyExternalWriter();
+        for (auto& change : changes)
+        {
+            change.writer = writer;
+        }
+    }
+    return changes;
+}
+
+void LinuxPowerPlanExecutor::ignoreExternalChanges(const std::vector<std::string>& paths)
+{
+    for (const std::string& path : paths)
+    {
+        m_ignored.insert(path);
+        m_expected.erase(path);
+    }
+}
+
+bool LinuxPowerPlanExecutor::adoptIfApplied(const PowerPlan& plan)
+{
+    std::map<std::string, const SysfsWrite*> targets;
+    PowerPlan ordered = executionOrder(plan);
+    for (const SysfsWrite& write : ordered)
+    {
+        targets[write.path] = &write;
+    }
+    if (targets.empty())
+    {
+        return false;
+    }
+
+    std::map<std::string, std::string> values;
+    for (const auto& [path, write] : targets)
+    {
+        auto value = LinuxSysfs::readAttribute(path);
+        if (!value || (!write->readBack && *value != write->value))
+        {
+            return false;
+        }
+        values[path] = *value;
+    }
+
+    for (const auto& [path, value] : values)
+    {
+        m_cache[path] = value;
+        if (!targets[path]->readBack && !m_ignored.count(path))
+        {
+            m_expected[path] = value;
+        }
+    }
+    return true;
+}
+
+bool LinuxPowerPlanExecutor::isApplied(const PowerPlan& plan)
+{
+    return !plan.empty() && std::all_of(plan.begin(), plan.end(), [this](const SysfsWrite& write) {
+        auto current = cachedValue(write.path);
+        return current && *current == write.value;
+    });
+}
+
+std::optional<std::string> LinuxPowerPlanExecutor::cachedValue(const std::string& path)
+{
+    auto it = m_cache.find(path);
+    if (it != m_cache.end())
+    {
+        return it->second;
+    }
+
+    auto value = LinuxSysfs::readAttribute(path);
+    if (value)
+    {
+        m_cache[path] = *value;
+    }
+    return value;
+}
+
+std::optional<std::chrono::microseconds> LinuxPowerPlanExecutor::averageLatency(const std::string& path) const
+{
+    auto it = m_latency.find(path);
+    if (it == m_latency.end())
+    {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+PowerPlan LinuxPowerPlanExecutor::executionOrder(const PowerPlan& plan) const
+{
+    // Stable: writes of equal stage and latency keep the order they were planned in,
+    // which keeps repeated writes to one attribute (e.g. clamped limits) in sequence
+    PowerPlan ordered = plan;
+    std::stable_sort(ordered.begin(), ordered.end(), [this](const SysfsWrite& a, const SysfsWrite& b) {
+        if (a.stage != b.stage)
+        {
+            return a.stage < b.stage;
+        }
+        auto latencyA = averageLatency(a.path).value_or(std::chrono::microseconds::zero());
+        auto latencyB = averageLatency(b.path).value_or(std::chrono::microseconds::zero());
+        return latencyA < latencyB;
+    });
+    return ordered;
+}
+
+void LinuxPowerPlanExecutor::rollback(const std::vector<std::pair<std::string, std::string>>& previousValues)
+{
+    for (auto it = previousValues.rbegin(); it != previousValues.rend(); ++it)
+    {
+        if (LinuxSysfs::writeAttribute(it->first, it->second))
+        {
+            m_cache[it->first] = it->second;
+        }
+        else
+        {
+            Logger::error("Power plan: rollback of " + it->first + " to " + it->second + " failed");
+            m_cache.erase(it->first);
+        }
+    }
+}
+
+void LinuxPowerPlanExecutor::recordLatency(const std::string& path, std::chrono::microseconds latency)
+{
+    // Exponential moving average (weight 1/4) so one slow write does not reorder a stage
+    auto it = m_latency.find(path);
+    if (it == m_latency.end())
+    {
+        m_latency[path] = latency;
+        return;
+    }
+    it->second = (it->second * 3 + latency) / 4;
+}
+
+bool verifyActuation(LinuxPowerPlanExecutor& executor, const PowerPlan& plan, ActuationMetrics& metrics,
+                     const std::string& description)
+{
+    PlanVerification verification = executor.verify(plan);
+    metrics.record(verification.outcome());
+    if (verification.outcome() == ActuationOutcome::FAILED)
+    {
+        Logger::error(description + " was written but not taken by the kernel");
+        return false;
+    }
+    if (verification.outcome() == ActuationOutcome::PARTIAL)
+    {
+        Logger::warning(description + " only partially applied (" + std::to_string(verification.mismatchedPaths.size()) +
+                        " attribute(s) kept another value)");
+    }
+    return true;
+}
+
+std::string identifyExternalWriter(const std::string& procRoot)
+{
+    // Daemons that write the settings ddogreen controls; tlp itself runs too briefly to be seen
+    static constexpr std::array<const char*, 7> KNOWN_AGENTS = {
+        "power-profiles-", "tuned", "thermald", "auto-cpufreq", "system76-power", "tlp", "powertop"};
+
+    std::string writers;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(procRoot, ec))
+    {
+        std::string pid = entry.path().filename().string();
+        if (pid.empty() || !std::all_of(pid.begin(), pid.end(), [](unsigned char c) { return std::isdigit(c); }))
+        {
+            continue;
+        }
+
+        // comm is truncated to 15 characters, so power-profiles-daemon only matches by prefix
+        std::string comm = LinuxSysfs::readAttribute(entry.path().string() + "/comm").value_or("");
+        for (const char* agent : KNOWN_AGENTS)
+        {
+            std::string name = agent;
+            if (comm.rfind(name, 0) == 0 && writers.find(comm) == std::string::npos)
+            {
+                writers += (writers.empty() ? "" : ", ") + comm;
+                break;
+            }
+        }
+    }
+    return writers.empty() ? "unknown" : writers;
+}
+
+std::optional<int> pollWithBackoff(const std::function<bool()>& condition, int attempts,
+                                   std::chrono::milliseconds initialDelay)
+{
+    auto delay = initialDelay;
+    for (int attempt = 0; attempt < attempts; ++attempt)
+    {
+        if (attempt > 0)
+        {
+            std::this_thread::sleep_for(delay);
+            delay *= 2;
+        }
+        if (condition())
+        {
+            return attempt;
+        }
+    }
+    return std::nullopt;
+}
@@ -0,0 +1,347 @@
+#include "platform/ipower_manager.h"
+#include "platform/linux/linux_dbus.h"
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_power_plan.h"
+#include "logger.h"
+#include "rate_limiter.h"
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Linux power manager for power-profiles-daemon
+ * Sets ActiveProfile over a persistent D-Bus connection, so a switch is one
+ * Properties.Set round trip instead of spawning powerprofilesctl
+ */
+class LinuxPpdPowerManager : public IPowerManager
+{
+public:
+    explicit LinuxPpdPowerManager(const std::string& busAddress)
+        : m_connection{busAddress.empty() ? DBusConnection::systemBusAddress() : busAddress}
+        , m_currentMode{"unknown"}
+        , m_rateLimiter(2, 60000)
+    {
+        // Rate limiter: max 2 power mode changes per 60000ms (60 seconds), same as the TLP backend
+    }
+
+    virtual ~LinuxPpdPowerManager() override = default;
+
+    /**
+     * Set the performance profile
+     * @return true if successful
+     */
+    bool setPerformanceMode() override
+    {
+        return setTier(PowerTier::PERFORMANCE);
+    }
+
+    /**
+     * Set the power-saver profile
+     * @return true if successful
+     */
+    bool setPowerSavingMode() override
+    {
+        return setTier(PowerTier::POWER_SAVE);
+    }
+
+    /**
+     * Map a tier onto the three power-profiles-daemon profiles
+     * Falls back to balanced when the performance profile is not offered, and
+     * keeps using balanced for it once the daemon rejected performance
+     * @param tier requested tier
+     * @return true if successful
+     */
+    bool setTier(PowerTier tier) override
+    {
+        std::string profile = profileForTier(tier);
+        if (profile == "performance" && m_performanceRejected)
+        {
+            profile = "balanced";
+        }
+        if (profile == m_lastProfile)
+        {
+            return true;  // Already in the requested profile
+        }
+
+        // Rate limiting check
+        if (!m_rateLimiter.isAllowed("power_mode_change")) {
+            Logger::warning("Power mode change request rate limited - ignoring request");
+            return false;
+        }
+
+        if (!ensureConnected())
+        {
+            Logger::error("power-profiles-daemon is not reachable on D-Bus");
+            return false;
+        }
+
+        Logger::info("Switching power profile to " + profile + " (power-profiles-daemon)");
+        bool success = setActiveProfile(profile);
+        if (!success && profile == "performance")
+        {
+            Logger::warning("Performance profile rejected - using balanced for performance from now on");
+            m_performanceRejected = true;
+            profile = "balanced";
+            success = setActiveProfile(profile);
+        }
+
+        if (!success)
+        {
+            m_actuation.record(ActuationOutcome::FAILED);
+            Logger::error("Failed to set power profile " + profile);
+            return false;
+        }
+
+        // The daemon accepts a Set before its drivers finish; the property reflects what it applied
+        bool applied = pollWithBackoff([this, &profile]() { return getActiveProfile() == profile; }).has_value();
+        m_actuation.record(applied ? ActuationOutcome::SUCCEEDED : ActuationOutcome::FAILED);
+        if (!applied)
+        {
+            m_lastProfile.clear();
+            Logger::error("power-profiles-daemon accepted " + profile + " but reports " + getActiveProfile().value_or("nothing"));
+            return false;
+        }
+
+        m_lastProfile = profile;
+        m_currentMode = (profile == "power-saver") ? "powersaving" : "performance";
+        Logger::info("Successfully switched to power profile " + profile);
+        return true;
+    }
+
+    /**
+     * Check that ActiveProfile already is the tier's profile
+     * @param tier tier applied last
+     * @return true if the tier is in effect
+     */
+    bool confirmTier(PowerTier tier) override
+    {
+        if (!ensureConnected())
+        {
+            return false;
+        }
+
+        std::string profile = profileForTier(tier);
+        if (getActiveProfile() != profile)
+        {
+            return false;
+        }
+
+        m_lastProfile = profile;
+        m_currentMode = (profile == "power-saver") ? "powersaving" : "performance";
+        return true;
+    }
+
+    /**
+     * Read ActiveProfile from power-profiles-daemon
+     * @return "performance", "powersaving", or "unknown"
+     */
+    std::string getCurrentMode() override
+    {
+        if (!ensureConnected())
+        {
+            return m_currentMode;
+        }
+
+        auto profile = getActiveProfile();
+        if (profile)
+        {
+            m_lastProfile = *profile;
+            m_currentMode = (*profile == "power-saver") ? "powersaving" : "performance";
+        }
+        return m_currentMode;
+    }
+
+    /**
+     * Check whether power-profiles-daemon is registered on the bus
+     * @return true if ActiveProfile can be read
+     */
+    bool isAvailable() override
+    {
+        return ensureConnected();
+    }
+
+    std::string getBackendName() const override
+    {
+        return "ppd";
+    }
+
+    ActuationMetrics getActuationMetrics() const override
+    {
+        return m_actuation;
+    }
+
+    /**
+     * Compare ActiveProfile with the profile set last
+     * Other clients switch profiles through the daemon itself, so the writer is not known
+     */
+    std::vector<ExternalChange> detectExternalChanges() override
+    {
+        if (m_lastProfile.empty() || !ensureConnected())
+        {
+            return {};
+        }
+
+        auto profile = getActiveProfile();
+        if (!profile || *profile == m_lastProfile)
+        {
+            return {};
+        }
+
+        ExternalChange change{"ActiveProfile", m_lastProfile, *profile, "power-profiles-daemon client"};
+        m_lastProfile = *profile;
+        m_currentMode = (*profile == "power-saver") ? "powersaving" : "performance";
+        return {change};
+    }
+
+    /**
+     * Set ActiveProfile to the profile the daemon already reports
+     * @return true if the daemon accepted the switch
+     */
+    bool reapplyCurrentMode() override
+    {
+        if (!ensureConnected())
+        {
+            return false;
+        }
+
+        auto profile = getActiveProfile();
+        return profile && setActiveProfile(*profile);
+    }
+
+private:
+    struct ServiceName
+    {
+        const char* busName;
+        const char* objectPath;
+    };
+
+    // Current name first, then the legacy name used before power-profiles-daemon 0.20
+    static constexpr std::array<ServiceName, 2> SERVICE_NAMES = {{
+        {"org.freedesktop.UPower.PowerProfiles", "/org/freedesktop/UPower/PowerProfiles"},
+        {"net.hadess.PowerProfiles", "/net/hadess/PowerProfiles"},
+    }};
+
+    static std::string profileForTier(PowerTier tier)
+    {
+        switch (tier)
+        {
+            case PowerTier::POWER_SAVE:           return "power-saver";
+            case PowerTier::BALANCED_POWER:       return "balanced";
+            case PowerTier::BALANCED_PERFORMANCE: return "balanced";
+            case PowerTier::PERFORMANCE:          return "performance";
+            default:                              return "balanced";
+        }
+    }
+
+    /**
+     * Connect to the bus once and locate the daemon; reused by every later call
+     */
+    bool ensureConnected()
+    {
+        if (m_connection.isConnected() && !m_busName.empty())
+        {
+            return true;
+        }
+
+        if (!m_connection.connect())
+        {
+            return false;
+        }
+        // A restarted daemon may offer the performance profile again
+        m_performanceRejected = false;
+
+        for (const auto& service : SERVICE_NAMES)
+        {
+            m_busName = service.busName;
+            m_objectPath = service.objectPath;
+            if (getActiveProfile())
+            {
+                Logger::debug("Found power-profiles-daemon as " + m_busName);
+                return true;
+            }
+        }
+
+        m_busName.clear();
+        m_objectPath.clear();
+        return false;
+    }
+
+    DBusMessage propertiesCall(const std::string& member) const
+    {
+        DBusMessage message;
+        message.destination = m_busName;
+        message.path = m_objectPath;
+        message.interface = "org.freedesktop.DBus.Properties";
+        message.member = member;
+        return message;
+    }
+
+    std::optional<std::string> getActiveProfile()
+    {
+        DBusMessage message = propertiesCall("Get");
+        message.signature = "ss";
+        DBusWriter body;
+        body.writeString(m_busName);
+        body.writeString("ActiveProfile");
+        message.body = body.data();
+
+        auto reply = m_connection.call(message);
+        if (!reply || reply->type != DBusMessage::METHOD_RETURN)
+        {
+            return std::nullopt;
+        }
+
+        std::string profile;
+        DBusReader reader = reply->bodyReader();
+        if (!reader.readVariant(profile))
+        {
+            return std::nullopt;
+        }
+        return profile;
+    }
+
+    bool setActiveProfile(const std::string& profile)
+    {
+        DBusMessage message = propertiesCall("Set");
+        message.signature = "ssv";
+        DBusWriter body;
+        body.writeString(m_busName);
+        body.writeString("ActiveProfile");
+        body.writeVariantString(profile);
+        message.body = body.data();
+
+        auto reply = m_connection.call(message);
+        if (!reply && ensureConnected())
+        {
+            // The daemon or bus may have restarted: reconnect once and retry
+            reply = m_connection.call(message);
+        }
+
+        if (!reply)
+        {
+            return false;
+        }
+        if (reply->type == DBusMessage::ERROR)
+        {
+            Logger::warning("power-profiles-daemon rejected " + profile + ": " + reply->errorName);
+            return false;
+        }
+        return true;
+    }
+
+    DBusConnection m_connection;
+    std::string m_busName;
+    std::string m_objectPath;
+    std::string m_lastProfile;
+    bool m_performanceRejected{false};  ///< daemon refused "performance"; balanced is used instead
+    std::string m_currentMode;
+    RateLimiter m_rateLimiter;
+    ActuationMetrics m_actuation;
+};
+
+// Factory function for creating the Linux power-profiles-daemon power manager
+std::unique_ptr<IPowerManager> createLinuxPpdPowerManager(const std::string& busAddress)
+{
+    return std::make_unique<LinuxPpdPowerManager>(busAddress);
+}
@@ -0,0 +1,164 @@
+#include "platform/isleep_monitor.h"
+#include "platform/linux/linux_power_backends.h"
+#include "logger.h"
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <optional>
+#include <poll.h>
+#include <string>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <thread>
+#include <unistd.h>
+
+/**
+ * Linux suspend detection
+ * CLOCK_BOOTTIME keeps counting during suspend and CLOCK_MONOTONIC does not, so
+ * their difference is the time spent suspended. Resume is noticed without
+ * polling: an absolute CLOCK_REALTIME timer armed with TFD_TIMER_CANCEL_ON_SET
+ * is cancelled by the kernel on every resume (and every clock set), which
+ * wakes the watcher thread blocked on it
+ */
+class LinuxSleepMonitor : public ISleepMonitor
+{
+public:
+    LinuxSleepMonitor() = default;
+
+    virtual ~LinuxSleepMonitor() override
+    {
+        stop();
+    }
+
+    LinuxSleepMonitor(const LinuxSleepMonitor&) = delete;
+    LinuxSleepMonitor& operator=(const LinuxSleepMonitor&) = delete;
+
+    std::optional<std::chrono::milliseconds> getSuspendedTime() override
+    {
+        timespec boot{};
+        timespec monotonic{};
+        if (clock_gettime(CLOCK_BOOTTIME, &boot) != 0 || clock_gettime(CLOCK_MONOTONIC, &monotonic) != 0)
+        {
+            return std::nullopt;
+        }
+        return std::chrono::duration_cast<std::chrono::milliseconds>(toDuration(boot) - toDuration(monotonic));
+    }
+
+    bool start(std::function<void()> onWake) override
+    {
+        if (m_thread.joinable())
+        {
+            return true;
+        }
+
+        m_timerFd = timerfd_create(CLOCK_REALTIME, TFD_CLOEXEC);
+        m_stopFd = eventfd(0, EFD_CLOEXEC);
+        if (m_timerFd < 0 || m_stopFd < 0 || !arm())
+        {
+            Logger::warning("Cannot watch for resume (" + std::string(strerror(errno)) +
+                            ") - suspend is only noticed at the next load check");
+            closeFds();
+            return false;
+        }
+
+        m_onWake = std::move(onWake);
+        m_thread = std::thread(&LinuxSleepMonitor::watch, this);
+        return true;
+    }
+
+    void stop() override
+    {
+        if (m_thread.joinable())
+        {
+            uint64_t one = 1;
+            if (write(m_stopFd, &one, sizeof(one)) != sizeof(one))
+            {
+                Logger::error("Failed to signal the resume watcher: " + std::string(strerror(errno)));
+            }
+            m_thread.join();
+        }
+        closeFds();
+    }
+
+private:
+    static std::chrono::nanoseconds toDuration(const timespec& time)
+    {
+        return std::chrono::seconds(time.tv_sec) + std::chrono::nanoseconds(time.tv_nsec);
+    }
+
+    /**
+     * Arm the timer a year ahead; it exists only to be cancelled
+     */
+    bool arm()
+    {
+        timespec now{};
+        if (clock_gettime(CLOCK_REALTIME, &now) != 0)
+        {
+            return false;
+        }
+
+        itimerspec spec{};
+        spec.it_value.tv_sec = now.tv_sec + 365 * 24 * 3600;
+        return timerfd_settime(m_timerFd, TFD_TIMER_ABSTIME | TFD_TIMER_CANCEL_ON_SET, &spec, nullptr) == 0;
+    }
+
+    void watch()
+    {
+        while (true)
+        {
+            pollfd fds[2] = {{m_timerFd, POLLIN, 0}, {m_stopFd, POLLIN, 0}};
+            if (poll(fds, 2, -1) < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                Logger::error("Resume watcher stopped: " + std::string(strerror(errno)));
+                return;
+            }
+            if (fds[1].revents != 0)
+            {
+                return;
+            }
+
+            // ECANCELED means the clock was set; a plain expiry only needs re-arming
+            uint64_t expirations = 0;
+            if (read(m_timerFd, &expirations, sizeof(expirations)) < 0 && errno == ECANCELED)
+            {
+                m_onWake();
+            }
+            if (!arm())
+            {
+                Logger::error("Resume watcher stopped: cannot re-arm the timer");
+                return;
+            }
+        }
+    }
+
+    void closeFds()
+    {
+        if (m_timerFd >= 0)
+        {
+            close(m_timerFd);
+            m_timerFd = -1;
+        }
+        if (m_stopFd >= 0)
+        {
+            close(m_stopFd);
+            m_stopFd = -1;
+        }
+    }
+
+    int m_timerFd{-1};
+    int m_stopFd{-1};
+    std::function<void()> m_onWake;
+    std::thread m_thread;
+};
+
+// Factory function for creating the Linux sleep monitor
+std::unique_ptr<ISleepMonitor> createLinuxSleepMonitor()
+{
+    return std::make_unique<LinuxSleepMonitor>();
+}
@@ -0,0 +1,257 @@
+#include "platform/ismt_controller.h"
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include "rate_limiter.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Linux SMT controller writing /sys/devices/system/cpu/smt/control
+ * SMT is switched off only in the power save tier, after several samples below
+ * the threshold, and never while a user space thread runs with a real-time policy,
+ * since halving the CPUs could starve it
+ */
+class LinuxSmtController : public ISmtController
+{
+public:
+    explicit LinuxSmtController(const std::string& rootPrefix)
+        : m_root{rootPrefix}
+        , m_offUtilization{0.0}
+        , m_tier{PowerTier::POWER_SAVE}
+        , m_smtOff{false}
+        , m_quietSamples{0}
+        , m_samplesSinceScan{0}
+        , m_realtimeThreads{false}
+        , m_rateLimiter(MAX_SWITCHES_PER_MINUTE, 60000)
+    {
+        // Rate limiter: max 2 SMT switches per 60000ms (60 seconds)
+    }
+
+    virtual ~LinuxSmtController() override = default;
+
+    bool initialize(double offUtilization) override
+    {
+        m_offUtilization = offUtilization;
+        auto state = LinuxSysfs::readAttribute(controlPath());
+        if (!state || *state != "on")
+        {
+            // off, forceoff, notsupported and notimplemented leave nothing to switch
+            Logger::debug("SMT control is " + state.value_or("unavailable") + " - not managing SMT");
+            return false;
+        }
+
+        Logger::info("SMT controller: SMT goes off below " + std::to_string(static_cast<int>(offUtilization * 100)) +
+                     "% utilization in the power save tier");
+        return true;
+    }
+
+    /**
+     * Switch SMT off after QUIET_SAMPLES quiet samples, and back on once the
+     * utilization of the remaining CPUs doubles the threshold or an RT thread appears
+     * Threads are scanned right before SMT goes off, then every REALTIME_SCAN_SAMPLES samples
+     * @param utilization busy fraction per CPU
+     */
+    void update(const std::vector<double>& utilization) override
+    {
+        double average = onlineAverage(utilization);
+        if (m_smtOff)
+        {
+            if (average > m_offUtilization * 2 || realtimeThreadsRunning(false))
+            {
+                switchSmt(true);
+            }
+            return;
+        }
+
+        m_quietSamples = (m_tier == PowerTier::POWER_SAVE && average < m_offUtilization) ? m_quietSamples + 1 : 0;
+        if (m_quietSamples < QUIET_SAMPLES)
+        {
+            return;
+        }
+        if (realtimeThreadsRunning(true))
+        {
+            Logger::debug("Real-time threads are running - keeping SMT on");
+            return;
+        }
+        if (!m_rateLimiter.isAllowed("smt_control"))
+        {
+            Logger::debug("SMT switch rate limited");
+            return;
+        }
+        switchSmt(false);
+    }
+
+    void setTier(PowerTier tier) override
+    {
+        m_tier = tier;
+        if (tier != PowerTier::POWER_SAVE)
+        {
+            m_quietSamples = 0;
+            if (m_smtOff)
+            {
+                switchSmt(true);
+            }
+        }
+    }
+
+    bool restore() override
+    {
+        return !m_smtOff || switchSmt(true);
+    }
+
+private:
+    static constexpr int QUIET_SAMPLES = 3;
+    static constexpr int REALTIME_SCAN_SAMPLES = 10;
+    static constexpr int MAX_SWITCHES_PER_MINUTE = 2;
+    static constexpr uint64_t PF_KTHREAD = 0x00200000;
+    static constexpr int SCHED_FIFO_POLICY = 1;
+    static constexpr int SCHED_RR_POLICY = 2;
+    static constexpr int SCHED_DEADLINE_POLICY = 6;
+
+    std::string controlPath() const
+    {
+        return m_root + "/sys/devices/system/cpu/smt/control";
+    }
+
+    /**
+     * Bringing siblings back is never rate limited, so leaving power save stays prompt
+     */
+    bool switchSmt(bool on)
+    {
+        if (!LinuxSysfs::writeAttribute(controlPath(), on ? "on" : "off"))
+        {
+            Logger::warning(std::string("Failed to switch SMT ") + (on ? "on" : "off"));
+            return false;
+        }
+        m_smtOff = !on;
+        m_quietSamples = 0;
+        Logger::info(std::string("SMT switched ") + (on ? "on" : "off"));
+        return true;
+    }
+
+    /**
+     * Average utilization of the online CPUs; offline siblings report no time
+     */
+    double onlineAverage(const std::vector<double>& utilization) const
+    {
+        std::vector<int> online = LinuxSysfs::parseCpuList(
+            LinuxSysfs::readAttribute(m_root + "/sys/devices/system/cpu/online").value_or(""));
+        double sum = 0.0;
+        int count = 0;
+        for (size_t cpu = 0; cpu < utilization.size(); ++cpu)
+        {
+            if (online.empty() || std::find(online.begin(), online.end(), static_cast<int>(cpu)) != online.end())
+            {
+                sum += utilization[cpu];
+                ++count;
+            }
+        }
+        return count > 0 ? sum / count : 0.0;
+    }
+
+    /**
+     * Last real-time thread scan, repeated every REALTIME_SCAN_SAMPLES samples since it reads
+     * the stat file of every thread
+     * @param confirmAbsence scan now unless the last scan found a thread, e.g. right before SMT goes off
+     */
+    bool realtimeThreadsRunning(bool confirmAbsence)
+    {
+        if (++m_samplesSinceScan >= REALTIME_SCAN_SAMPLES || (confirmAbsence && !m_realtimeThreads))
+        {
+            m_realtimeThreads = hasRealtimeThreads();
+            m_samplesSinceScan = 0;
+        }
+        return m_realtimeThreads;
+    }
+
+    /**
+     * Scan every user space thread for SCHED_FIFO, SCHED_RR or SCHED_DEADLINE
+     * Kernel threads (migration, watchdog, threaded IRQs) are real-time by design and ignored
+     */
+    bool hasRealtimeThreads() const
+    {
+        std::error_code ec;
+        for (std::filesystem::directory_iterator process(m_root + "/proc", ec), end; !ec && process != end; process.increment(ec))
+        {
+            std::string pid = process->path().filename().string();
+            if (pid.empty() || !std::all_of(pid.begin(), pid.end(), [](unsigned char c) { return std::isdigit(c); }))
+            {
+                continue;
+            }
+
+            std::error_code taskError;
+            for (std::filesystem::directory_iterator task(process->path() / "task", taskError), taskEnd;
+                 !taskError && task != taskEnd; task.increment(taskError))
+            {
+                if (isRealtimeUserThread(task->path().string() + "/stat"))
+                {
+                    Logger::debug("Real-time thread " + task->path().filename().string() + " of process " + pid);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    static bool isRealtimeUserThread(const std::string& statPath)
+    {
+        auto stat = LinuxSysfs::readAttribute(statPath);
+        if (!stat)
+        {
+            return false;
+        }
+
+        // The command name may contain spaces, so fields are counted after its closing parenthesis;
+        // field 3 (state) is the first, flags is field 9 and policy field 41
+        size_t nameEnd = stat->rfind(')');
+        if (nameEnd == std::string::npos)
+        {
+            return false;
+        }
+        std::istringstream fields(stat->substr(nameEnd + 1));
+        std::vector<std::string> values;
+        std::string value;
+        while (fields >> value)
+        {
+            values.push_back(value);
+        }
+        if (values.size() < 39)
+        {
+            return false;
+        }
+
+        try
+        {
+            uint64_t flags = std::stoull(values[6]);
+            int policy = std::stoi(values[38]);
+            bool realtime = policy == SCHED_FIFO_POLICY || policy == SCHED_RR_POLICY || policy == SCHED_DEADLINE_POLICY;
+            return realtime && (flags & PF_KTHREAD) == 0;
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+    }
+
+    std::string m_root;
+    double m_offUtilization;
+    PowerTier m_tier;
+    bool m_smtOff;          ///< true only while this controller holds SMT off
+    int m_quietSamples;
+    int m_samplesSinceScan;     ///< samples since the last real-time thread scan
+    bool m_realtimeThreads;     ///< result of that scan
+    RateLimiter m_rateLimiter;
+};
+
+// Factory function for creating the Linux SMT controller
+std::unique_ptr<ISmtController> createLinuxSmtController(const std::string& rootPrefix)
+{
+    return std::make_unique<LinuxSmtController>(rootPrefix);
+}
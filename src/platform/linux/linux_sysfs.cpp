@@ -0,0 +1,248 @@
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+std::optional<std::string> LinuxSysfs::readAttribute(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        return std::nullopt;
+    }
+
+    std::string value;
+    if (!std::getline(file, value))
+    {
+        // Empty attributes are valid (e.g. an unset list)
+        return std::string{};
+    }
+
+    while (!value.empty() && (value.back() == '\n' || value.back() == '\r' || value.back() == ' '))
+    {
+        value.pop_back();
+    }
+    return value;
+}
+
+bool LinuxSysfs::writeAttribute(const std::string& path, const std::string& value)
+{
+    int fd = open(path.c_str(), O_WRONLY | O_TRUNC | O_CLOEXEC);
+    if (fd < 0)
+    {
+        Logger::debug("Failed to open " + path + " for writing: " + std::strerror(errno));
+        return false;
+    }
+
+    ssize_t written = write(fd, value.data(), value.size());
+    int writeError = errno;
+    close(fd);
+
+    if (written != static_cast<ssize_t>(value.size()))
+    {
+        Logger::debug("Failed to write '" + value + "' to " + path + ": " + std::strerror(writeError));
+        return false;
+    }
+    return true;
+}
+
+int LinuxSysfs::openAttribute(const std::string& path)
+{
+    int fd = open(path.c_str(), O_RDWR | O_CLOEXEC);
+    if (fd < 0)
+    {
+        Logger::debug("Failed to open " + path + ": " + std::strerror(errno));
+    }
+    return fd;
+}
+
+std::optional<std::string> LinuxSysfs::readDescriptor(int fd)
+{
+    // sysfs and procfs regenerate the content on every read from offset 0
+    std::array<char, 4096> buffer;
+    ssize_t length = pread(fd, buffer.data(), buffer.size(), 0);
+    if (length < 0)
+    {
+        return std::nullopt;
+    }
+
+    std::string value(buffer.data(), static_cast<size_t>(length));
+    size_t newline = value.find('\n');
+    if (newline != std::string::npos)
+    {
+        value.erase(newline);
+    }
+    while (!value.empty() && (value.back() == '\r' || value.back() == ' '))
+    {
+        value.pop_back();
+    }
+    return value;
+}
+
+bool LinuxSysfs::writeDescriptor(int fd, const std::string& value)
+{
+    // Truncate like writeAttribute's O_TRUNC; attributes ignore it, plain files need it
+    if (ftruncate(fd, 0) != 0)
+    {
+        Logger::debug("Failed to truncate attribute descriptor: " + std::string(std::strerror(errno)));
+    }
+
+    ssize_t written = pwrite(fd, value.data(), value.size(), 0);
+    if (written != static_cast<ssize_t>(value.size()))
+    {
+        Logger::debug("Failed to write '" + value + "' through descriptor: " + std::strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+bool LinuxSysfs::exists(const std::string& path)
+{
+    std::error_code ec;
+    return fs::exists(path, ec);
+}
+
+std::vector<std::string> LinuxSysfs::listCpufreqPolicies(const std::string& cpuRoot)
+{
+    std::vector<std::pair<int, std::string>> policies;
+    std::error_code ec;
+    fs::path cpufreqDir = fs::path(cpuRoot) / "cpufreq";
+
+    for (fs::directory_iterator it(cpufreqDir, ec), end; !ec && it != end; it.increment(ec))
+    {
+        std::string name = it->path().filename().string();
+        if (!name.starts_with("policy"))
+        {
+            continue;
+        }
+        try
+        {
+            policies.emplace_back(std::stoi(name.substr(6)), it->path().string());
+        }
+        catch (const std::exception&)
+        {
+            // Ignore unexpected entries
+        }
+    }
+
+    std::sort(policies.begin(), policies.end());
+
+    std::vector<std::string> result;
+    result.reserve(policies.size());
+    for (const auto& policy : policies)
+    {
+        result.push_back(policy.second);
+    }
+    return result;
+}
+
+std::vector<int> LinuxSysfs::readPolicyCpus(const std::string& policy)
+{
+    auto cpuList = readAttribute(policy + "/related_cpus");
+    if (!cpuList || cpuList->empty())
+    {
+        cpuList = readAttribute(policy + "/affected_cpus");
+    }
+
+    // Policy lists are space separated, unlike the range lists parsed below
+    std::vector<int> cpus;
+    std::istringstream stream(cpuList.value_or(""));
+    int cpu;
+    while (stream >> cpu)
+    {
+        cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+std::vector<int> LinuxSysfs::parseCpuList(const std::string& list)
+{
+    std::vector<int> cpus;
+    std::istringstream stream(list);
+    std::string range;
+
+    while (std::getline(stream, range, ','))
+    {
+        range.erase(std::remove_if(range.begin(), range.end(), [](unsigned char c) { return std::isspace(c); }), range.end());
+        if (range.empty())
+        {
+            continue;
+        }
+        try
+        {
+            size_t dash = range.find('-');
+            int first = std::stoi(range.substr(0, dash));
+            int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            if (first < 0 || last < first)
+            {
+                return {};
+            }
+            for (int cpu = first; cpu <= last; ++cpu)
+            {
+                cpus.push_back(cpu);
+            }
+        }
+        catch (const std::exception&)
+        {
+            return {};
+        }
+    }
+    return cpus;
+}
+
+std::vector<std::string> LinuxSysfs::findCpuThermalZones(const std::string& thermalRoot)
+{
+    static const std::vector<std::string> cpuZoneTypes = {"x86_pkg_temp", "cpu-thermal", "cpu_thermal", "soc_thermal"};
+
+    std::vector<std::string> cpuZones;
+    std::vector<std::string> allZones;
+    std::error_code ec;
+    for (fs::directory_iterator it(thermalRoot, ec), end; !ec && it != end; it.increment(ec))
+    {
+        std::string zone = it->path().string();
+        if (!it->path().filename().string().starts_with("thermal_zone") || !exists(zone + "/temp"))
+        {
+            continue;
+        }
+        allZones.push_back(zone);
+        std::string type = readAttribute(zone + "/type").value_or("");
+        if (std::find(cpuZoneTypes.begin(), cpuZoneTypes.end(), type) != cpuZoneTypes.end())
+        {
+            cpuZones.push_back(zone);
+        }
+    }
+    return cpuZones.empty() ? allZones : cpuZones;
+}
+
+std::optional<double> LinuxSysfs::readHottestTemperature(const std::vector<std::string>& zones)
+{
+    std::optional<double> hottest;
+    for (const auto& zone : zones)
+    {
+        auto value = readAttribute(zone + "/temp");
+        if (!value)
+        {
+            continue;
+        }
+        try
+        {
+            double celsius = std::stod(*value) / 1000.0;
+            hottest = std::max(hottest.value_or(celsius), celsius);
+        }
+        catch (const std::exception&)
+        {
+            // Zones report errors as non-numeric values; skip them
+        }
+    }
+    return hottest;
+}
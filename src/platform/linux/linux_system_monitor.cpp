@@ -1,23 +1,37 @@
 #include "platform/isystem_monitor.h"
+#include "platform/linux/linux_sysfs.h"
 #include "logger.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <filesystem>
 #include <fstream>
+#include <iomanip>
+#include <map>
+#include <set>
 #include <sstream>
 #include <memory>
+#include <optional>
 #include <tuple>
 #include <string>
 
 /**
  * Linux-specific system monitor implementation
- * Uses /proc/loadavg and /proc/cpuinfo for system monitoring
+ * Uses /proc/loadavg and /proc/cpuinfo for system monitoring, /proc/stat for
+ * per-CPU utilization, the cpufreq policies for control domains and the CPU
+ * topology attributes for core types and capacities
  */
 class LinuxSystemMonitor : public ISystemMonitor
 {
 public:
-    LinuxSystemMonitor() : m_coreCount(0), m_available(false)
+    explicit LinuxSystemMonitor(const std::string& rootPrefix)
+        : m_root(rootPrefix), m_coreCount(0), m_available(false)
     {
         // Initialize and cache core count
         m_coreCount = readCpuCoreCount();
         m_available = (m_coreCount > 0) && checkProcLoadavgAccess();
+        m_topology = readCpuTopology();
+        m_onlineCpus = readOnlineCpus();
     }
 
     virtual ~LinuxSystemMonitor() override = default;
@@ -28,32 +42,7 @@ public:
      */
     double getLoadAverage() override
     {
-        std::ifstream file("/proc/loadavg");
-        if (!file.is_open())
-        {
-            Logger::error("Failed to open /proc/loadavg");
-            return 0.0;
-        }
-
-        std::string line;
-        if (!std::getline(file, line))
-        {
-            Logger::error("Failed to read from /proc/loadavg");
-            return 0.0;
-        }
-
-        // Parse the first load average
-        // Format: "0.15 0.12 0.08 1/123 1234"
-        std::istringstream iss(line);
-        double load1min;
-        
-        if (!(iss >> load1min))
-        {
-            Logger::error("Failed to parse load average from /proc/loadavg");
-            return 0.0;
-        }
-
-        return load1min;
+        return readLoadAverage();
     }
 
     /**
@@ -86,14 +75,263 @@ public:
         Logger::debug("Linux system monitor uses kernel load average (monitoring frequency ignored)");
     }
 
+    /**
+     * Topology read from sysfs at construction
+     * @return per-CPU core type, capacity, package, core, cache and SMT siblings
+     */
+    CpuTopology getCpuTopology() override
+    {
+        return m_topology;
+    }
+
+    /**
+     * Compare the online CPU list with the previous one and re-read the core
+     * count and topology when it changed
+     * @return true if CPUs went on- or offline
+     */
+    bool refreshOnlineCpus() override
+    {
+        std::string online = readOnlineCpus();
+        if (online.empty() || online == m_onlineCpus)
+        {
+            return false;
+        }
+
+        Logger::info("Online CPUs changed from " + m_onlineCpus + " to " + online);
+        m_onlineCpus = online;
+        m_coreCount = readCpuCoreCount();
+        m_topology = readCpuTopology();
+        return true;
+    }
+
+    /**
+     * Load and CPU topology summary
+     * @param metricsBuffer span to fill with comma separated key=value pairs
+     * @return number of bytes written to buffer
+     */
+    size_t getSystemMetrics(std::span<char> metricsBuffer) const override
+    {
+        std::ostringstream metrics;
+        metrics << std::fixed << std::setprecision(2) << "load=" << readLoadAverage() << ",cores=" << m_coreCount;
+        if (!m_topology.empty())
+        {
+            metrics << ",physical_cores=" << m_topology.getPhysicalCoreCount()
+                    << ",pcores=" << m_topology.countCpus(CoreType::PERFORMANCE)
+                    << ",ecores=" << m_topology.countCpus(CoreType::EFFICIENCY)
+                    << ",packages=" << m_topology.getPackageCount()
+                    << ",capacity=" << m_topology.getCapacity();
+        }
+
+        std::string text = metrics.str();
+        if (metricsBuffer.size() < text.size())
+        {
+            return 0;
+        }
+        std::copy_n(text.data(), text.size(), metricsBuffer.data());
+        return text.size();
+    }
+
+    /**
+     * Control domains at the requested scope
+     * @param scope CPUFREQ_POLICY for one domain per policy, PACKAGE for one per socket
+     * @return domains in policy or package order, empty for SYSTEM
+     */
+    std::vector<ControlDomain> getControlDomains(ControlDomainScope scope) override
+    {
+        switch (scope)
+        {
+            case ControlDomainScope::CPUFREQ_POLICY: return getPolicyDomains();
+            case ControlDomainScope::PACKAGE:        return getPackageDomains();
+            default:                                 return {};
+        }
+    }
+
+    /**
+     * Per-CPU busy fraction from the /proc/stat counters since the previous call
+     * @param utilization filled with the busy fraction, indexed by CPU number
+     * @return false on the first call or if /proc/stat cannot be read
+     */
+    bool sampleCpuUtilization(std::vector<double>& utilization) override
+    {
+        std::ifstream file(m_root + "/proc/stat");
+        if (!file.is_open())
+        {
+            Logger::error("Failed to open /proc/stat");
+            return false;
+        }
+
+        std::vector<CpuTimes> current;
+        std::string line;
+        while (std::getline(file, line))
+        {
+            // Per-CPU lines are "cpuN user nice system idle iowait irq softirq steal ..."
+            if (!line.starts_with("cpu") || line.size() < 4 || line[3] < '0' || line[3] > '9')
+            {
+                continue;
+            }
+
+            std::istringstream stream(line.substr(3));
+            size_t cpu;
+            uint64_t user = 0, nice = 0, system = 0, idle = 0, iowait = 0, irq = 0, softirq = 0, steal = 0;
+            if (!(stream >> cpu >> user >> nice >> system >> idle))
+            {
+                continue;
+            }
+            stream >> iowait >> irq >> softirq >> steal;
+
+            if (current.size() <= cpu)
+            {
+                current.resize(cpu + 1);
+            }
+            uint64_t idleTime = idle + iowait;
+            current[cpu] = {user + nice + system + irq + softirq + steal + idleTime, idleTime, true};
+        }
+
+        bool hasPrevious = !m_previousTimes.empty();
+        utilization.assign(current.size(), 0.0);
+        for (size_t cpu = 0; hasPrevious && cpu < current.size() && cpu < m_previousTimes.size(); ++cpu)
+        {
+            const CpuTimes& now = current[cpu];
+            const CpuTimes& before = m_previousTimes[cpu];
+            if (!now.online || !before.online || now.total <= before.total)
+            {
+                continue;
+            }
+            uint64_t total = now.total - before.total;
+            uint64_t idle = now.idle >= before.idle ? now.idle - before.idle : 0;
+            utilization[cpu] = static_cast<double>(total - std::min(idle, total)) / static_cast<double>(total);
+        }
+
+        m_previousTimes = std::move(current);
+        return hasPrevious;
+    }
+
 private:
+    /**
+     * One control domain per cpufreq policy, built from its related_cpus
+     */
+    std::vector<ControlDomain> getPolicyDomains() const
+    {
+        std::vector<ControlDomain> domains;
+        for (const auto& policy : LinuxSysfs::listCpufreqPolicies(m_root + "/sys/devices/system/cpu"))
+        {
+            ControlDomain domain;
+            domain.name = policy.substr(policy.find_last_of('/') + 1);
+            domain.cpus = LinuxSysfs::readPolicyCpus(policy);
+            if (!domain.cpus.empty())
+            {
+                domains.push_back(std::move(domain));
+            }
+        }
+        return domains;
+    }
+
+    /**
+     * One control domain per package, built from the NUMA node cpulists
+     * Nodes are merged into the package of their CPUs, so sub-NUMA clustering
+     * still yields one domain per socket. Without NUMA information the CPU
+     * topology's package ids are used directly
+     */
+    std::vector<ControlDomain> getPackageDomains() const
+    {
+        std::map<int, std::set<int>> packageCpus;
+        std::map<int, std::set<int>> packageNodes;
+
+        std::map<int, std::string> nodes;
+        std::error_code ec;
+        for (std::filesystem::directory_iterator it(m_root + "/sys/devices/system/node", ec), end; !ec && it != end; it.increment(ec))
+        {
+            std::string name = it->path().filename().string();
+            if (name.size() > 4 && name.starts_with("node") &&
+                std::all_of(name.begin() + 4, name.end(), [](unsigned char c) { return std::isdigit(c); }))
+            {
+                nodes[std::stoi(name.substr(4))] = it->path().string();
+            }
+        }
+
+        for (const auto& [node, path] : nodes)
+        {
+            // Memory-only nodes have an empty cpulist
+            for (int cpu : LinuxSysfs::parseCpuList(LinuxSysfs::readAttribute(path + "/cpulist").value_or("")))
+            {
+                const CpuInfo* info = m_topology.find(cpu);
+                if (!info)
+                {
+                    continue;
+                }
+                packageCpus[info->package].insert(cpu);
+                packageNodes[info->package].insert(node);
+            }
+        }
+
+        if (packageCpus.empty())
+        {
+            for (const auto& info : m_topology.getCpus())
+            {
+                packageCpus[info.package].insert(info.cpu);
+            }
+        }
+
+        std::vector<ControlDomain> domains;
+        for (const auto& [package, cpus] : packageCpus)
+        {
+            ControlDomain domain;
+            domain.name = "package" + std::to_string(package);
+            domain.cpus.assign(cpus.begin(), cpus.end());
+            domain.scope = ControlDomainScope::PACKAGE;
+            domain.package = package;
+            std::string nodeList;
+            for (int node : packageNodes[package])
+            {
+                nodeList += (nodeList.empty() ? " on NUMA node(s) " : ",") + std::to_string(node);
+            }
+            Logger::debug("Package domain " + domain.name + ": " + std::to_string(domain.cpus.size()) + " CPU(s)" + nodeList);
+            domains.push_back(std::move(domain));
+        }
+        return domains;
+    }
+
+    /**
+     * Read the 1-minute load average from /proc/loadavg
+     * @return load average, 0.0 on error
+     */
+    double readLoadAverage() const
+    {
+        std::ifstream file(m_root + "/proc/loadavg");
+        if (!file.is_open())
+        {
+            Logger::error("Failed to open /proc/loadavg");
+            return 0.0;
+        }
+
+        std::string line;
+        if (!std::getline(file, line))
+        {
+            Logger::error("Failed to read from /proc/loadavg");
+            return 0.0;
+        }
+
+        // Parse the first load average
+        // Format: "0.15 0.12 0.08 1/123 1234"
+        std::istringstream iss(line);
+        double load1min;
+        
+        if (!(iss >> load1min))
+        {
+            Logger::error("Failed to parse load average from /proc/loadavg");
+            return 0.0;
+        }
+
+        return load1min;
+    }
+
     /**
      * Read CPU core count from /proc/cpuinfo
      * @return number of CPU cores
      */
     int readCpuCoreCount()
     {
-        std::ifstream file("/proc/cpuinfo");
+        std::ifstream file(m_root + "/proc/cpuinfo");
         if (!file.is_open())
         {
             Logger::error("Failed to open /proc/cpuinfo");
@@ -121,13 +359,21 @@ private:
         return coreCount;
     }
 
+    /**
+     * @return contents of the online CPU list, empty if unavailable
+     */
+    std::string readOnlineCpus() const
+    {
+        return LinuxSysfs::readAttribute(m_root + "/sys/devices/system/cpu/online").value_or("");
+    }
+
     /**
      * Check if /proc/loadavg is accessible
      * @return true if we can read /proc/loadavg
      */
     bool checkProcLoadavgAccess()
     {
-        std::ifstream file("/proc/loadavg");
+        std::ifstream file(m_root + "/proc/loadavg");
         bool accessible = file.is_open();
         
         if (!accessible)
@@ -138,12 +384,113 @@ private:
         return accessible;
     }
 
+    /**
+     * Read core types, capacities and layout of the online CPUs
+     * Core types come from the hybrid PMUs (cpu_core, cpu_atom). Capacity is
+     * cpu_capacity where the kernel exports it; otherwise hybrid machines fall
+     * back to the cpuinfo_max_freq ratio and homogeneous ones to equal capacity
+     * @return topology, empty if no CPU exposes a topology directory
+     */
+    CpuTopology readCpuTopology() const
+    {
+        std::string cpuRoot = m_root + "/sys/devices/system/cpu";
+        std::vector<int> performanceCpus = LinuxSysfs::parseCpuList(
+            LinuxSysfs::readAttribute(m_root + "/sys/devices/cpu_core/cpus").value_or(""));
+        std::vector<int> efficiencyCpus = LinuxSysfs::parseCpuList(
+            LinuxSysfs::readAttribute(m_root + "/sys/devices/cpu_atom/cpus").value_or(""));
+        bool typed = !performanceCpus.empty() && !efficiencyCpus.empty();
+
+        std::vector<int> online = LinuxSysfs::parseCpuList(readOnlineCpus());
+        std::vector<CpuInfo> cpus;
+        std::error_code ec;
+        for (std::filesystem::directory_iterator it(cpuRoot, ec), end; !ec && it != end; it.increment(ec))
+        {
+            std::string name = it->path().filename().string();
+            if (name.size() < 4 || !name.starts_with("cpu") ||
+                !std::all_of(name.begin() + 3, name.end(), [](unsigned char c) { return std::isdigit(c); }))
+            {
+                continue;
+            }
+
+            // Offline CPUs are missing from the online list, or have no topology directory
+            int cpu = std::stoi(name.substr(3));
+            std::string cpuDir = it->path().string();
+            auto package = readInt(cpuDir + "/topology/physical_package_id");
+            auto core = readInt(cpuDir + "/topology/core_id");
+            if (!package || !core || (!online.empty() && std::find(online.begin(), online.end(), cpu) == online.end()))
+            {
+                continue;
+            }
+
+            CpuInfo info;
+            info.cpu = cpu;
+            info.package = *package;
+            info.core = *core;
+            info.cacheId = readInt(cpuDir + "/cache/index3/id").value_or(readInt(cpuDir + "/cache/index2/id").value_or(-1));
+            info.smtSiblings = LinuxSysfs::parseCpuList(
+                LinuxSysfs::readAttribute(cpuDir + "/topology/thread_siblings_list").value_or(""));
+
+            if (typed)
+            {
+                bool performance = std::find(performanceCpus.begin(), performanceCpus.end(), info.cpu) != performanceCpus.end();
+                bool efficiency = std::find(efficiencyCpus.begin(), efficiencyCpus.end(), info.cpu) != efficiencyCpus.end();
+                info.type = performance ? CoreType::PERFORMANCE : efficiency ? CoreType::EFFICIENCY : CoreType::UNKNOWN;
+            }
+
+            // CpuTopology normalises, so raw capacities and frequencies both work
+            if (auto capacity = readInt(cpuDir + "/cpu_capacity"))
+            {
+                info.capacity = *capacity;
+            }
+            else if (auto maxFrequency = typed ? readInt(cpuDir + "/cpufreq/cpuinfo_max_freq") : std::nullopt)
+            {
+                info.capacity = *maxFrequency;
+            }
+            cpus.push_back(std::move(info));
+        }
+
+        CpuTopology topology(std::move(cpus));
+        if (!topology.empty())
+        {
+            Logger::debug("CPU topology: " + topology.describe());
+        }
+        return topology;
+    }
+
+    static std::optional<int> readInt(const std::string& path)
+    {
+        auto value = LinuxSysfs::readAttribute(path);
+        if (!value)
+        {
+            return std::nullopt;
+        }
+        try
+        {
+            return std::stoi(*value);
+        }
+        catch (const std::exception&)
+        {
+            return std::nullopt;
+        }
+    }
+
+    struct CpuTimes
+    {
+        uint64_t total{0};
+        uint64_t idle{0};
+        bool online{false};     ///< offline CPUs have no line in /proc/stat
+    };
+
+    std::string m_root;
     int m_coreCount;
     bool m_available;
+    std::vector<CpuTimes> m_previousTimes;
+    std::string m_onlineCpus;               ///< last online CPU list, e.g. "0-7"
+    CpuTopology m_topology;
 };
 
 // Factory function for creating Linux system monitor
-std::unique_ptr<ISystemMonitor> createLinuxSystemMonitor()
+std::unique_ptr<ISystemMonitor> createLinuxSystemMonitor(const std::string& rootPrefix)
 {
-    return std::make_unique<LinuxSystemMonitor>();
+    return std::make_unique<LinuxSystemMonitor>(rootPrefix);
 }
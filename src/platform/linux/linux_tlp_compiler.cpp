@@ -0,0 +1,398 @@
+#include "platform/linux/linux_tlp_compiler.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // Parameters with _ON_AC/_ON_BAT variants that compile to native writes
+    const std::array<std::string, 13> SUPPORTED_PROFILE_PARAMETERS = {
+        "CPU_SCALING_GOVERNOR", "CPU_ENERGY_PERF_POLICY", "CPU_SCALING_MIN_FREQ",
+        "CPU_SCALING_MAX_FREQ", "CPU_MIN_PERF", "CPU_MAX_PERF", "CPU_BOOST",
+        "CPU_HWP_DYN_BOOST", "PLATFORM_PROFILE", "MEM_SLEEP", "PCIE_ASPM",
+        "RUNTIME_PM", "SOUND_POWER_SAVE",
+    };
+
+    // TLP's built-in driver deny list, used when the configuration does not set one
+    const std::string DEFAULT_RUNTIME_PM_DRIVER_DENYLIST = "mei_me nouveau radeon";
+
+    std::vector<std::string> splitWords(const std::string& value)
+    {
+        std::vector<std::string> words;
+        std::istringstream stream(value);
+        std::string word;
+        while (stream >> word)
+        {
+            words.push_back(word);
+        }
+        return words;
+    }
+
+    bool contains(const std::vector<std::string>& words, const std::string& word)
+    {
+        return std::find(words.begin(), words.end(), word) != words.end();
+    }
+}
+
+LinuxTlpCompiler::LinuxTlpCompiler(std::string rootPrefix)
+    : m_root{std::move(rootPrefix)}
+{
+}
+
+bool LinuxTlpCompiler::load()
+{
+    m_parameters.clear();
+
+    // Same precedence as TLP: intrinsic defaults, drop-ins in lexical order, user configuration
+    loadFile(path("/usr/share/tlp/defaults.conf"), true);
+
+    bool foundUserConfiguration = false;
+    std::vector<std::string> dropIns;
+    std::error_code ec;
+    for (fs::directory_iterator it(path("/etc/tlp.d"), ec), end; !ec && it != end; it.increment(ec))
+    {
+        if (it->path().extension() == ".conf")
+        {
+            dropIns.push_back(it->path().string());
+        }
+    }
+    std::sort(dropIns.begin(), dropIns.end());
+    for (const auto& dropIn : dropIns)
+    {
+        foundUserConfiguration |= loadFile(dropIn);
+    }
+
+    // TLP before 1.3 kept the configuration in /etc/default/tlp
+    if (!loadFile(path("/etc/tlp.conf")))
+    {
+        foundUserConfiguration |= loadFile(path("/etc/default/tlp"));
+    }
+    else
+    {
+        foundUserConfiguration = true;
+    }
+
+    Logger::debug("TLP configuration: " + std::to_string(m_parameters.size()) + " parameters from " +
+                  std::to_string(dropIns.size()) + " drop-in(s)");
+    return foundUserConfiguration;
+}
+
+bool LinuxTlpCompiler::loadFile(const std::string& filePath, bool intrinsic)
+{
+    std::ifstream file(filePath);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        lineNumber++;
+
+        std::string name;
+        std::string value;
+        bool append = false;
+        if (!parseLine(line, name, value, append))
+        {
+            Logger::debug("Ignoring TLP configuration line " + std::to_string(lineNumber) + " in " + filePath);
+            continue;
+        }
+        if (name.empty())
+        {
+            continue;  // Blank line or comment
+        }
+
+        Parameter& parameter = m_parameters[name];
+        if (append && !parameter.value.empty() && !value.empty())
+        {
+            parameter.value += " " + value;
+        }
+        else if (append)
+        {
+            parameter.value += value;
+        }
+        else
+        {
+            parameter.value = value;
+        }
+        parameter.intrinsic = intrinsic;
+    }
+    return true;
+}
+
+std::optional<std::string> LinuxTlpCompiler::getParameter(const std::string& name) const
+{
+    auto it = m_parameters.find(name);
+    if (it == m_parameters.end())
+    {
+        return std::nullopt;
+    }
+    return it->second.value;
+}
+
+bool LinuxTlpCompiler::isEnabled() const
+{
+    return getParameter("TLP_ENABLE").value_or("1") != "0";
+}
+
+CompiledTlpProfile LinuxTlpCompiler::compile(TlpProfile profile) const
+{
+    CompiledTlpProfile result;
+    const std::string suffix = (profile == TlpProfile::AC) ? "_ON_AC" : "_ON_BAT";
+
+    for (const auto& [name, parameter] : m_parameters)
+    {
+        if (!name.ends_with(suffix) || parameter.intrinsic || parameter.value.empty())
+        {
+            continue;
+        }
+        std::string base = name.substr(0, name.size() - suffix.size());
+        if (std::find(SUPPORTED_PROFILE_PARAMETERS.begin(), SUPPORTED_PROFILE_PARAMETERS.end(), base) ==
+            SUPPORTED_PROFILE_PARAMETERS.end())
+        {
+            result.unsupported.push_back(name);
+        }
+    }
+
+    // Platform profile first: firmware may reset CPU settings when it changes
+    if (auto value = getNonEmpty("PLATFORM_PROFILE" + suffix))
+    {
+        addWrite(result, path("/sys/firmware/acpi/platform_profile"), *value, "PLATFORM_PROFILE" + suffix,
+                 STAGE_PLATFORM_PROFILE);
+    }
+
+    compileCpu(suffix, result);
+
+    if (auto value = getNonEmpty("MEM_SLEEP" + suffix))
+    {
+        addWrite(result, path("/sys/power/mem_sleep"), *value, "MEM_SLEEP" + suffix);
+    }
+
+    if (auto value = getNonEmpty("PCIE_ASPM" + suffix))
+    {
+        addWrite(result, path("/sys/module/pcie_aspm/parameters/policy"), *value, "PCIE_ASPM" + suffix);
+    }
+
+    if (auto value = getNonEmpty("SOUND_POWER_SAVE" + suffix))
+    {
+        for (const char* module : {"snd_hda_intel", "snd_ac97_codec"})
+        {
+            std::string parameters = path("/sys/module/") + module + "/parameters/";
+            addWrite(result, parameters + "power_save", *value, "SOUND_POWER_SAVE" + suffix);
+
+            // Like TLP, the controller only powers down together with the codec
+            std::string controller = (*value == "0") ? "N" : getNonEmpty("SOUND_POWER_SAVE_CONTROLLER").value_or("Y");
+            addWrite(result, parameters + "power_save_controller", controller, "SOUND_POWER_SAVE_CONTROLLER");
+        }
+    }
+
+    if (auto value = getNonEmpty("RUNTIME_PM" + suffix))
+    {
+        compileRuntimePm(*value, result);
+    }
+
+    return result;
+}
+
+void LinuxTlpCompiler::compileCpu(const std::string& suffix, CompiledTlpProfile& result) const
+{
+    std::string cpuRoot = path("/sys/devices/system/cpu");
+    std::vector<std::string> policies = LinuxSysfs::listCpufreqPolicies(cpuRoot);
+
+    auto governor = getNonEmpty("CPU_SCALING_GOVERNOR" + suffix);
+    if (governor)
+    {
+        for (const auto& policy : policies)
+        {
+            addWrite(result, policy + "/scaling_governor", *governor, "CPU_SCALING_GOVERNOR" + suffix, STAGE_GOVERNOR);
+        }
+    }
+
+    for (const char* limit : {"MIN", "MAX"})
+    {
+        std::string parameter = std::string("CPU_SCALING_") + limit + "_FREQ" + suffix;
+        if (auto value = getNonEmpty(parameter))
+        {
+            std::string attribute = (std::string(limit) == "MIN") ? "/scaling_min_freq" : "/scaling_max_freq";
+            for (const auto& policy : policies)
+            {
+                addWrite(result, policy + attribute, *value, parameter);
+            }
+        }
+    }
+
+    // intel_pstate clamps min_perf_pct to max_perf_pct and vice versa, so min, max, min
+    // reaches the target from any previous pair
+    auto minPerf = getNonEmpty("CPU_MIN_PERF" + suffix);
+    auto maxPerf = getNonEmpty("CPU_MAX_PERF" + suffix);
+    std::string minPerfPath = cpuRoot + "/intel_pstate/min_perf_pct";
+    std::string maxPerfPath = cpuRoot + "/intel_pstate/max_perf_pct";
+    if (minPerf)
+    {
+        addWrite(result, minPerfPath, *minPerf, "CPU_MIN_PERF" + suffix, STAGE_INDEPENDENT, true);
+    }
+    if (maxPerf)
+    {
+        addWrite(result, maxPerfPath, *maxPerf, "CPU_MAX_PERF" + suffix, STAGE_MAX_PERF, true);
+        if (minPerf)
+        {
+            addWrite(result, minPerfPath, *minPerf, "CPU_MIN_PERF" + suffix, STAGE_MIN_PERF_AGAIN, true);
+        }
+    }
+
+    if (auto boost = getNonEmpty("CPU_BOOST" + suffix))
+    {
+        if (LinuxSysfs::exists(cpuRoot + "/intel_pstate/no_turbo"))
+        {
+            addWrite(result, cpuRoot + "/intel_pstate/no_turbo", *boost == "0" ? "1" : "0", "CPU_BOOST" + suffix);
+        }
+        else
+        {
+            addWrite(result, cpuRoot + "/cpufreq/boost", *boost == "0" ? "0" : "1", "CPU_BOOST" + suffix);
+        }
+    }
+
+    if (auto dynamicBoost = getNonEmpty("CPU_HWP_DYN_BOOST" + suffix))
+    {
+        addWrite(result, cpuRoot + "/intel_pstate/hwp_dynamic_boost", *dynamicBoost, "CPU_HWP_DYN_BOOST" + suffix);
+    }
+
+    // EPP is pinned by the kernel while the performance governor is active
+    auto epp = getNonEmpty("CPU_ENERGY_PERF_POLICY" + suffix);
+    if (epp && governor.value_or("") != "performance")
+    {
+        std::string value = (*epp == "balance-performance") ? "balance_performance"
+                          : (*epp == "balance-power") ? "balance_power" : *epp;
+        for (const auto& policy : policies)
+        {
+            addWrite(result, policy + "/energy_performance_preference", value, "CPU_ENERGY_PERF_POLICY" + suffix);
+        }
+    }
+}
+
+void LinuxTlpCompiler::compileRuntimePm(const std::string& value, CompiledTlpProfile& result) const
+{
+    const std::string& mode = value;
+    if (mode != "auto" && mode != "on")
+    {
+        Logger::warning("Ignoring invalid TLP RUNTIME_PM value: " + value);
+        return;
+    }
+
+    std::vector<std::string> denyDevices = splitWords(getParameter("RUNTIME_PM_DENYLIST")
+                                                          .value_or(getParameter("RUNTIME_PM_BLACKLIST").value_or("")));
+    std::vector<std::string> denyDrivers = splitWords(getParameter("RUNTIME_PM_DRIVER_DENYLIST")
+                                                          .value_or(getParameter("RUNTIME_PM_DRIVER_BLACKLIST")
+                                                                        .value_or(DEFAULT_RUNTIME_PM_DRIVER_DENYLIST)));
+    std::vector<std::string> alwaysAuto = splitWords(getParameter("RUNTIME_PM_ENABLE").value_or(""));
+    std::vector<std::string> alwaysOn = splitWords(getParameter("RUNTIME_PM_DISABLE").value_or(""));
+
+    std::vector<fs::path> devices;
+    std::error_code ec;
+    for (fs::directory_iterator it(path("/sys/bus/pci/devices"), ec), end; !ec && it != end; it.increment(ec))
+    {
+        devices.push_back(it->path());
+    }
+    std::sort(devices.begin(), devices.end());
+
+    for (const auto& device : devices)
+    {
+        // PCI addresses in the lists omit the domain: 0000:00:1f.3 -> 00:1f.3
+        std::string address = device.filename().string();
+        std::string shortAddress = address.size() > 5 ? address.substr(5) : address;
+        bool denied = contains(denyDevices, address) || contains(denyDevices, shortAddress);
+
+        std::string control = mode;
+        if (contains(alwaysAuto, address) || contains(alwaysAuto, shortAddress))
+        {
+            control = "auto";
+        }
+        else if (contains(alwaysOn, address) || contains(alwaysOn, shortAddress))
+        {
+            control = "on";
+        }
+        else
+        {
+            std::string driver = fs::read_symlink(device / "driver", ec).filename().string();
+            if (denied || (!ec && contains(denyDrivers, driver)))
+            {
+                continue;
+            }
+        }
+
+        addWrite(result, (device / "power" / "control").string(), control, "RUNTIME_PM");
+    }
+}
+
+void LinuxTlpCompiler::addWrite(CompiledTlpProfile& result, const std::string& attributePath,
+                                const std::string& value, const std::string& parameter, int stage, bool readBack) const
+{
+    // Attributes missing on this machine are skipped, as TLP does
+    if (LinuxSysfs::exists(attributePath))
+    {
+        result.writes.push_back({attributePath, value, parameter, stage, readBack});
+    }
+}
+
+std::optional<std::string> LinuxTlpCompiler::getNonEmpty(const std::string& name) const
+{
+    auto value = getParameter(name);
+    if (!value || value->empty())
+    {
+        return std::nullopt;
+    }
+    return value;
+}
+
+bool LinuxTlpCompiler::parseLine(const std::string& line, std::string& name, std::string& value, bool& append)
+{
+    size_t pos = line.find_first_not_of(" \t");
+    if (pos == std::string::npos || line[pos] == '#')
+    {
+        return true;
+    }
+
+    size_t nameEnd = pos;
+    while (nameEnd < line.size() &&
+           (std::isalnum(static_cast<unsigned char>(line[nameEnd])) || line[nameEnd] == '_'))
+    {
+        ++nameEnd;
+    }
+    if (nameEnd == pos || nameEnd >= line.size())
+    {
+        return false;
+    }
+
+    append = line[nameEnd] == '+';
+    size_t equalPos = append ? nameEnd + 1 : nameEnd;
+    if (equalPos >= line.size() || line[equalPos] != '=')
+    {
+        return false;
+    }
+    name = line.substr(pos, nameEnd - pos);
+
+    size_t valueStart = equalPos + 1;
+    if (valueStart < line.size() && line[valueStart] == '"')
+    {
+        size_t closingQuote = line.find('"', valueStart + 1);
+        if (closingQuote == std::string::npos)
+        {
+            return false;
+        }
+        value = line.substr(valueStart + 1, closingQuote - valueStart - 1);
+        return true;
+    }
+
+    size_t valueEnd = line.find_first_of(" \t#", valueStart);
+    value = line.substr(valueStart, valueEnd == std::string::npos ? std::string::npos : valueEnd - valueStart);
+    return true;
+}
@@ -0,0 +1,250 @@
+#include "platform/iturbo_controller.h"
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Linux turbo controller writing intel_pstate/no_turbo or cpufreq boost
+ * The TurboPolicy decides; this class finds the switch and the CPU thermal
+ * zones, and writes the switch only when the decision changes
+ */
+class LinuxTurboController : public ITurboController
+{
+public:
+    LinuxTurboController(const std::string& cpuSysfsRoot, const std::string& thermalRoot)
+        : m_cpuRoot{cpuSysfsRoot}
+        , m_thermalRoot{thermalRoot}
+        , m_policy{TurboSettings{}}
+    {
+    }
+
+    virtual ~LinuxTurboController() override = default;
+
+    /**
+     * Locate the turbo switch, snapshot it and pick the thermal zones to watch
+     * intel_pstate/no_turbo is preferred, then the global cpufreq/boost, then
+     * the per-policy boost attributes of amd-pstate
+     * @param settings burst, budget and thermal limits
+     * @return false if no turbo switch exists or the firmware holds turbo off
+     */
+    bool initialize(const TurboSettings& settings) override
+    {
+        m_policy = TurboPolicy(settings);
+        m_switches.clear();
+        m_applied.reset();
+        m_writeFailed = false;
+
+        if (LinuxSysfs::exists(m_cpuRoot + "/intel_pstate/no_turbo"))
+        {
+            addSwitch(m_cpuRoot + "/intel_pstate/no_turbo", true);
+        }
+        else if (LinuxSysfs::exists(m_cpuRoot + "/cpufreq/boost"))
+        {
+            addSwitch(m_cpuRoot + "/cpufreq/boost", false);
+        }
+        else
+        {
+            for (const auto& policy : LinuxSysfs::listCpufreqPolicies(m_cpuRoot))
+            {
+                if (LinuxSysfs::exists(policy + "/boost"))
+                {
+                    addSwitch(policy + "/boost", false);
+                }
+            }
+        }
+
+        if (m_switches.empty())
+        {
+            return false;
+        }
+        if (firmwareLocked())
+        {
+            Logger::info("Turbo is disabled by the firmware - not managing turbo");
+            m_switches.clear();
+            return false;
+        }
+
+        m_thermalZones = LinuxSysfs::findCpuThermalZones(m_thermalRoot);
+        Logger::info("Turbo controller: " + std::to_string(m_switches.size()) + " switch(es), " +
+                     std::to_string(m_thermalZones.size()) + " thermal zone(s), budget " +
+                     std::to_string(static_cast<int>(settings.budget * 100)) + "% of " +
+                     std::to_string(settings.window.count()) + "s, thermal limit " +
+                     std::to_string(static_cast<int>(settings.thermalLimit)) + "C");
+        return true;
+    }
+
+    /**
+     * Feed the busiest CPU's utilization to the policy
+     * @param utilization busy fraction per CPU
+     */
+    void update(const std::vector<double>& utilization) override
+    {
+        double busiest = utilization.empty() ? 0.0 : *std::max_element(utilization.begin(), utilization.end());
+        apply(m_policy.update(busiest, LinuxSysfs::readHottestTemperature(m_thermalZones), std::chrono::steady_clock::now()));
+    }
+
+    void setTier(PowerTier tier) override
+    {
+        m_policy.setTier(tier);
+        // A backend may have written the switch as part of its own profile; a refused write is not retried
+        if (m_applied && !m_writeFailed && !switchesHold(*m_applied))
+        {
+            m_applied.reset();
+        }
+        apply(m_policy.evaluate(LinuxSysfs::readHottestTemperature(m_thermalZones), std::chrono::steady_clock::now()));
+    }
+
+    /**
+     * Write back the snapshot and log the residency of this run
+     * @return true if every switch was restored
+     */
+    bool restore() override
+    {
+        bool success = true;
+        for (const auto& turboSwitch : m_switches)
+        {
+            if (!LinuxSysfs::writeAttribute(turboSwitch.path, turboSwitch.original))
+            {
+                Logger::error("Failed to restore turbo switch " + turboSwitch.path + " to " + turboSwitch.original);
+                success = false;
+            }
+        }
+        m_applied.reset();
+        m_writeFailed = false;
+
+        const TurboMetrics& metrics = m_policy.getMetrics();
+        Logger::info("Turbo residency " + std::to_string(static_cast<int>(metrics.residencyFraction() * 100)) + "% of " +
+                     std::to_string(metrics.observed.count() / 1000) + "s, " + std::to_string(metrics.activations) +
+                     " activation(s), " + std::to_string(metrics.budgetDenials) + " budget and " +
+                     std::to_string(metrics.thermalDenials) + " thermal denial(s)");
+        return success;
+    }
+
+    void setBoostCallback(BoostCallback callback) override
+    {
+        m_boostCallback = std::move(callback);
+    }
+
+    TurboMetrics getMetrics() const override
+    {
+        return m_policy.getMetrics();
+    }
+
+    std::vector<std::string> getControlledAttributes() const override
+    {
+        std::vector<std::string> paths;
+        for (const auto& turboSwitch : m_switches)
+        {
+            paths.push_back(turboSwitch.path);
+        }
+        return paths;
+    }
+
+private:
+    struct Switch
+    {
+        std::string path;
+        bool inverted{false};       ///< no_turbo: 1 disables turbo
+        std::string original;
+    };
+
+    void addSwitch(const std::string& path, bool inverted)
+    {
+        auto original = LinuxSysfs::readAttribute(path);
+        if (!original)
+        {
+            Logger::warning("Cannot read turbo switch " + path + " - ignoring");
+            return;
+        }
+        m_switches.push_back({path, inverted, *original});
+    }
+
+    static std::string switchValue(const Switch& turboSwitch, bool enabled)
+    {
+        return (enabled != turboSwitch.inverted) ? "1" : "0";
+    }
+
+    bool switchesHold(bool enabled) const
+    {
+        return std::all_of(m_switches.begin(), m_switches.end(), [enabled](const Switch& turboSwitch) {
+            return LinuxSysfs::readAttribute(turboSwitch.path) == switchValue(turboSwitch, enabled);
+        });
+    }
+
+    /**
+     * intel_pstate refuses no_turbo=0 when the firmware disabled turbo, so
+     * a no_turbo switch reading 1 is probed by enabling turbo and writing the snapshot back
+     */
+    bool firmwareLocked() const
+    {
+        for (const auto& turboSwitch : m_switches)
+        {
+            if (!turboSwitch.inverted || turboSwitch.original == "0")
+            {
+                continue;
+            }
+            if (!LinuxSysfs::writeAttribute(turboSwitch.path, "0"))
+            {
+                return true;
+            }
+            LinuxSysfs::writeAttribute(turboSwitch.path, turboSwitch.original);
+        }
+        return false;
+    }
+
+    /**
+     * The decision is recorded even if a write fails, so a refused switch is
+     * written again only once the decision changes
+     */
+    void apply(bool enabled)
+    {
+        if (m_applied == enabled)
+        {
+            return;
+        }
+        m_applied = enabled;
+        m_writeFailed = false;
+
+        for (const auto& turboSwitch : m_switches)
+        {
+            std::string value = switchValue(turboSwitch, enabled);
+            if (!LinuxSysfs::writeAttribute(turboSwitch.path, value))
+            {
+                Logger::warning("Failed to write turbo switch " + turboSwitch.path + " = " + value);
+                m_writeFailed = true;
+            }
+        }
+        if (m_writeFailed)
+        {
+            return;
+        }
+
+        Logger::debug(std::string("Turbo ") + (enabled ? "enabled" : "disabled"));
+        if (enabled && m_boostCallback)
+        {
+            m_boostCallback();
+        }
+    }
+
+    std::string m_cpuRoot;
+    std::string m_thermalRoot;
+    TurboPolicy m_policy;
+    std::vector<Switch> m_switches;
+    std::vector<std::string> m_thermalZones;
+    std::optional<bool> m_applied;      ///< state last written or attempted, unset if unknown
+    bool m_writeFailed{false};          ///< the last write of m_applied was refused
+    BoostCallback m_boostCallback;
+};
+
+// Factory function for creating the Linux turbo controller
+std::unique_ptr<ITurboController> createLinuxTurboController(const std::string& cpuSysfsRoot, const std::string& thermalRoot)
+{
+    return std::make_unique<LinuxTurboController>(cpuSysfsRoot, thermalRoot);
+}
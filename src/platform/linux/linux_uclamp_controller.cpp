@@ -0,0 +1,121 @@
+#include "platform/iuclamp_controller.h"
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Linux utilization clamps through cgroup v2 cpu.uclamp.min and cpu.uclamp.max
+ * The files exist when the kernel has CONFIG_UCLAMP_TASK_GROUP and the cpu
+ * controller is enabled for the cgroup. Clamps only steer frequency under the
+ * schedutil governor; task placement on hybrid CPUs honours them regardless
+ */
+class LinuxUclampController : public IUclampController
+{
+public:
+    LinuxUclampController(const std::string& cgroupRoot, const std::string& cpuSysfsRoot)
+        : m_cgroupRoot{cgroupRoot}
+        , m_cpuRoot{cpuSysfsRoot}
+        , m_held{false}
+    {
+    }
+
+    virtual ~LinuxUclampController() override = default;
+
+    bool initialize(const std::vector<std::string>& floorCgroups, int floorPercent,
+                    const std::vector<std::string>& capCgroups, int capPercent) override
+    {
+        m_original.clear();
+        m_target.clear();
+        addClamps(floorCgroups, "cpu.uclamp.min", floorPercent);
+        addClamps(capCgroups, "cpu.uclamp.max", capPercent);
+        if (m_original.empty())
+        {
+            return false;
+        }
+
+        auto governor = LinuxSysfs::readAttribute(m_cpuRoot + "/cpufreq/policy0/scaling_governor");
+        if (governor && *governor != "schedutil")
+        {
+            Logger::warning("uclamp: the " + *governor + " governor ignores utilization clamps for frequency - use schedutil");
+        }
+        Logger::info("uclamp: " + std::to_string(m_original.size()) + " clamp(s) held below the performance tier");
+        return true;
+    }
+
+    void setTier(PowerTier tier) override
+    {
+        if (tier == PowerTier::PERFORMANCE)
+        {
+            restore();
+            return;
+        }
+        if (m_held)
+        {
+            return;
+        }
+
+        for (const auto& [path, value] : m_target)
+        {
+            if (!LinuxSysfs::writeAttribute(path, value))
+            {
+                Logger::warning("Failed to write " + path + " = " + value);
+            }
+        }
+        m_held = true;
+        Logger::debug("Utilization clamps applied");
+    }
+
+    bool restore() override
+    {
+        if (!m_held)
+        {
+            return true;
+        }
+
+        bool success = true;
+        for (const auto& [path, original] : m_original)
+        {
+            if (!LinuxSysfs::writeAttribute(path, original))
+            {
+                Logger::error("Failed to restore " + path + " to " + original);
+                success = false;
+            }
+        }
+        m_held = !success;
+        Logger::debug("Utilization clamps released");
+        return success;
+    }
+
+private:
+    void addClamps(const std::vector<std::string>& cgroups, const std::string& file, int percent)
+    {
+        for (const auto& cgroup : cgroups)
+        {
+            std::string path = m_cgroupRoot + "/" + cgroup + "/" + file;
+            auto original = LinuxSysfs::readAttribute(path);
+            if (!original || original->empty())
+            {
+                Logger::warning("cgroup " + cgroup + " has no " + file + " (cpu controller or uclamp support missing) - not clamping it");
+                continue;
+            }
+            m_original[path] = *original;
+            m_target[path] = std::to_string(percent);
+        }
+    }
+
+    std::string m_cgroupRoot;
+    std::string m_cpuRoot;
+    bool m_held;
+    std::map<std::string, std::string> m_original;  ///< clamp files and their values before the daemon touched them
+    std::map<std::string, std::string> m_target;    ///< clamp files and the percentages written below the performance tier
+};
+
+// Factory function for creating the Linux uclamp controller
+std::unique_ptr<IUclampController> createLinuxUclampController(const std::string& cgroupRoot, const std::string& cpuSysfsRoot)
+{
+    return std::make_unique<LinuxUclampController>(cgroupRoot, cpuSysfsRoot);
+}
@@ -124,6 +124,14 @@ public:
         return "/etc/ddogreen/ddogreen.conf";
     }
 
+    /**
+     * Get the default state directory for macOS
+     * @return /var/db/ddogreen
+     */
+    std::string getDefaultStateDirectory() const override {
+        return "/var/db/ddogreen";
+    }
+
     /**
      * Check if platform utilities are available
      * @return true (always available on macOS)
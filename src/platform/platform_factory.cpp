@@ -1,10 +1,11 @@
 #include "platform/platform_factory.h"
 #include "logger.h"
+#include "power_backend_selector.h"
 #include <memory>
 
 #if defined(__linux__)
-std::unique_ptr<ISystemMonitor> createLinuxSystemMonitor();
-std::unique_ptr<IPowerManager> createLinuxPowerManager();
+#include "platform/linux/linux_power_backends.h"
+std::unique_ptr<ISystemMonitor> createLinuxSystemMonitor(const std::string& rootPrefix = "");
 std::unique_ptr<IPlatformUtils> createLinuxPlatformUtils();
 std::unique_ptr<ISignalHandler> createLinuxSignalHandler();
 #elif defined(_WIN32) || defined(_WIN64)
@@ -41,12 +42,41 @@ std::unique_ptr<ISystemMonitor> PlatformFactory::createSystemMonitor() {
 
 /**
  * Create a power manager for the current platform
+ * Probes the backends in their default order, without a selection cache
  * @return unique_ptr to platform-specific power manager implementation
  */
 std::unique_ptr<IPowerManager> PlatformFactory::createPowerManager() {
+    return createPowerManager({}, "");
+}
+
+/**
+ * Create a power manager by probing the compiled-in backends
+ * @param backendOrder backend names to try in order; empty selects the most capable backend
+ * @param cacheFile file caching the selection across starts; empty disables caching
+ * @return unique_ptr to the selected power manager implementation
+ */
+std::unique_ptr<IPowerManager> PlatformFactory::createPowerManager([[maybe_unused]] const std::vector<std::string>& backendOrder,
+                                                                   [[maybe_unused]] const std::string& cacheFile) {
 #if defined(__linux__)
-    Logger::debug("Creating Linux power manager");
-    return createLinuxPowerManager();
+    Logger::debug("Selecting Linux power backend");
+    // EPP steers within the powersave governor, which the governor backend would override;
+    // native sysfs writes beat a D-Bus round trip, which beats forking tlp
+    PowerBackendSelector selector({
+        {"epp", [] { return createLinuxEppPowerManager(); }, 4},
+        {"governor", [] { return createLinuxGovernorPowerManager(); }, 3},
+        {"ppd", [] { return createLinuxPpdPowerManager(); }, 2},
+        {"tlp", [] { return createLinuxPowerManager(); }, 1},
+    });
+    selector.setPreferredOrder(backendOrder);
+    selector.setCacheFile(cacheFile);
+
+    auto powerManager = selector.select();
+    if (!powerManager)
+    {
+        // Keep the historical default so startup reports the usual backend error
+        return createLinuxPowerManager();
+    }
+    return powerManager;
 #elif defined(_WIN32) || defined(_WIN64)
     Logger::debug("Creating Windows power manager");
     return createWindowsPowerManager();
@@ -59,6 +89,174 @@ std::unique_ptr<IPowerManager> PlatformFactory::createPowerManager() {
 #endif
 }
 
+/**
+ * Create a knob profile manager for the current platform
+ * @return unique_ptr to the knob manager, or nullptr if the platform has no kernel tunables
+ */
+std::unique_ptr<IKnobManager> PlatformFactory::createKnobManager() {
+#if defined(__linux__)
+    Logger::debug("Creating Linux knob manager");
+    return createLinuxKnobManager();
+#else
+    Logger::debug("Knob profiles are not supported on this platform");
+    return nullptr;
+#endif
+}
+
+/**
+ * Create a frequency cap controller for the current platform
+ * @return unique_ptr to the controller, or nullptr if frequencies cannot be capped
+ */
+std::unique_ptr<IFrequencyController> PlatformFactory::createFrequencyController() {
+#if defined(__linux__)
+    Logger::debug("Creating Linux frequency cap controller");
+    return createLinuxFrequencyController();
+#else
+    Logger::debug("Frequency capping is not supported on this platform");
+    return nullptr;
+#endif
+}
+
+/**
+ * Create a turbo controller for the current platform
+ * @return unique_ptr to the controller, or nullptr if turbo cannot be switched
+ */
+std::unique_ptr<ITurboController> PlatformFactory::createTurboController() {
+#if defined(__linux__)
+    Logger::debug("Creating Linux turbo controller");
+    return createLinuxTurboController();
+#else
+    Logger::debug("Turbo control is not supported on this platform");
+    return nullptr;
+#endif
+}
+
+/**
+ * Create an SMT controller for the current platform
+ * @return unique_ptr to the controller, or nullptr if SMT cannot be switched
+ */
+std::unique_ptr<ISmtController> PlatformFactory::createSmtController() {
+#if defined(__linux__)
+    Logger::debug("Creating Linux SMT controller");
+    return createLinuxSmtController();
+#else
+    Logger::debug("SMT control is not supported on this platform");
+    return nullptr;
+#endif
+}
+
+/**
+ * Create a core parking controller for the current platform
+ * @return unique_ptr to the controller, or nullptr if CPUs cannot be taken offline
+ */
+std::unique_ptr<ICpuParkingController> PlatformFactory::createCpuParkingController() {
+#if defined(__linux__)
+    Logger::debug("Creating Linux CPU parking controller");
+    return createLinuxCpuParkingController();
+#else
+    Logger::debug("CPU parking is not supported on this platform");
+    return nullptr;
+#endif
+}
+
+/**
+ * Create a PM QoS latency controller for the current platform
+ * @return unique_ptr to the controller, or nullptr if latency requests are not supported
+ */
+std::unique_ptr<IPmQosController> PlatformFactory::createPmQosController() {
+#if defined(__linux__)
+    Logger::debug("Creating Linux PM QoS controller");
+    return createLinuxPmQosController();
+#else
+    Logger::debug("PM QoS latency requests are not supported on this platform");
+    return nullptr;
+#endif
+}
+
+/**
+ * Create an IRQ affinity controller for the current platform
+ * @return unique_ptr to the controller, or nullptr if interrupt affinity cannot be set
+ */
+std::unique_ptr<IIrqAffinityController> PlatformFactory::createIrqAffinityController() {
+#if defined(__linux__)
+    Logger::debug("Creating Linux IRQ affinity controller");
+    return createLinuxIrqAffinityController();
+#else
+    Logger::debug("IRQ affinity control is not supported on this platform");
+    return nullptr;
+#endif
+}
+
+/**
+ * Create a cpuset controller for the current platform
+ * @return unique_ptr to the controller, or nullptr if cgroup CPU sets are not supported
+ */
+std::unique_ptr<ICpusetController> PlatformFactory::createCpusetController() {
+#if defined(__linux__)
+    Logger::debug("Creating Linux cpuset controller");
+    return createLinuxCpusetController();
+#else
+    Logger::debug("cgroup CPU sets are not supported on this platform");
+    return nullptr;
+#endif
+}
+
+/**
+ * Create a utilization clamp controller for the current platform
+ * @return unique_ptr to the controller, or nullptr if cgroup clamps are not supported
+ */
+std::unique_ptr<IUclampController> PlatformFactory::createUclampController() {
+#if defined(__linux__)
+    Logger::debug("Creating Linux uclamp controller");
+    return createLinuxUclampController();
+#else
+    Logger::debug("Utilization clamps are not supported on this platform");
+    return nullptr;
+#endif
+}
+
+/**
+ * Create an idle injection controller for the current platform
+ * @return unique_ptr to the controller, or nullptr if CPUs cannot be forced idle
+ */
+std::unique_ptr<IIdleInjectionController> PlatformFactory::createIdleInjectionController() {
+#if defined(__linux__)
+    Logger::debug("Creating Linux idle injection controller");
+    return createLinuxIdleInjectionController();
+#else
+    Logger::debug("Idle injection is not supported on this platform");
+    return nullptr;
+#endif
+}
+
+/**
+ * Create a hardware performance counter sampler for the current platform
+ * @return unique_ptr to the sampler, or nullptr if counters are not supported
+ */
+std::unique_ptr<IPerfSampler> PlatformFactory::createPerfSampler() {
+#if defined(__linux__)
+    Logger::debug("Creating Linux performance counter sampler");
+    return createLinuxPerfSampler();
+#else
+    Logger::debug("Performance counters are not supported on this platform");
+    return nullptr;
+#endif
+}
+
+/**
+ * Create a suspend/resume monitor for the current platform
+ * @return unique_ptr to the monitor, or nullptr if suspend cannot be detected
+ */
+std::unique_ptr<ISleepMonitor> PlatformFactory::createSleepMonitor() {
+#if defined(__linux__)
+    Logger::debug("Creating Linux sleep monitor");
+    return createLinuxSleepMonitor();
+#else
+    Logger::debug("Suspend detection is not supported on this platform");
+    return nullptr;
+#endif
+}
+
 /**
  * Create platform utilities for the current platform
  * @return unique_ptr to platform-specific platform utilities implementation
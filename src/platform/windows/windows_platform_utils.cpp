@@ -119,6 +119,14 @@ public:
         return getProgramDataPath() + "\\ddosoft\\ddogreen\\ddogreen.conf";
     }
 
+    /**
+     * Get the default state directory for Windows
+     * @return path to state directory using %ProgramData% environment variable
+     */
+    std::string getDefaultStateDirectory() const override {
+        return getProgramDataPath() + "\\ddosoft\\ddogreen\\state";
+    }
+
     /**
      * Check if platform utilities are available
      * @return true (always available on Windows)
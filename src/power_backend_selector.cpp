@@ -0,0 +1,288 @@
+#include "power_backend_selector.h"
+#include "logger.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <system_error>
+
+PowerBackendSelector::PowerBackendSelector(std::vector<PowerBackendCandidate> candidates)
+    : m_candidates{std::move(candidates)}
+{
+}
+
+void PowerBackendSelector::setPreferredOrder(const std::vector<std::string>& order)
+{
+    m_preferredOrder.clear();
+    for (const auto& name : order)
+    {
+        if (findCandidate(name) == nullptr)
+        {
+            Logger::warning("Ignoring unknown power backend: " + name);
+            continue;
+        }
+        m_preferredOrder.push_back(name);
+    }
+}
+
+std::unique_ptr<IPowerManager> PowerBackendSelector::select()
+{
+    m_selectedName.clear();
+    m_probes.clear();
+    m_usedCache = false;
+
+    auto backend = selectFromCache();
+    if (backend)
+    {
+        m_usedCache = true;
+        Logger::info("Using cached power backend selection: " + m_selectedName);
+        return backend;
+    }
+
+    backend = probeCandidates();
+    if (backend)
+    {
+        writeCache();
+    }
+    return backend;
+}
+
+std::unique_ptr<IPowerManager> PowerBackendSelector::selectFromCache()
+{
+    if (m_cacheFile.empty())
+    {
+        return nullptr;
+    }
+
+    std::ifstream file(m_cacheFile);
+    if (!file.is_open())
+    {
+        return nullptr;
+    }
+
+    std::map<std::string, std::string> values;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        size_t equalPos = line.find('=');
+        if (line.empty() || line[0] == '#' || equalPos == std::string::npos)
+        {
+            continue;
+        }
+        values[line.substr(0, equalPos)] = line.substr(equalPos + 1);
+    }
+
+    // Any change in format, configured order or compiled-in backends invalidates the cache
+    if (values["version"] != std::to_string(CACHE_VERSION) ||
+        values["order"] != orderKey() ||
+        values["candidates"] != candidatesKey())
+    {
+        Logger::debug("Power backend cache is stale - probing again");
+        return nullptr;
+    }
+
+    const PowerBackendCandidate* candidate = findCandidate(values["backend"]);
+    if (candidate == nullptr)
+    {
+        return nullptr;
+    }
+
+    auto backend = candidate->create();
+    if (!backend || !backend->isAvailable())
+    {
+        Logger::info("Cached power backend " + candidate->name + " is no longer available - probing again");
+        return nullptr;
+    }
+
+    m_selectedName = candidate->name;
+    return backend;
+}
+
+std::unique_ptr<IPowerManager> PowerBackendSelector::probeCandidates()
+{
+    std::unique_ptr<IPowerManager> selected;
+    bool firstCapableWins = !m_preferredOrder.empty();
+
+    for (const PowerBackendCandidate* candidate : orderedCandidates())
+    {
+        std::unique_ptr<IPowerManager> backend;
+        PowerBackendProbe result = probe(*candidate, backend);
+        m_probes.push_back(result);
+
+        if (!result.available)
+        {
+            Logger::info("Power backend " + result.name + ": not available");
+            continue;
+        }
+        if (!result.capable)
+        {
+            Logger::info("Power backend " + result.name + ": available but idempotent switch failed");
+            continue;
+        }
+        Logger::info("Power backend " + result.name + ": switch latency " +
+                     std::to_string(result.switchLatency.count()) + " us");
+
+        bool better = selected == nullptr;
+        if (!better && !firstCapableWins)
+        {
+            const PowerBackendCandidate* current = findCandidate(m_selectedName);
+            auto currentProbe = std::find_if(m_probes.begin(), m_probes.end(),
+                [this](const PowerBackendProbe& p) { return p.name == m_selectedName; });
+            better = candidate->capability > current->capability ||
+                     (candidate->capability == current->capability &&
+                      result.switchLatency * LATENCY_TOLERANCE < currentProbe->switchLatency);
+        }
+
+        if (better)
+        {
+            selected = std::move(backend);
+            m_selectedName = result.name;
+        }
+
+        if (firstCapableWins)
+        {
+            break;
+        }
+    }
+
+    if (selected)
+    {
+        Logger::info("Selected power backend: " + m_selectedName);
+    }
+    else
+    {
+        Logger::error("No capable power backend found");
+    }
+    return selected;
+}
+
+PowerBackendProbe PowerBackendSelector::probe(const PowerBackendCandidate& candidate,
+                                              std::unique_ptr<IPowerManager>& backend) const
+{
+    PowerBackendProbe result;
+    result.name = candidate.name;
+
+    backend = candidate.create();
+    if (!backend || !backend->isAvailable())
+    {
+        return result;
+    }
+    result.available = true;
+
+    // Keep the best of a few samples so a cold cache or a scheduling hiccup does not decide
+    auto best = std::chrono::microseconds::max();
+    for (int sample = 0; sample < PROBE_SAMPLES; ++sample)
+    {
+        auto start = std::chrono::steady_clock::now();
+        if (!backend->reapplyCurrentMode())
+        {
+            return result;
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        best = std::min(best, elapsed);
+    }
+
+    result.capable = true;
+    result.switchLatency = best;
+    return result;
+}
+
+std::vector<const PowerBackendCandidate*> PowerBackendSelector::orderedCandidates() const
+{
+    std::vector<const PowerBackendCandidate*> ordered;
+    if (m_preferredOrder.empty())
+    {
+        for (const auto& candidate : m_candidates)
+        {
+            ordered.push_back(&candidate);
+        }
+        return ordered;
+    }
+
+    for (const auto& name : m_preferredOrder)
+    {
+        ordered.push_back(findCandidate(name));
+    }
+    return ordered;
+}
+
+const PowerBackendCandidate* PowerBackendSelector::findCandidate(const std::string& name) const
+{
+    auto it = std::find_if(m_candidates.begin(), m_candidates.end(),
+        [&name](const PowerBackendCandidate& candidate) { return candidate.name == name; });
+    return it == m_candidates.end() ? nullptr : &(*it);
+}
+
+std::string PowerBackendSelector::orderKey() const
+{
+    if (m_preferredOrder.empty())
+    {
+        return "auto";
+    }
+
+    std::string key;
+    for (const auto& name : m_preferredOrder)
+    {
+        key += (key.empty() ? "" : ",") + name;
+    }
+    return key;
+}
+
+std::string PowerBackendSelector::candidatesKey() const
+{
+    std::string key;
+    for (const auto& candidate : m_candidates)
+    {
+        key += (key.empty() ? "" : ",") + candidate.name;
+    }
+    return key;
+}
+
+void PowerBackendSelector::writeCache() const
+{
+    if (m_cacheFile.empty())
+    {
+        return;
+    }
+
+    std::filesystem::path path(m_cacheFile);
+    std::error_code error;
+    if (path.has_parent_path())
+    {
+        std::filesystem::create_directories(path.parent_path(), error);
+    }
+
+    // Write to a temporary file and rename so a crash never leaves a truncated cache
+    std::filesystem::path tempPath = path;
+    tempPath += ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::trunc);
+        if (!file.is_open())
+        {
+            Logger::warning("Cannot write power backend cache: " + tempPath.string());
+            return;
+        }
+
+        file << "# ddogreen power backend selection - delete this file to probe again\n";
+        file << "version=" << CACHE_VERSION << "\n";
+        file << "order=" << orderKey() << "\n";
+        file << "candidates=" << candidatesKey() << "\n";
+        file << "backend=" << m_selectedName << "\n";
+        for (const auto& result : m_probes)
+        {
+            if (result.capable)
+            {
+                file << "latency_us." << result.name << "=" << result.switchLatency.count() << "\n";
+            }
+        }
+    }
+
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        Logger::warning("Cannot write power backend cache: " + m_cacheFile + " (" + error.message() + ")");
+        std::filesystem::remove(tempPath, error);
+        return;
+    }
+    Logger::debug("Power backend selection cached in " + m_cacheFile);
+}
@@ -0,0 +1,388 @@
+#include "schedule.h"
+#include "logger.h"
+#include <algorithm>
+#include <array>
+#include <sstream>
+
+namespace
+{
+    constexpr int MINUTES_PER_DAY = 24 * 60;
+    constexpr unsigned int ALL_DAYS = 0x7F;
+
+    const std::array<std::string, 7> DAY_NAMES = {"sun", "mon", "tue", "wed", "thu", "fri", "sat"};
+
+    int dayIndex(const std::string& name)
+    {
+        auto it = std::find(DAY_NAMES.begin(), DAY_NAMES.end(), name);
+        return it == DAY_NAMES.end() ? -1 : static_cast<int>(std::distance(DAY_NAMES.begin(), it));
+    }
+
+    std::string trimCopy(const std::string& value)
+    {
+        size_t start = value.find_first_not_of(" \t");
+        if (start == std::string::npos)
+        {
+            return "";
+        }
+        size_t end = value.find_last_not_of(" \t");
+        return value.substr(start, end - start + 1);
+    }
+
+    bool dayEnabled(unsigned int dayMask, int weekday)
+    {
+        return (dayMask & (1U << static_cast<unsigned int>(weekday))) != 0;
+    }
+}
+
+bool Schedule::addProfile(const std::string& name, const std::string& spec)
+{
+    if (name.empty())
+    {
+        Logger::warning("Schedule profile name must not be empty");
+        return false;
+    }
+    if (findProfile(name) != nullptr)
+    {
+        Logger::warning("Duplicate schedule profile: " + name);
+        return false;
+    }
+
+    ScheduleProfile profile;
+    profile.name = name;
+
+    std::istringstream stream(spec);
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        item = trimCopy(item);
+        size_t equalPos = item.find('=');
+        if (equalPos == std::string::npos)
+        {
+            Logger::warning("Invalid schedule profile entry '" + item + "' in profile " + name);
+            return false;
+        }
+
+        std::string key = trimCopy(item.substr(0, equalPos));
+        std::string value = trimCopy(item.substr(equalPos + 1));
+
+        try
+        {
+            if (key == "high")
+            {
+                double threshold = std::stod(value);
+                if (threshold < 0.1 || threshold > 1.0)
+                {
+                    Logger::warning("Schedule profile " + name + ": high value " + value + " out of range (0.1-1.0)");
+                    return false;
+                }
+                profile.highPerformanceThreshold = threshold;
+            }
+            else if (key == "low")
+            {
+                double threshold = std::stod(value);
+                if (threshold < 0.05 || threshold > 0.9)
+                {
+                    Logger::warning("Schedule profile " + name + ": low value " + value + " out of range (0.05-0.9)");
+                    return false;
+                }
+                profile.powerSaveThreshold = threshold;
+            }
+            else if (key == "active" || key == "idle" || key == "hold")
+            {
+                auto tier = parsePowerTier(value);
+                if (!tier)
+                {
+                    Logger::warning("Schedule profile " + name + ": unknown tier '" + value + "'");
+                    return false;
+                }
+                if (key == "active")
+                {
+                    profile.activeTier = *tier;
+                }
+                else if (key == "idle")
+                {
+                    profile.idleTier = *tier;
+                }
+                else
+                {
+                    profile.holdTier = *tier;
+                }
+            }
+            else
+            {
+                Logger::warning("Schedule profile " + name + ": unknown key '" + key + "'");
+                return false;
+            }
+        }
+        catch (const std::exception&)
+        {
+            Logger::warning("Schedule profile " + name + ": invalid numeric value for " + key + ": " + value);
+            return false;
+        }
+    }
+
+    if (profile.highPerformanceThreshold && profile.powerSaveThreshold &&
+        *profile.powerSaveThreshold >= *profile.highPerformanceThreshold)
+    {
+        Logger::warning("Schedule profile " + name + ": low must be less than high");
+        return false;
+    }
+
+    m_profiles.push_back(profile);
+    return true;
+}
+
+bool Schedule::addWindow(const std::string& spec)
+{
+    std::istringstream stream(spec);
+    std::string daysField;
+    std::string timeField;
+    std::string profileField;
+    std::string extra;
+
+    if (!(stream >> daysField >> timeField >> profileField) || (stream >> extra))
+    {
+        Logger::warning("Invalid schedule window '" + spec + "' (expected '<days> <HH:MM>-<HH:MM> <profile>')");
+        return false;
+    }
+
+    ScheduleWindow window;
+    window.profile = profileField;
+
+    if (!parseDays(daysField, window.dayMask))
+    {
+        Logger::warning("Invalid schedule days '" + daysField + "'");
+        return false;
+    }
+
+    size_t dashPos = timeField.find('-');
+    if (dashPos == std::string::npos ||
+        !parseClock(timeField.substr(0, dashPos), window.startMinute) ||
+        !parseClock(timeField.substr(dashPos + 1), window.endMinute))
+    {
+        Logger::warning("Invalid schedule time range '" + timeField + "'");
+        return false;
+    }
+
+    if (window.startMinute == MINUTES_PER_DAY || window.startMinute == window.endMinute)
+    {
+        Logger::warning("Schedule time range '" + timeField + "' is empty");
+        return false;
+    }
+
+    m_windows.push_back(window);
+    return true;
+}
+
+bool Schedule::validate() const
+{
+    bool valid = true;
+    for (const auto& window : m_windows)
+    {
+        if (findProfile(window.profile) == nullptr)
+        {
+            Logger::error("Schedule window references undefined profile: " + window.profile);
+            valid = false;
+        }
+    }
+    return valid;
+}
+
+const ScheduleProfile* Schedule::activeProfileAt(const std::tm& localTime) const
+{
+    int minute = localTime.tm_hour * 60 + localTime.tm_min;
+    int weekday = localTime.tm_wday;
+    int previousDay = (weekday + 6) % 7;
+
+    for (const auto& window : m_windows)
+    {
+        bool matches = false;
+        if (window.startMinute < window.endMinute)
+        {
+            matches = dayEnabled(window.dayMask, weekday) &&
+                      minute >= window.startMinute && minute < window.endMinute;
+        }
+        else
+        {
+            // Wrapping window: evening part belongs to today, morning part to yesterday's start
+            matches = (dayEnabled(window.dayMask, weekday) && minute >= window.startMinute) ||
+                      (dayEnabled(window.dayMask, previousDay) && minute < window.endMinute);
+        }
+
+        if (matches)
+        {
+            return findProfile(window.profile);
+        }
+    }
+    return nullptr;
+}
+
+const ScheduleProfile* Schedule::activeProfileAt(std::chrono::system_clock::time_point time) const
+{
+    return activeProfileAt(toLocalTime(time));
+}
+
+std::chrono::system_clock::time_point Schedule::nextBoundaryAfter(std::chrono::system_clock::time_point time) const
+{
+    auto next = std::chrono::system_clock::time_point::max();
+    if (m_windows.empty())
+    {
+        return next;
+    }
+
+    std::tm today = toLocalTime(time);
+
+    // Yesterday is included so that wrapping windows contribute their end boundary today
+    for (int dayOffset = -1; dayOffset <= 8; ++dayOffset)
+    {
+        std::tm noon = today;
+        noon.tm_mday += dayOffset;
+        noon.tm_hour = 12;
+        noon.tm_min = 0;
+        noon.tm_sec = 0;
+        noon.tm_isdst = -1;
+        if (std::mktime(&noon) == -1)
+        {
+            continue;
+        }
+
+        for (const auto& window : m_windows)
+        {
+            if (!dayEnabled(window.dayMask, noon.tm_wday))
+            {
+                continue;
+            }
+
+            int endMinute = window.endMinute;
+            if (window.endMinute <= window.startMinute)
+            {
+                endMinute += MINUTES_PER_DAY;
+            }
+
+            for (int minute : {window.startMinute, endMinute})
+            {
+                std::tm boundary = noon;
+                boundary.tm_hour = 0;
+                boundary.tm_min = minute;
+                boundary.tm_isdst = -1;
+                std::time_t boundaryTime = std::mktime(&boundary);
+                if (boundaryTime == -1)
+                {
+                    continue;
+                }
+
+                auto candidate = std::chrono::system_clock::from_time_t(boundaryTime);
+                if (candidate > time && candidate < next)
+                {
+                    next = candidate;
+                }
+            }
+        }
+    }
+
+    return next;
+}
+
+const ScheduleProfile* Schedule::findProfile(const std::string& name) const
+{
+    auto it = std::find_if(m_profiles.begin(), m_profiles.end(),
+        [&name](const ScheduleProfile& profile) { return profile.name == name; });
+    return it == m_profiles.end() ? nullptr : &(*it);
+}
+
+bool Schedule::parseDays(const std::string& field, unsigned int& dayMask)
+{
+    dayMask = 0;
+    if (field == "*")
+    {
+        dayMask = ALL_DAYS;
+        return true;
+    }
+
+    std::istringstream stream(field);
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        std::transform(item.begin(), item.end(), item.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+        size_t dashPos = item.find('-');
+        if (dashPos == std::string::npos)
+        {
+            int day = dayIndex(item);
+            if (day < 0)
+            {
+                return false;
+            }
+            dayMask |= 1U << static_cast<unsigned int>(day);
+            continue;
+        }
+
+        int first = dayIndex(item.substr(0, dashPos));
+        int last = dayIndex(item.substr(dashPos + 1));
+        if (first < 0 || last < 0)
+        {
+            return false;
+        }
+
+        // Ranges may wrap around the end of the week (e.g. fri-mon)
+        for (int day = first; ; day = (day + 1) % 7)
+        {
+            dayMask |= 1U << static_cast<unsigned int>(day);
+            if (day == last)
+            {
+                break;
+            }
+        }
+    }
+
+    return dayMask != 0;
+}
+
+bool Schedule::parseClock(const std::string& field, int& minute)
+{
+    size_t colonPos = field.find(':');
+    if (colonPos == std::string::npos || colonPos == 0 || field.size() - colonPos != 3)
+    {
+        return false;
+    }
+
+    try
+    {
+        size_t consumed = 0;
+        int hours = std::stoi(field.substr(0, colonPos), &consumed);
+        if (consumed != colonPos)
+        {
+            return false;
+        }
+        int minutes = std::stoi(field.substr(colonPos + 1), &consumed);
+        if (consumed != 2)
+        {
+            return false;
+        }
+
+        if (hours < 0 || minutes < 0 || minutes > 59 || hours > 24 || (hours == 24 && minutes != 0))
+        {
+            return false;
+        }
+
+        minute = hours * 60 + minutes;
+        return true;
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
+std::tm Schedule::toLocalTime(std::chrono::system_clock::time_point time)
+{
+    std::time_t timeValue = std::chrono::system_clock::to_time_t(time);
+    std::tm localTime{};
+#ifdef _WIN32
+    localtime_s(&localTime, &timeValue);
+#else
+    localtime_r(&timeValue, &localTime);
+#endif
+    return localTime;
+}
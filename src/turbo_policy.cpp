@@ -0,0 +1,81 @@
+#include "turbo_policy.h"
+
+TurboPolicy::TurboPolicy(const TurboSettings& settings)
+    : m_settings{settings}
+    , m_tier{PowerTier::POWER_SAVE}
+    , m_burstSamples{0}
+    , m_enabled{false}
+    , m_thermalThrottled{false}
+    , m_windowUsed{0}
+{
+}
+
+bool TurboPolicy::update(double utilization, std::optional<double> temperature, std::chrono::steady_clock::time_point now)
+{
+    m_burstSamples = utilization >= m_settings.burstThreshold ? m_burstSamples + 1 : 0;
+    return evaluate(temperature, now);
+}
+
+bool TurboPolicy::evaluate(std::optional<double> temperature, std::chrono::steady_clock::time_point now)
+{
+    account(now);
+
+    if (temperature)
+    {
+        if (*temperature >= m_settings.thermalLimit)
+        {
+            m_thermalThrottled = true;
+        }
+        else if (*temperature <= m_settings.thermalLimit - m_settings.thermalHysteresis)
+        {
+            m_thermalThrottled = false;
+        }
+    }
+
+    bool wanted = m_tier == PowerTier::PERFORMANCE || m_burstSamples >= m_settings.burstSamples;
+    auto budget = std::chrono::duration_cast<std::chrono::milliseconds>(m_settings.window * m_settings.budget);
+    bool budgetSpent = m_windowUsed >= budget;
+
+    bool enabled = wanted && !budgetSpent && !m_thermalThrottled;
+    if (wanted && m_thermalThrottled)
+    {
+        ++m_metrics.thermalDenials;
+    }
+    else if (wanted && budgetSpent)
+    {
+        ++m_metrics.budgetDenials;
+    }
+    if (enabled && !m_enabled)
+    {
+        ++m_metrics.activations;
+    }
+
+    m_enabled = enabled;
+    return m_enabled;
+}
+
+void TurboPolicy::account(std::chrono::steady_clock::time_point now)
+{
+    if (!m_lastUpdate)
+    {
+        m_lastUpdate = now;
+        m_windowStart = now;
+        return;
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - *m_lastUpdate);
+    m_lastUpdate = now;
+    m_metrics.observed += elapsed;
+    if (m_enabled)
+    {
+        // The previous decision held until now
+        m_metrics.residency += elapsed;
+        m_windowUsed += elapsed;
+    }
+
+    if (now - m_windowStart >= m_settings.window)
+    {
+        m_windowStart = now;
+        m_windowUsed = std::chrono::milliseconds{0};
+    }
+}
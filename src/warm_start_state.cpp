@@ -0,0 +1,110 @@
+#include "warm_start_state.h"
+#include "logger.h"
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <system_error>
+
+WarmStartStore::WarmStartStore(std::string path)
+    : m_path{std::move(path)}
+{
+}
+
+std::optional<WarmStartState> WarmStartStore::load() const
+{
+    if (m_path.empty())
+    {
+        return std::nullopt;
+    }
+
+    std::ifstream file(m_path);
+    if (!file.is_open())
+    {
+        return std::nullopt;
+    }
+
+    std::map<std::string, std::string> values;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        size_t equalPos = line.find('=');
+        if (line.empty() || line[0] == '#' || equalPos == std::string::npos)
+        {
+            continue;
+        }
+        values[line.substr(0, equalPos)] = line.substr(equalPos + 1);
+    }
+
+    auto tier = parsePowerTier(values["tier"]);
+    if (values["version"] != std::to_string(STATE_VERSION) || values["backend"].empty() ||
+        (!tier && !values["tier"].empty()))
+    {
+        Logger::debug("Warm-start state in " + m_path + " is stale - ignoring it");
+        return std::nullopt;
+    }
+
+    WarmStartState state;
+    state.backend = values["backend"];
+    state.tier = tier;
+    try
+    {
+        state.runs = std::stoi(values["runs"]);
+        state.actuation.succeeded = std::stoi(values["actuation_succeeded"]);
+        state.actuation.partial = std::stoi(values["actuation_partial"]);
+        state.actuation.failed = std::stoi(values["actuation_failed"]);
+        state.conflicts = std::stoi(values["conflicts"]);
+    }
+    catch (const std::exception&)
+    {
+        Logger::debug("Warm-start state in " + m_path + " has unreadable counters - ignoring it");
+        return std::nullopt;
+    }
+    return state;
+}
+
+bool WarmStartStore::save(const WarmStartState& state) const
+{
+    if (m_path.empty())
+    {
+        return false;
+    }
+
+    std::filesystem::path path(m_path);
+    std::error_code error;
+    if (path.has_parent_path())
+    {
+        std::filesystem::create_directories(path.parent_path(), error);
+    }
+
+    // Write to a temporary file and rename so a crash never leaves a truncated state
+    std::filesystem::path tempPath = path;
+    tempPath += ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::trunc);
+        if (!file.is_open())
+        {
+            Logger::warning("Cannot write warm-start state: " + tempPath.string());
+            return false;
+        }
+
+        file << "# ddogreen warm-start state - delete this file to switch at the next start\n";
+        file << "version=" << STATE_VERSION << "\n";
+        file << "backend=" << state.backend << "\n";
+        file << "tier=" << (state.tier ? powerTierToString(*state.tier) : "") << "\n";
+        file << "runs=" << state.runs << "\n";
+        file << "actuation_succeeded=" << state.actuation.succeeded << "\n";
+        file << "actuation_partial=" << state.actuation.partial << "\n";
+        file << "actuation_failed=" << state.actuation.failed << "\n";
+        file << "conflicts=" << state.conflicts << "\n";
+    }
+
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        Logger::warning("Cannot write warm-start state: " + m_path + " (" + error.message() + ")");
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+    Logger::debug("Warm-start state saved in " + m_path);
+    return true;
+}
@@ -0,0 +1,62 @@
+#include "workload_classifier.h"
+#include <algorithm>
+
+std::string workloadClassToString(WorkloadClass workloadClass)
+{
+    switch (workloadClass)
+    {
+    case WorkloadClass::COMPUTE_BOUND:
+        return "compute-bound";
+    case WorkloadClass::MEMORY_BOUND:
+        return "memory-bound";
+    case WorkloadClass::UNKNOWN:
+        break;
+    }
+    return "unknown";
+}
+
+WorkloadClassifier::WorkloadClassifier(double memoryBoundThreshold)
+    : m_threshold{memoryBoundThreshold}
+    , m_class{WorkloadClass::UNKNOWN}
+    , m_ipc{0.0}
+    , m_memoryBoundedness{0.0}
+{
+}
+
+WorkloadClass WorkloadClassifier::update(const PerfCounters& counters)
+{
+    if (counters.cycles < MIN_CYCLES)
+    {
+        return m_class;
+    }
+
+    m_ipc = static_cast<double>(counters.instructions) / static_cast<double>(counters.cycles);
+    if (counters.stalledCycles)
+    {
+        m_memoryBoundedness = std::min(1.0, static_cast<double>(*counters.stalledCycles) / static_cast<double>(counters.cycles));
+    }
+    else if (counters.llcMisses && counters.instructions > 0)
+    {
+        double mpki = static_cast<double>(*counters.llcMisses) * 1000.0 / static_cast<double>(counters.instructions);
+        m_memoryBoundedness = std::min(1.0, mpki / MEMORY_BOUND_MPKI);
+    }
+    else
+    {
+        m_class = WorkloadClass::UNKNOWN;
+        return m_class;
+    }
+
+    if (m_class == WorkloadClass::MEMORY_BOUND)
+    {
+        if (m_memoryBoundedness < m_threshold - EXIT_MARGIN)
+        {
+            m_class = WorkloadClass::COMPUTE_BOUND;
+        }
+    }
+    else
+    {
+        m_class = m_memoryBoundedness >= m_threshold && m_ipc < MAX_MEMORY_BOUND_IPC ? WorkloadClass::MEMORY_BOUND
+                                                                                     : WorkloadClass::COMPUTE_BOUND;
+    }
+    return m_class;
+}
@@ -0,0 +1,193 @@
+#ifndef DDOGREEN_FAKE_POWER_PROFILES_BUS_H
+#define DDOGREEN_FAKE_POWER_PROFILES_BUS_H
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "platform/linux/linux_dbus.h"
+
+/**
+ * Private D-Bus stand-in serving a fake power-profiles-daemon
+ * Speaks SASL EXTERNAL, answers Hello and Properties.Get/Set for ActiveProfile
+ */
+class FakePowerProfilesBus {
+public:
+    FakePowerProfilesBus(const std::string& socketPath, const std::string& busName)
+        : m_socketPath(socketPath), m_busName(busName), m_running(true) {
+        unlink(m_socketPath.c_str());
+        m_listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        m_socketPath.copy(address.sun_path, sizeof(address.sun_path) - 1);
+        bind(m_listenFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+        listen(m_listenFd, 4);
+        m_thread = std::thread(&FakePowerProfilesBus::serve, this);
+    }
+
+    ~FakePowerProfilesBus() {
+        m_running = false;
+        m_thread.join();
+        close(m_listenFd);
+        unlink(m_socketPath.c_str());
+    }
+
+    std::string address() const { return "unix:path=" + m_socketPath; }
+
+    std::string activeProfile() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_activeProfile;
+    }
+
+    void setActiveProfile(const std::string& profile) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_activeProfile = profile;
+    }
+
+    void setPerformanceAvailable(bool available) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_performanceAvailable = available;
+    }
+
+    int connectionCount() const { return m_connections.load(); }
+    int setCount() const { return m_setCalls.load(); }
+
+private:
+    void serve() {
+        while (m_running) {
+            pollfd pfd{m_listenFd, POLLIN, 0};
+            if (poll(&pfd, 1, 50) <= 0) {
+                continue;
+            }
+            int clientFd = accept4(m_listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+            if (clientFd < 0) {
+                continue;
+            }
+            ++m_connections;
+            handleClient(clientFd);
+            close(clientFd);
+        }
+    }
+
+    void handleClient(int fd) {
+        std::vector<uint8_t> buffer;
+        bool authenticated = false;
+
+        while (m_running) {
+            pollfd pfd{fd, POLLIN, 0};
+            if (poll(&pfd, 1, 50) <= 0) {
+                continue;
+            }
+            uint8_t chunk[4096];
+            ssize_t received = recv(fd, chunk, sizeof(chunk), 0);
+            if (received <= 0) {
+                return;
+            }
+            buffer.insert(buffer.end(), chunk, chunk + received);
+
+            while (!authenticated) {
+                if (!buffer.empty() && buffer.front() == 0) {
+                    buffer.erase(buffer.begin());
+                }
+                std::string text(buffer.begin(), buffer.end());
+                size_t lineEnd = text.find("\r\n");
+                if (lineEnd == std::string::npos) {
+                    break;
+                }
+                std::string line = text.substr(0, lineEnd);
+                buffer.erase(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(lineEnd + 2));
+                if (line.starts_with("AUTH EXTERNAL")) {
+                    sendText(fd, "OK 0123456789abcdef0123456789abcdef\r\n");
+                } else if (line == "BEGIN") {
+                    authenticated = true;
+                } else {
+                    sendText(fd, "ERROR\r\n");
+                }
+            }
+
+            size_t consumed = 0;
+            while (authenticated && DBusMessage::completeSize(buffer) > 0) {
+                auto message = DBusMessage::parse(buffer, consumed);
+                if (!message) {
+                    return;
+                }
+                buffer.erase(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(consumed));
+                handleMessage(fd, *message);
+            }
+        }
+    }
+
+    void handleMessage(int fd, const DBusMessage& message) {
+        DBusMessage reply;
+        reply.type = DBusMessage::METHOD_RETURN;
+        reply.serial = ++m_serial;
+        reply.replySerial = message.serial;
+        reply.destination = ":1.42";
+
+        if (message.member == "Hello") {
+            reply.sender = "org.freedesktop.DBus";
+            reply.signature = "s";
+            DBusWriter body;
+            body.writeString(":1.42");
+            reply.body = body.data();
+        } else if (message.destination != m_busName) {
+            setError(reply, "org.freedesktop.DBus.Error.ServiceUnknown");
+        } else if (message.member == "Get") {
+            reply.signature = "v";
+            DBusWriter body;
+            body.writeVariantString(activeProfile());
+            reply.body = body.data();
+        } else if (message.member == "Set") {
+            ++m_setCalls;
+            std::string interfaceName, property, profile;
+            DBusReader reader = message.bodyReader();
+            reader.readString(interfaceName);
+            reader.readString(property);
+            reader.readVariant(profile);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (property != "ActiveProfile" || (profile == "performance" && !m_performanceAvailable)) {
+                setError(reply, "org.freedesktop.DBus.Error.InvalidArgs");
+            } else {
+                m_activeProfile = profile;
+            }
+        } else {
+            setError(reply, "org.freedesktop.DBus.Error.UnknownMethod");
+        }
+
+        std::vector<uint8_t> wire = reply.serialize();
+        send(fd, wire.data(), wire.size(), MSG_NOSIGNAL);
+    }
+
+    static void setError(DBusMessage& reply, const std::string& name) {
+        reply.type = DBusMessage::ERROR;
+        reply.errorName = name;
+        reply.signature = "s";
+        DBusWriter body;
+        body.writeString("fake bus error");
+        reply.body = body.data();
+    }
+
+    static void sendText(int fd, const std::string& text) {
+        send(fd, text.data(), text.size(), MSG_NOSIGNAL);
+    }
+
+    std::string m_socketPath;
+    std::string m_busName;
+    int m_listenFd{-1};
+    std::atomic<bool> m_running;
+    std::atomic<int> m_connections{0};
+    std::atomic<int> m_setCalls{0};
+    uint32_t m_serial{0};
+    std::mutex m_mutex;
+    std::string m_activeProfile{"balanced"};
+    bool m_performanceAvailable{true};
+    std::thread m_thread;
+};
+
+#endif // DDOGREEN_FAKE_POWER_PROFILES_BUS_H
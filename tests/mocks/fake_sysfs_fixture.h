@@ -0,0 +1,53 @@
+#ifndef DDOGREEN_FAKE_SYSFS_FIXTURE_H
+#define DDOGREEN_FAKE_SYSFS_FIXTURE_H
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+
+/**
+ * Test fixture base owning a per-process fake root for sysfs, procfs and cgroupfs trees
+ * Suites extend SetUp with the files their component reads
+ */
+class FakeSysfsTest : public ::testing::Test {
+protected:
+    /**
+     * @param name suite name, unique among the test executables
+     */
+    explicit FakeSysfsTest(const std::string& name)
+        : root(std::filesystem::temp_directory_path() / ("ddogreen_fake_" + name + "_" + std::to_string(getpid()))) {}
+
+    void SetUp() override {
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(root);
+
+        // Suppress logger output during tests
+        Logger::setLevel(LogLevel::ERROR);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(root);
+        Logger::setLevel(LogLevel::INFO);
+    }
+
+    /**
+     * Write a file with its parent directories, newline terminated as the kernel does
+     */
+    void writeFile(const std::filesystem::path& path, const std::string& content) {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream file(path);
+        file << content << "\n";
+    }
+
+    std::string readFile(const std::filesystem::path& path) {
+        return LinuxSysfs::readAttribute(path.string()).value_or("<missing>");
+    }
+
+    const std::filesystem::path root;
+};
+
+#endif // DDOGREEN_FAKE_SYSFS_FIXTURE_H
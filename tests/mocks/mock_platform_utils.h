@@ -13,6 +13,7 @@ public:
     MOCK_METHOD(std::string, getDefaultLogPath, (), (const, override));
     MOCK_METHOD(std::string, getDefaultPidPath, (), (const, override));
     MOCK_METHOD(std::string, getDefaultConfigPath, (), (const, override));
+    MOCK_METHOD(std::string, getDefaultStateDirectory, (), (const, override));
     MOCK_METHOD(bool, isAvailable, (), (const, override));
     MOCK_METHOD(std::string, getPrivilegeEscalationMessage, (), (const, override));
     MOCK_METHOD(std::string, resolveAbsolutePath, (const std::string& relativePath), (const, override));
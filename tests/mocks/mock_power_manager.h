@@ -10,6 +10,14 @@ public:
     MOCK_METHOD(bool, setPowerSavingMode, (), (override));
     MOCK_METHOD(std::string, getCurrentMode, (), (override));
     MOCK_METHOD(bool, isAvailable, (), (override));
+    MOCK_METHOD(std::string, getBackendName, (), (const, override));
+    MOCK_METHOD(bool, reapplyCurrentMode, (), (override));
+    MOCK_METHOD(bool, supportsControlDomains, (), (const, override));
+    MOCK_METHOD(bool, setTier, (PowerTier tier), (override));
+    MOCK_METHOD(bool, confirmTier, (PowerTier tier), (override));
+    MOCK_METHOD(bool, setDomainTier, (const ControlDomain& domain, PowerTier tier), (override));
+    MOCK_METHOD(std::vector<ExternalChange>, detectExternalChanges, (), (override));
+    MOCK_METHOD(void, ignoreExternalChanges, (const std::vector<std::string>& settings), (override));
 };
 
 #endif // DDOGREEN_MOCK_POWER_MANAGER_H
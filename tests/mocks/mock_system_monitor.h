@@ -10,6 +10,10 @@ public:
     MOCK_METHOD(int, getCpuCoreCount, (), (override));
     MOCK_METHOD(bool, isAvailable, (), (override));
     MOCK_METHOD(void, setMonitoringFrequency, (int frequencySeconds), (override));
+    MOCK_METHOD(std::vector<ControlDomain>, getControlDomains, (ControlDomainScope scope), (override));
+    MOCK_METHOD(bool, sampleCpuUtilization, (std::vector<double>& utilization), (override));
+    MOCK_METHOD(CpuTopology, getCpuTopology, (), (override));
+    MOCK_METHOD(bool, refreshOnlineCpus, (), (override));
 };
 
 #endif // DDOGREEN_MOCK_SYSTEM_MONITOR_H
@@ -1,9 +1,13 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <atomic>
+#include <mutex>
 #include <thread>
 #include <chrono>
+#include <map>
 #include "activity_monitor.h"
 #include "logger.h"
+#include "mocks/mock_power_manager.h"
 #include "mocks/mock_system_monitor.h"
 
 using ::testing::_;
@@ -314,3 +318,213 @@ TEST_F(TestActivityMonitor, test_destructor_cleanup) {
     // If we reach here without hanging, destructor worked correctly
     SUCCEED();
 }
+
+// Test capacity-weighted thresholds
+TEST_F(TestActivityMonitor, test_thresholds_scale_with_cpu_capacity) {
+    auto systemMonitor = std::make_unique<::testing::NiceMock<MockSystemMonitor>>();
+    ON_CALL(*systemMonitor, isAvailable()).WillByDefault(Return(true));
+    ON_CALL(*systemMonitor, getCpuCoreCount()).WillByDefault(Return(4));
+    ON_CALL(*systemMonitor, getLoadAverage()).WillByDefault(Return(2.5));
+    // Two P-cores and two E-cores at half capacity - 3.0 capacity units for 4 CPUs
+    ON_CALL(*systemMonitor, getCpuTopology()).WillByDefault(Return(CpuTopology({
+        {0, CoreType::PERFORMANCE, 1024, 0, 0, 0, {0}},
+        {1, CoreType::PERFORMANCE, 1024, 0, 1, 0, {1}},
+        {2, CoreType::EFFICIENCY, 512, 0, 8, 0, {2}},
+        {3, CoreType::EFFICIENCY, 512, 0, 9, 0, {3}}})));
+
+    ActivityMonitor monitor(std::move(systemMonitor));
+    std::vector<PowerTier> tiers;
+    monitor.setTierCallback([&](PowerTier tier) { tiers.push_back(tier); return true; });
+    monitor.setMonitoringFrequency(10);
+    monitor.setLoadThresholds(0.7, 0.3);
+
+    ASSERT_TRUE(monitor.start());
+    monitor.stop();
+
+    // 2.5 exceeds 0.7 * 3.0 capacity, but would stay below 0.7 * 4 CPUs
+    EXPECT_TRUE(monitor.getCpuTopology().isHybrid());
+    EXPECT_EQ((std::vector<PowerTier>{PowerTier::PERFORMANCE}), tiers);
+}
+
+// Test per-policy control domains
+TEST_F(TestActivityMonitor, test_control_domains_decide_independently) {
+    auto systemMonitor = std::make_unique<::testing::NiceMock<MockSystemMonitor>>();
+    ON_CALL(*systemMonitor, isAvailable()).WillByDefault(Return(true));
+    ON_CALL(*systemMonitor, getCpuCoreCount()).WillByDefault(Return(4));
+    ON_CALL(*systemMonitor, getControlDomains(ControlDomainScope::CPUFREQ_POLICY)).WillByDefault(Return(std::vector<ControlDomain>{
+        {"policy0", {0, 1}}, {"policy2", {2, 3}}}));
+    // P-cores busy, E-cores idle
+    ON_CALL(*systemMonitor, sampleCpuUtilization(_)).WillByDefault([](std::vector<double>& utilization) {
+        utilization = {0.90, 0.80, 0.05, 0.10};
+        return true;
+    });
+
+    ActivityMonitor monitor(std::move(systemMonitor));
+    std::map<std::string, PowerTier> domainTiers;
+    std::vector<PowerTier> systemTiers;
+    monitor.setDomainTierCallback([&](const ControlDomain& domain, PowerTier tier) { domainTiers[domain.name] = tier; return true; });
+    monitor.setTierCallback([&](PowerTier tier) { systemTiers.push_back(tier); return true; });
+    monitor.setControlDomainScope(ControlDomainScope::CPUFREQ_POLICY);
+    monitor.setMonitoringFrequency(10);
+    monitor.setLoadThresholds(0.7, 0.3);
+
+    ASSERT_TRUE(monitor.start());
+    monitor.stop();
+
+    EXPECT_TRUE(monitor.usesControlDomains());
+    EXPECT_EQ(PowerTier::PERFORMANCE, domainTiers["policy0"]);
+    EXPECT_EQ(PowerTier::POWER_SAVE, domainTiers["policy2"]);
+    // The system-wide tier follows the busiest domain
+    EXPECT_EQ((std::vector<PowerTier>{PowerTier::PERFORMANCE}), systemTiers);
+}
+
+TEST_F(TestActivityMonitor, test_control_domains_start_from_load_without_utilization_sample) {
+    auto systemMonitor = std::make_unique<::testing::NiceMock<MockSystemMonitor>>();
+    ON_CALL(*systemMonitor, isAvailable()).WillByDefault(Return(true));
+    ON_CALL(*systemMonitor, getCpuCoreCount()).WillByDefault(Return(4));
+    ON_CALL(*systemMonitor, getLoadAverage()).WillByDefault(Return(3.5));
+    ON_CALL(*systemMonitor, getControlDomains(ControlDomainScope::CPUFREQ_POLICY)).WillByDefault(Return(std::vector<ControlDomain>{
+        {"policy0", {0, 1}}, {"policy2", {2, 3}}}));
+    ON_CALL(*systemMonitor, sampleCpuUtilization(_)).WillByDefault(Return(false));
+
+    ActivityMonitor monitor(std::move(systemMonitor));
+    std::map<std::string, PowerTier> domainTiers;
+    monitor.setDomainTierCallback([&](const ControlDomain& domain, PowerTier tier) { domainTiers[domain.name] = tier; return true; });
+    monitor.setControlDomainScope(ControlDomainScope::CPUFREQ_POLICY);
+    monitor.setMonitoringFrequency(10);
+    monitor.setLoadThresholds(0.7, 0.3);
+
+    ASSERT_TRUE(monitor.start());
+    monitor.stop();
+
+    EXPECT_EQ(PowerTier::PERFORMANCE, domainTiers["policy0"]);
+    EXPECT_EQ(PowerTier::PERFORMANCE, domainTiers["policy2"]);
+}
+
+TEST_F(TestActivityMonitor, test_single_control_domain_uses_system_wide_control) {
+    auto systemMonitor = std::make_unique<::testing::NiceMock<MockSystemMonitor>>();
+    ON_CALL(*systemMonitor, isAvailable()).WillByDefault(Return(true));
+    ON_CALL(*systemMonitor, getCpuCoreCount()).WillByDefault(Return(4));
+    ON_CALL(*systemMonitor, getLoadAverage()).WillByDefault(Return(0.2));
+    ON_CALL(*systemMonitor, getControlDomains(ControlDomainScope::CPUFREQ_POLICY)).WillByDefault(Return(std::vector<ControlDomain>{
+        {"policy0", {0, 1, 2, 3}}}));
+
+    ActivityMonitor monitor(std::move(systemMonitor));
+    int domainCalls = 0;
+    std::vector<PowerTier> systemTiers;
+    monitor.setDomainTierCallback([&](const ControlDomain&, PowerTier) { ++domainCalls; return true; });
+    monitor.setTierCallback([&](PowerTier tier) { systemTiers.push_back(tier); return true; });
+    monitor.setControlDomainScope(ControlDomainScope::CPUFREQ_POLICY);
+    monitor.setMonitoringFrequency(10);
+    monitor.setLoadThresholds(0.7, 0.3);
+
+    ASSERT_TRUE(monitor.start());
+    monitor.stop();
+
+    EXPECT_FALSE(monitor.usesControlDomains());
+    EXPECT_EQ(0, domainCalls);
+    EXPECT_EQ((std::vector<PowerTier>{PowerTier::POWER_SAVE}), systemTiers);
+}
+
+// Test suspend/resume resynchronisation
+TEST_F(TestActivityMonitor, test_resume_resamples_load_and_reapplies_tier) {
+    class FakeSleepMonitor : public ISleepMonitor {
+    public:
+        std::optional<std::chrono::milliseconds> getSuspendedTime() override { return std::chrono::milliseconds(suspended.load()); }
+        bool start(std::function<void()> callback) override { onWake = std::move(callback); return true; }
+        void stop() override {}
+
+        std::atomic<long long> suspended{0};
+        std::function<void()> onWake;
+    };
+
+    auto systemMonitor = std::make_unique<::testing::NiceMock<MockSystemMonitor>>();
+    ON_CALL(*systemMonitor, isAvailable()).WillByDefault(Return(true));
+    ON_CALL(*systemMonitor, getCpuCoreCount()).WillByDefault(Return(4));
+    // The load average still shows the busy period before the suspend; the CPUs are idle now
+    ON_CALL(*systemMonitor, getLoadAverage()).WillByDefault(Return(3.5));
+    ON_CALL(*systemMonitor, sampleCpuUtilization(_)).WillByDefault([](std::vector<double>& utilization) {
+        utilization = {0.02, 0.05, 0.01, 0.03};
+        return true;
+    });
+    auto sleepMonitor = std::make_unique<FakeSleepMonitor>();
+    FakeSleepMonitor* sleep = sleepMonitor.get();
+
+    ActivityMonitor monitor(std::move(systemMonitor));
+    std::mutex tiersMutex;
+    std::vector<PowerTier> tiers;
+    std::atomic<int> resumes{0};
+    monitor.setTierCallback([&](PowerTier tier) {
+        std::lock_guard<std::mutex> lock(tiersMutex);
+        tiers.push_back(tier);
+        return true;
+    });
+    monitor.setResumeCallback([&]() { ++resumes; });
+    monitor.setSleepMonitor(std::move(sleepMonitor));
+    monitor.setMonitoringFrequency(10);
+    monitor.setLoadThresholds(0.7, 0.3);
+    ASSERT_TRUE(monitor.start());
+
+    // A clock set without suspended time is not a resume
+    sleep->onWake();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    EXPECT_EQ(0, resumes.load());
+
+    auto resumed = std::chrono::steady_clock::now();
+    sleep->suspended = 3600000;
+    sleep->onWake();
+    bool applied = false;
+    while (!applied && std::chrono::steady_clock::now() - resumed < std::chrono::seconds(2)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        std::lock_guard<std::mutex> lock(tiersMutex);
+        applied = tiers.size() == 2;
+    }
+    auto elapsed = std::chrono::steady_clock::now() - resumed;
+    monitor.stop();
+
+    EXPECT_EQ(1, resumes.load());
+    EXPECT_EQ((std::vector<PowerTier>{PowerTier::PERFORMANCE, PowerTier::POWER_SAVE}), tiers);
+    EXPECT_LT(elapsed, std::chrono::seconds(1));
+}
+
+// Test that a switch the backend did not apply is requested again at the next check
+TEST_F(TestActivityMonitor, test_failed_tier_switch_is_retried_at_next_check) {
+    class FakeSleepMonitor : public ISleepMonitor {
+    public:
+        std::optional<std::chrono::milliseconds> getSuspendedTime() override { return std::chrono::milliseconds(0); }
+        bool start(std::function<void()> callback) override { onWake = std::move(callback); return true; }
+        void stop() override {}
+
+        std::function<void()> onWake;
+    };
+
+    auto systemMonitor = std::make_unique<::testing::NiceMock<MockSystemMonitor>>();
+    ON_CALL(*systemMonitor, isAvailable()).WillByDefault(Return(true));
+    ON_CALL(*systemMonitor, getCpuCoreCount()).WillByDefault(Return(4));
+    ON_CALL(*systemMonitor, getLoadAverage()).WillByDefault(Return(0.5));
+    auto sleepMonitor = std::make_unique<FakeSleepMonitor>();
+    FakeSleepMonitor* sleep = sleepMonitor.get();
+
+    // Rate limited, deferred or unverified: the first switch does not apply
+    ::testing::NiceMock<MockPowerManager> backend;
+    EXPECT_CALL(backend, setTier(PowerTier::POWER_SAVE)).WillOnce(Return(false)).WillOnce(Return(true));
+
+    // The retry only switches the backend, not every actuator of the tier callback
+    std::atomic<int> tierCalls{0};
+    ActivityMonitor monitor(std::move(systemMonitor));
+    monitor.setTierCallback([&](PowerTier tier) { ++tierCalls; return backend.setTier(tier); });
+    monitor.setTierRetryCallback([&](PowerTier tier) { return backend.setTier(tier); });
+    monitor.setSleepMonitor(std::move(sleepMonitor));
+    monitor.setMonitoringFrequency(1);
+    monitor.setLoadThresholds(0.7, 0.3);
+    ASSERT_TRUE(monitor.start());
+
+    // The wakeup ends the monitor sleep early; a check is due after the monitoring interval
+    for (int check = 0; check < 2; ++check) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+        sleep->onWake();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    monitor.stop();
+    EXPECT_EQ(1, tierCalls.load());
+}
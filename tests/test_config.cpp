@@ -547,3 +547,465 @@ TEST_F(TestConfig, test_load_from_file_rejects_comments_only_file)
     // Assert
     EXPECT_FALSE(result);
 }
+
+// Test schedule configuration
+TEST_F(TestConfig, test_load_from_file_parses_schedule_section)
+{
+    // Arrange
+    std::string scheduleConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n"
+        "schedule_profile.batch=high=0.9,low=0.5\n"
+        "schedule_profile.build=hold=performance\n"
+        "schedule=* 02:00-03:00 build\n"
+        "schedule=* 18:00-09:00 batch\n";
+
+    createConfigFile("schedule.conf", scheduleConfig);
+    std::string configPath = getTestFilePath("schedule.conf");
+
+    // Act
+    bool result = config->loadFromFile(configPath);
+
+    // Assert
+    EXPECT_TRUE(result);
+    EXPECT_EQ(2u, config->getSchedule().getProfiles().size());
+    EXPECT_EQ(2u, config->getSchedule().getWindows().size());
+}
+
+TEST_F(TestConfig, test_load_from_file_rejects_schedule_with_undefined_profile)
+{
+    // Arrange
+    std::string scheduleConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n"
+        "schedule=mon-fri 09:00-18:00 interactive\n";
+
+    createConfigFile("schedule_undefined.conf", scheduleConfig);
+    std::string configPath = getTestFilePath("schedule_undefined.conf");
+
+    // Act
+    bool result = config->loadFromFile(configPath);
+
+    // Assert
+    EXPECT_FALSE(result);
+}
+
+TEST_F(TestConfig, test_load_from_file_rejects_schedule_profile_breaking_hysteresis)
+{
+    // Arrange - profile raises only the low threshold above the base high threshold
+    std::string scheduleConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n"
+        "schedule_profile.night=low=0.8\n"
+        "schedule=* 22:00-06:00 night\n";
+
+    createConfigFile("schedule_hysteresis.conf", scheduleConfig);
+    std::string configPath = getTestFilePath("schedule_hysteresis.conf");
+
+    // Act
+    bool result = config->loadFromFile(configPath);
+
+    // Assert
+    EXPECT_FALSE(result);
+}
+
+TEST_F(TestConfig, test_load_from_file_parses_power_backend_order)
+{
+    // Arrange
+    std::string backendConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n"
+        "power_backend=epp, ppd,tlp\n";
+
+    createConfigFile("power_backend.conf", backendConfig);
+    std::string configPath = getTestFilePath("power_backend.conf");
+
+    // Act
+    bool result = config->loadFromFile(configPath);
+
+    // Assert
+    EXPECT_TRUE(result);
+    EXPECT_EQ((std::vector<std::string>{"epp", "ppd", "tlp"}), config->getPowerBackendOrder());
+}
+
+TEST_F(TestConfig, test_power_backend_defaults_to_auto_and_rejects_invalid_lists)
+{
+    // Arrange
+    std::string baseConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n";
+
+    createConfigFile("power_backend_auto.conf", baseConfig + "power_backend=auto\n");
+    createConfigFile("power_backend_duplicate.conf", baseConfig + "power_backend=tlp,tlp\n");
+    createConfigFile("power_backend_invalid.conf", baseConfig + "power_backend=tlp,,ppd\n");
+
+    // Act & Assert
+    EXPECT_TRUE(config->loadFromFile(getTestFilePath("power_backend_auto.conf")));
+    EXPECT_TRUE(config->getPowerBackendOrder().empty());
+
+    Config duplicateConfig;
+    EXPECT_FALSE(duplicateConfig.loadFromFile(getTestFilePath("power_backend_duplicate.conf")));
+
+    Config invalidConfig;
+    EXPECT_FALSE(invalidConfig.loadFromFile(getTestFilePath("power_backend_invalid.conf")));
+}
+
+TEST_F(TestConfig, test_load_from_file_parses_knob_profiles)
+{
+    // Arrange
+    std::string knobConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n"
+        "knob.power=vm.dirty_writeback_centisecs=1500\n"
+        "knob.power = /sys/devices/system/cpu/cpufreq/policy*/schedutil/rate_limit_us = 10000\n"
+        "knob.performance=/sys/module/pcie_aspm/parameters/policy=performance\n"
+        "knob.performance=net/ipv4/conf/eth0.100/rp_filter=1\n";
+
+    createConfigFile("knobs.conf", knobConfig);
+    std::string configPath = getTestFilePath("knobs.conf");
+
+    // Act
+    bool result = config->loadFromFile(configPath);
+
+    // Assert
+    EXPECT_TRUE(result);
+    const KnobProfiles& profiles = config->getKnobProfiles();
+    const auto& powerSave = profiles[static_cast<size_t>(PowerTier::POWER_SAVE)];
+    ASSERT_EQ(2u, powerSave.size());
+    EXPECT_EQ("vm.dirty_writeback_centisecs", powerSave[0].target);
+    EXPECT_EQ("1500", powerSave[0].value);
+    EXPECT_EQ("/sys/devices/system/cpu/cpufreq/policy*/schedutil/rate_limit_us", powerSave[1].target);
+    EXPECT_EQ("10000", powerSave[1].value);
+    EXPECT_TRUE(profiles[static_cast<size_t>(PowerTier::BALANCED_POWER)].empty());
+    ASSERT_EQ(2u, profiles[static_cast<size_t>(PowerTier::PERFORMANCE)].size());
+    EXPECT_EQ("net/ipv4/conf/eth0.100/rp_filter", profiles[static_cast<size_t>(PowerTier::PERFORMANCE)][1].target);
+}
+
+TEST_F(TestConfig, test_knob_profiles_reject_invalid_entries)
+{
+    // Arrange
+    std::string baseConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n";
+
+    createConfigFile("knob_tier.conf", baseConfig + "knob.turbo=vm.laptop_mode=5\n");
+    createConfigFile("knob_syntax.conf", baseConfig + "knob.power=vm.laptop_mode\n");
+    createConfigFile("knob_traversal.conf", baseConfig + "knob.power=/sys/../etc/passwd=x\n");
+    createConfigFile("knob_empty.conf", baseConfig + "knob.power=vm.laptop_mode=\n");
+    createConfigFile("knob_sysctl_traversal.conf", baseConfig + "knob.power=net/../../../etc/passwd=x\n");
+
+    // Act & Assert
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("knob_tier.conf")));
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("knob_syntax.conf")));
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("knob_traversal.conf")));
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("knob_empty.conf")));
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("knob_sysctl_traversal.conf")));
+}
+
+TEST_F(TestConfig, test_load_from_file_parses_control_domain_scope)
+{
+    // Arrange
+    std::string baseConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n";
+
+    createConfigFile("domains_default.conf", baseConfig);
+    createConfigFile("domains_package.conf", baseConfig + "control_domains=package\n");
+    createConfigFile("domains_invalid.conf", baseConfig + "control_domains=socket\n");
+
+    // Act & Assert
+    Config defaults;
+    ASSERT_TRUE(defaults.loadFromFile(getTestFilePath("domains_default.conf")));
+    EXPECT_EQ(ControlDomainScope::SYSTEM, defaults.getControlDomainScope());
+
+    Config package;
+    ASSERT_TRUE(package.loadFromFile(getTestFilePath("domains_package.conf")));
+    EXPECT_EQ(ControlDomainScope::PACKAGE, package.getControlDomainScope());
+
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("domains_invalid.conf")));
+}
+
+TEST_F(TestConfig, test_load_from_file_parses_frequency_cap_target)
+{
+    // Arrange
+    std::string baseConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n";
+
+    createConfigFile("cap_default.conf", baseConfig);
+    createConfigFile("cap_set.conf", baseConfig + "frequency_cap_target=0.80\n");
+    createConfigFile("cap_range.conf", baseConfig + "frequency_cap_target=1.5\n");
+
+    // Act & Assert
+    Config defaults;
+    ASSERT_TRUE(defaults.loadFromFile(getTestFilePath("cap_default.conf")));
+    EXPECT_FALSE(defaults.getFrequencyCapTarget().has_value());
+
+    Config capped;
+    ASSERT_TRUE(capped.loadFromFile(getTestFilePath("cap_set.conf")));
+    EXPECT_DOUBLE_EQ(0.80, capped.getFrequencyCapTarget().value());
+
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("cap_range.conf")));
+}
+
+TEST_F(TestConfig, test_load_from_file_parses_energy_model_tables)
+{
+    // Arrange
+    std::string baseConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n";
+
+    createConfigFile("em_set.conf", baseConfig + "energy_model.cpu4=1000000:80,2000000:250\n");
+    createConfigFile("em_domain.conf", baseConfig + "energy_model.gpu=1000000:80\n");
+    createConfigFile("em_table.conf", baseConfig + "energy_model.cpu0=1000000\n");
+
+    // Act & Assert
+    Config tables;
+    ASSERT_TRUE(tables.loadFromFile(getTestFilePath("em_set.conf")));
+    ASSERT_EQ(1u, tables.getEnergyModelTables().size());
+    ASSERT_EQ(2u, tables.getEnergyModelTables().at(4).size());
+    EXPECT_EQ(2000000, tables.getEnergyModelTables().at(4)[1].frequencyKhz);
+
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("em_domain.conf")));
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("em_table.conf")));
+}
+
+TEST_F(TestConfig, test_load_from_file_parses_pm_qos_settings)
+{
+    // Arrange
+    std::string baseConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n";
+
+    createConfigFile("qos_set.conf", baseConfig + "pm_qos_latency_us=20\npm_qos_per_cpu=true\n");
+    createConfigFile("qos_range.conf", baseConfig + "pm_qos_latency_us=-1\n");
+
+    // Act & Assert
+    Config qos;
+    ASSERT_TRUE(qos.loadFromFile(getTestFilePath("qos_set.conf")));
+    EXPECT_EQ(20, qos.getPmQosLatency().value());
+    EXPECT_TRUE(qos.getPmQosPerCpu());
+    EXPECT_FALSE(Config().getPmQosLatency().has_value());
+
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("qos_range.conf")));
+}
+
+TEST_F(TestConfig, test_load_from_file_parses_park_cpus)
+{
+    // Arrange
+    std::string baseConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n";
+
+    createConfigFile("park_set.conf", baseConfig + "park_cpus=6-7,2,4-5,6\n");
+    createConfigFile("park_boot.conf", baseConfig + "park_cpus=0-3\n");
+    createConfigFile("park_syntax.conf", baseConfig + "park_cpus=4-x\n");
+
+    // Act & Assert
+    Config parking;
+    ASSERT_TRUE(parking.loadFromFile(getTestFilePath("park_set.conf")));
+    EXPECT_EQ((std::vector<int>{2, 4, 5, 6, 7}), parking.getParkCpus());
+
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("park_boot.conf")));
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("park_syntax.conf")));
+}
+
+TEST_F(TestConfig, test_load_from_file_parses_irq_affinity_settings)
+{
+    // Arrange
+    std::string baseConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n";
+
+    createConfigFile("irq_set.conf", baseConfig + "irq_housekeeping_cpus=0-1\nirq_max_rate=500\n");
+    createConfigFile("irq_syntax.conf", baseConfig + "irq_housekeeping_cpus=0,x\n");
+    createConfigFile("irq_range.conf", baseConfig + "irq_max_rate=5\n");
+
+    // Act & Assert
+    Config irq;
+    ASSERT_TRUE(irq.loadFromFile(getTestFilePath("irq_set.conf")));
+    EXPECT_EQ((std::vector<int>{0, 1}), irq.getIrqHousekeepingCpus());
+    EXPECT_EQ(500, irq.getIrqMaxRate());
+    EXPECT_TRUE(Config().getIrqHousekeepingCpus().empty());
+    EXPECT_EQ(1000, Config().getIrqMaxRate());
+
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("irq_syntax.conf")));
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("irq_range.conf")));
+}
+
+TEST_F(TestConfig, test_load_from_file_parses_cpuset_cgroups)
+{
+    // Arrange
+    std::string baseConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n";
+
+    createConfigFile("cpuset_set.conf", baseConfig + "cpuset_cgroups=system.slice, user.slice/user@1000.service\n");
+    createConfigFile("cpuset_escape.conf", baseConfig + "cpuset_cgroups=system.slice/../..\n");
+    createConfigFile("cpuset_root.conf", baseConfig + "cpuset_cgroups=/\n");
+
+    // Act & Assert
+    Config cgroups;
+    ASSERT_TRUE(cgroups.loadFromFile(getTestFilePath("cpuset_set.conf")));
+    EXPECT_EQ((std::vector<std::string>{"system.slice", "user.slice/user@1000.service"}), cgroups.getCpusetCgroups());
+    EXPECT_TRUE(Config().getCpusetCgroups().empty());
+
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("cpuset_escape.conf")));
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("cpuset_root.conf")));
+}
+
+TEST_F(TestConfig, test_load_from_file_parses_uclamp_settings)
+{
+    // Arrange
+    std::string baseConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n";
+
+    createConfigFile("uclamp_set.conf", baseConfig +
+                     "uclamp_min_cgroups=user.slice\nuclamp_min=30\nuclamp_max_cgroups=background.slice\nuclamp_max=40\n");
+    createConfigFile("uclamp_range.conf", baseConfig + "uclamp_max=0\n");
+
+    // Act & Assert
+    Config clamps;
+    ASSERT_TRUE(clamps.loadFromFile(getTestFilePath("uclamp_set.conf")));
+    EXPECT_EQ((std::vector<std::string>{"user.slice"}), clamps.getUclampMinCgroups());
+    EXPECT_EQ(30, clamps.getUclampMin());
+    EXPECT_EQ((std::vector<std::string>{"background.slice"}), clamps.getUclampMaxCgroups());
+    EXPECT_EQ(40, clamps.getUclampMax());
+    EXPECT_EQ(25, Config().getUclampMin());
+    EXPECT_EQ(50, Config().getUclampMax());
+
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("uclamp_range.conf")));
+}
+
+TEST_F(TestConfig, test_load_from_file_parses_idle_injection_settings)
+{
+    // Arrange
+    std::string baseConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n";
+
+    createConfigFile("idle_set.conf", baseConfig +
+                     "idle_injection_power_limit=15\nidle_injection_thermal_limit=80\nidle_injection_cgroups=background.slice\n");
+    createConfigFile("idle_range.conf", baseConfig + "idle_injection_thermal_limit=120\n");
+
+    // Act & Assert
+    Config budget;
+    ASSERT_TRUE(budget.loadFromFile(getTestFilePath("idle_set.conf")));
+    EXPECT_DOUBLE_EQ(15.0, budget.getIdleInjectionPowerLimit().value());
+    EXPECT_DOUBLE_EQ(80.0, budget.getIdleInjectionThermalLimit().value());
+    EXPECT_EQ((std::vector<std::string>{"background.slice"}), budget.getIdleInjectionCgroups());
+    EXPECT_FALSE(Config().getIdleInjectionPowerLimit().has_value());
+
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("idle_range.conf")));
+}
+
+TEST_F(TestConfig, test_load_from_file_parses_perf_counter_settings)
+{
+    // Arrange
+    std::string baseConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n";
+
+    createConfigFile("perf_set.conf", baseConfig + "perf_counters=true\nmemory_bound_threshold=0.6\n");
+    createConfigFile("perf_range.conf", baseConfig + "memory_bound_threshold=0.95\n");
+    createConfigFile("perf_invalid.conf", baseConfig + "perf_counters=yes\n");
+
+    // Act & Assert
+    Config counters;
+    ASSERT_TRUE(counters.loadFromFile(getTestFilePath("perf_set.conf")));
+    EXPECT_TRUE(counters.getPerfCounters());
+    EXPECT_DOUBLE_EQ(0.6, counters.getMemoryBoundThreshold());
+    EXPECT_FALSE(Config().getPerfCounters());
+    EXPECT_DOUBLE_EQ(0.5, Config().getMemoryBoundThreshold());
+
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("perf_range.conf")));
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("perf_invalid.conf")));
+}
+
+TEST_F(TestConfig, test_load_from_file_parses_external_change_policy)
+{
+    // Arrange
+    std::string baseConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n";
+
+    createConfigFile("external_set.conf", baseConfig + "external_change_policy=reapply\n");
+    createConfigFile("external_invalid.conf", baseConfig + "external_change_policy=fight\n");
+
+    // Act & Assert
+    Config reapply;
+    ASSERT_TRUE(reapply.loadFromFile(getTestFilePath("external_set.conf")));
+    EXPECT_EQ(ExternalChangePolicy::REAPPLY, reapply.getExternalChangePolicy());
+    EXPECT_EQ(ExternalChangePolicy::BACKOFF, Config().getExternalChangePolicy());
+
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("external_invalid.conf")));
+}
+
+TEST_F(TestConfig, test_load_from_file_parses_smt_off_utilization)
+{
+    // Arrange
+    std::string baseConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n";
+
+    createConfigFile("smt_set.conf", baseConfig + "smt_off_utilization=0.05\n");
+    createConfigFile("smt_range.conf", baseConfig + "smt_off_utilization=0.5\n");
+
+    // Act & Assert
+    Config smt;
+    ASSERT_TRUE(smt.loadFromFile(getTestFilePath("smt_set.conf")));
+    EXPECT_DOUBLE_EQ(0.05, smt.getSmtOffUtilization().value());
+    EXPECT_FALSE(Config().getSmtOffUtilization().has_value());
+
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("smt_range.conf")));
+}
+
+TEST_F(TestConfig, test_load_from_file_parses_turbo_settings)
+{
+    // Arrange
+    std::string baseConfig =
+        "monitoring_frequency=10\n"
+        "high_performance_threshold=0.7\n"
+        "power_save_threshold=0.3\n";
+
+    createConfigFile("turbo_default.conf", baseConfig + "turbo_budget=0.5\n");
+    createConfigFile("turbo_set.conf", baseConfig +
+                     "turbo_control=true\nturbo_burst_threshold=0.9\nturbo_budget=0.4\nturbo_thermal_limit=80\n");
+    createConfigFile("turbo_flag.conf", baseConfig + "turbo_control=yes\n");
+    createConfigFile("turbo_limit.conf", baseConfig + "turbo_thermal_limit=120\n");
+
+    // Act & Assert
+    Config defaults;
+    ASSERT_TRUE(defaults.loadFromFile(getTestFilePath("turbo_default.conf")));
+    EXPECT_FALSE(defaults.getTurboSettings().has_value());
+
+    Config turbo;
+    ASSERT_TRUE(turbo.loadFromFile(getTestFilePath("turbo_set.conf")));
+    ASSERT_TRUE(turbo.getTurboSettings().has_value());
+    EXPECT_DOUBLE_EQ(0.9, turbo.getTurboSettings()->burstThreshold);
+    EXPECT_DOUBLE_EQ(0.4, turbo.getTurboSettings()->budget);
+    EXPECT_DOUBLE_EQ(80.0, turbo.getTurboSettings()->thermalLimit);
+
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("turbo_flag.conf")));
+    EXPECT_FALSE(Config().loadFromFile(getTestFilePath("turbo_limit.conf")));
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "cpu_topology.h"
+
+class TestCpuTopology : public ::testing::Test {
+protected:
+    // Helper: 1 P-core with two threads (capacity 1024) and 2 E-cores (capacity 512)
+    static CpuTopology makeHybrid() {
+        return CpuTopology({
+            {0, CoreType::PERFORMANCE, 1024, 0, 0, 0, {0, 1}},
+            {1, CoreType::PERFORMANCE, 1024, 0, 0, 0, {0, 1}},
+            {2, CoreType::EFFICIENCY, 512, 0, 8, 0, {2}},
+            {3, CoreType::EFFICIENCY, 512, 0, 9, 0, {3}},
+        });
+    }
+};
+
+// Test capacity normalisation
+TEST_F(TestCpuTopology, test_capacities_are_normalised_to_fastest_cpu) {
+    CpuTopology topology = makeHybrid();
+
+    EXPECT_TRUE(topology.isHybrid());
+    EXPECT_DOUBLE_EQ(3.0, topology.getCapacity());
+    EXPECT_DOUBLE_EQ(1.0, topology.getCapacity({2, 3}));
+    EXPECT_EQ(2, topology.countCpus(CoreType::EFFICIENCY));
+    EXPECT_EQ(3, topology.getPhysicalCoreCount());
+    EXPECT_EQ(1, topology.getPackageCount());
+    EXPECT_EQ("1P+2E cores, 4 CPUs, 1 package(s), capacity 3.00", topology.describe());
+}
+
+TEST_F(TestCpuTopology, test_homogeneous_topology_counts_every_cpu_once) {
+    CpuTopology topology({{0, CoreType::UNKNOWN, 1.0, 0, 0, -1, {}}, {1, CoreType::UNKNOWN, 1.0, 1, 0, -1, {}}});
+
+    EXPECT_FALSE(topology.isHybrid());
+    EXPECT_DOUBLE_EQ(2.0, topology.getCapacity());
+    EXPECT_EQ(2, topology.getPackageCount());
+    EXPECT_EQ("2 cores, 2 CPUs, 2 package(s), capacity 2.00", topology.describe());
+}
+
+// Test weighted utilization
+TEST_F(TestCpuTopology, test_weighted_utilization_favours_fast_cpus) {
+    CpuTopology topology = makeHybrid();
+    std::vector<double> utilization = {1.0, 1.0, 0.0, 0.0};
+
+    // Busy P-core threads hold 2 of 3 capacity units, although only half the CPUs are busy
+    EXPECT_NEAR(2.0 / 3.0, topology.weightedUtilization(utilization, {0, 1, 2, 3}), 1e-9);
+    EXPECT_DOUBLE_EQ(0.0, topology.weightedUtilization(utilization, {2, 3}));
+    // Unknown CPUs weigh as much as the fastest one
+    EXPECT_DOUBLE_EQ(0.5, CpuTopology().weightedUtilization(utilization, {0, 2}));
+}
+
+TEST_F(TestCpuTopology, test_weighted_utilization_skips_offline_cpus) {
+    CpuTopology topology = makeHybrid();
+    // CPU 5 is in the domain but offline, so it is missing from the topology
+    std::vector<double> utilization = {0.0, 0.0, 0.6, 0.6, 0.0, 0.0};
+
+    EXPECT_DOUBLE_EQ(0.6, topology.weightedUtilization(utilization, {2, 3, 5}));
+}
+
+// Test efficiency CPU selection
+TEST_F(TestCpuTopology, test_efficiency_cpus_prefer_core_type_then_capacity) {
+    EXPECT_EQ((std::vector<int>{2, 3}), makeHybrid().getEfficiencyCpus());
+
+    // big.mid.LITTLE without core types: only the slowest class
+    CpuTopology capacityOnly({
+        {0, CoreType::UNKNOWN, 160, 0, 0, -1, {}},
+        {1, CoreType::UNKNOWN, 160, 0, 1, -1, {}},
+        {2, CoreType::UNKNOWN, 600, 0, 2, -1, {}},
+        {3, CoreType::UNKNOWN, 1024, 0, 3, -1, {}},
+    });
+    EXPECT_EQ((std::vector<int>{0, 1}), capacityOnly.getEfficiencyCpus());
+
+    EXPECT_TRUE(CpuTopology({{0, CoreType::UNKNOWN, 1.0, 0, 0, -1, {}}}).getEfficiencyCpus().empty());
+}
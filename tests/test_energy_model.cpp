@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include "energy_model.h"
+
+class TestEnergyModel : public ::testing::Test {
+protected:
+    // Helper: 1.5 GHz costs more per unit of work than 2.0 GHz
+    static EnergyModel makeModel() {
+        return EnergyModel({
+            {3000000, 600.0, 0.0},
+            {1000000, 100.0, 0.0},
+            {1500000, 250.0, 0.0},
+            {2000000, 300.0, 0.0},
+        });
+    }
+};
+
+// Test construction
+TEST_F(TestEnergyModel, test_points_are_sorted_and_costs_derived) {
+    EnergyModel model = makeModel();
+
+    ASSERT_EQ(4u, model.getOperatingPoints().size());
+    EXPECT_EQ(1000000, model.getOperatingPoints().front().frequencyKhz);
+    EXPECT_EQ(3000000, model.getMaxFrequency());
+    EXPECT_DOUBLE_EQ(300.0 / 2000000.0, model.getOperatingPoints()[2].cost);
+    EXPECT_TRUE(EnergyModel({{0, 100.0, 0.0}}).empty());
+}
+
+// Test selection
+TEST_F(TestEnergyModel, test_select_returns_slowest_point_meeting_demand) {
+    EnergyModel model = makeModel();
+
+    EXPECT_EQ(1000000, model.select(0.0).frequencyKhz);
+    EXPECT_EQ(1000000, model.select(0.2).frequencyKhz);
+    EXPECT_EQ(2000000, model.select(0.6).frequencyKhz);
+    EXPECT_EQ(3000000, model.select(0.9).frequencyKhz);
+    EXPECT_EQ(3000000, model.select(2.0).frequencyKhz);
+}
+
+TEST_F(TestEnergyModel, test_select_skips_inefficient_points) {
+    EnergyModel model = makeModel();
+
+    // 1.5 GHz would be enough, but 2.0 GHz does the work for less energy
+    EXPECT_EQ(2000000, model.select(0.4).frequencyKhz);
+    EXPECT_EQ(2000000, model.select(0.5).frequencyKhz);
+}
+
+// Test table parsing
+TEST_F(TestEnergyModel, test_parse_table_accepts_pairs_and_rejects_garbage) {
+    auto points = EnergyModel::parseTable("1200000:150,2400000:700.5");
+    ASSERT_TRUE(points.has_value());
+    ASSERT_EQ(2u, points->size());
+    EXPECT_EQ(2400000, (*points)[1].frequencyKhz);
+    EXPECT_DOUBLE_EQ(700.5, (*points)[1].power);
+
+    EXPECT_FALSE(EnergyModel::parseTable("").has_value());
+    EXPECT_FALSE(EnergyModel::parseTable("1200000").has_value());
+    EXPECT_FALSE(EnergyModel::parseTable("1200000:150,abc:10").has_value());
+    EXPECT_FALSE(EnergyModel::parseTable("1200000:-1").has_value());
+}
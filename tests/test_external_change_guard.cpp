@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "external_change_guard.h"
+#include "logger.h"
+#include "mocks/mock_power_manager.h"
+
+using namespace std::chrono_literals;
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class TestExternalChangeGuard : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Suppress logger output during tests
+        Logger::setLevel(LogLevel::ERROR);
+
+        ON_CALL(backend, getBackendName()).WillByDefault(Return("epp"));
+        ON_CALL(backend, setTier(_)).WillByDefault(Return(true));
+        ON_CALL(backend, setDomainTier(_, _)).WillByDefault(Return(true));
+    }
+
+    void TearDown() override {
+        // Restore logger level
+        Logger::setLevel(LogLevel::INFO);
+    }
+
+    // Helper: the next readback reports one changed EPP
+    void changeExternally() {
+        EXPECT_CALL(backend, detectExternalChanges())
+            .WillOnce(Return(std::vector<ExternalChange>{
+                {"/sys/devices/system/cpu/cpufreq/policy0/energy_performance_preference", "power", "performance",
+                 "power-profiles-"}}))
+            .WillRepeatedly(Return(std::vector<ExternalChange>{}));
+    }
+
+    NiceMock<MockPowerManager> backend;
+    std::chrono::steady_clock::time_point start{};
+};
+
+// Test backoff: tiers requested during the hold-off are applied when it ends
+TEST_F(TestExternalChangeGuard, test_backoff_defers_tiers_until_hold_off_ends) {
+    ExternalChangeGuard guard(backend, ExternalChangePolicy::BACKOFF);
+    EXPECT_CALL(backend, setTier(PowerTier::POWER_SAVE)).Times(1);
+    EXPECT_TRUE(guard.setTier(PowerTier::POWER_SAVE, start));
+
+    changeExternally();
+    guard.update(start + 10s);
+    EXPECT_TRUE(guard.isHolding(start + 10s));
+    EXPECT_EQ(1, guard.getConflicts());
+
+    // Remembered, not applied
+    EXPECT_CALL(backend, setTier(PowerTier::PERFORMANCE)).Times(0);
+    EXPECT_TRUE(guard.setTier(PowerTier::PERFORMANCE, start + 60s));
+    guard.update(start + 4min);
+    ::testing::Mock::VerifyAndClearExpectations(&backend);
+
+    EXPECT_CALL(backend, setTier(PowerTier::PERFORMANCE)).WillOnce(Return(true));
+    guard.update(start + 10s + 5min);
+    EXPECT_FALSE(guard.isHolding(start + 10s + 5min));
+}
+
+// Test backoff growth: a conflict right after resuming doubles the hold-off
+TEST_F(TestExternalChangeGuard, test_repeated_conflicts_double_the_hold_off) {
+    ExternalChangeGuard guard(backend, ExternalChangePolicy::BACKOFF);
+    guard.setTier(PowerTier::POWER_SAVE, start);
+
+    changeExternally();
+    guard.update(start);
+    guard.update(start + 5min);
+    EXPECT_FALSE(guard.isHolding(start + 5min));
+
+    changeExternally();
+    guard.update(start + 5min + 10s);
+    EXPECT_TRUE(guard.isHolding(start + 5min + 10s + 9min));
+    EXPECT_FALSE(guard.isHolding(start + 5min + 10s + 10min));
+    EXPECT_EQ(2, guard.getConflicts());
+}
+
+// Test reapply: our tier is written again at once, then not before the hold-off ends
+TEST_F(TestExternalChangeGuard, test_reapply_reasserts_the_current_tiers) {
+    ExternalChangeGuard guard(backend, ExternalChangePolicy::REAPPLY);
+    ControlDomain domain{"policy0", {0, 1}, ControlDomainScope::CPUFREQ_POLICY, -1};
+    guard.setTier(PowerTier::POWER_SAVE, start);
+    guard.setDomainTier(domain, PowerTier::BALANCED_POWER, start);
+
+    changeExternally();
+    EXPECT_CALL(backend, setTier(PowerTier::POWER_SAVE)).Times(1);
+    EXPECT_CALL(backend, setDomainTier(_, PowerTier::BALANCED_POWER)).Times(1);
+    guard.update(start + 10s);
+    EXPECT_TRUE(guard.isHolding(start + 10s + 59s));
+    EXPECT_FALSE(guard.isHolding(start + 10s + 60s));
+}
+
+// Test adopt: changes are reported without writing anything or holding off
+TEST_F(TestExternalChangeGuard, test_adopt_keeps_the_external_values) {
+    ExternalChangeGuard guard(backend, ExternalChangePolicy::ADOPT);
+    guard.setTier(PowerTier::POWER_SAVE, start);
+
+    changeExternally();
+    EXPECT_CALL(backend, setTier(_)).Times(0);
+    guard.update(start + 10s);
+    EXPECT_FALSE(guard.isHolding(start + 10s));
+    EXPECT_EQ(1, guard.getConflicts());
+}
+
+// Test the check interval and the off policy
+TEST_F(TestExternalChangeGuard, test_readback_is_rate_limited_and_can_be_turned_off) {
+    ExternalChangeGuard guard(backend, ExternalChangePolicy::BACKOFF, 5s);
+    EXPECT_CALL(backend, detectExternalChanges()).Times(2).WillRepeatedly(Return(std::vector<ExternalChange>{}));
+    guard.update(start);
+    guard.update(start + 2s);
+    guard.update(start + 5s);
+    ::testing::Mock::VerifyAndClearExpectations(&backend);
+
+    ExternalChangeGuard off(backend, ExternalChangePolicy::OFF);
+    EXPECT_CALL(backend, detectExternalChanges()).Times(0);
+    off.update(start);
+}
+
+// Test resume: changes made while suspended are not conflicts
+TEST_F(TestExternalChangeGuard, test_resync_after_resume_does_not_count_conflicts) {
+    ExternalChangeGuard guard(backend, ExternalChangePolicy::BACKOFF);
+    guard.setTier(PowerTier::POWER_SAVE, start);
+
+    changeExternally();
+    EXPECT_CALL(backend, getCurrentMode()).WillOnce(Return("performance"));
+    guard.resync();
+
+    EXPECT_EQ(0, guard.getConflicts());
+    EXPECT_FALSE(guard.isHolding(start + 10s));
+    EXPECT_CALL(backend, setTier(PowerTier::POWER_SAVE)).WillOnce(Return(true));
+    EXPECT_TRUE(guard.setTier(PowerTier::POWER_SAVE, start + 10s));
+}
+
+// Test warm start: only the first request is checked, and only for the stored tier
+TEST_F(TestExternalChangeGuard, test_warm_start_skips_a_confirmed_first_switch) {
+    ExternalChangeGuard guard(backend, ExternalChangePolicy::BACKOFF);
+    guard.setWarmStartTier(PowerTier::POWER_SAVE);
+    EXPECT_CALL(backend, confirmTier(PowerTier::POWER_SAVE)).WillOnce(Return(true));
+    EXPECT_CALL(backend, setTier(_)).Times(0);
+    EXPECT_TRUE(guard.setTier(PowerTier::POWER_SAVE, start));
+    EXPECT_EQ(PowerTier::POWER_SAVE, guard.getTier());
+    ::testing::Mock::VerifyAndClearExpectations(&backend);
+
+    EXPECT_CALL(backend, confirmTier(_)).Times(0);
+    EXPECT_CALL(backend, setTier(PowerTier::POWER_SAVE)).WillOnce(Return(true));
+    EXPECT_TRUE(guard.setTier(PowerTier::POWER_SAVE, start + 60s));
+    ::testing::Mock::VerifyAndClearExpectations(&backend);
+
+    // Another first tier, or a readback that does not match, switches as usual
+    ExternalChangeGuard other(backend, ExternalChangePolicy::BACKOFF);
+    other.setWarmStartTier(PowerTier::POWER_SAVE);
+    EXPECT_CALL(backend, confirmTier(_)).Times(0);
+    EXPECT_CALL(backend, setTier(PowerTier::PERFORMANCE)).WillOnce(Return(true));
+    EXPECT_TRUE(other.setTier(PowerTier::PERFORMANCE, start));
+    ::testing::Mock::VerifyAndClearExpectations(&backend);
+
+    ExternalChangeGuard changed(backend, ExternalChangePolicy::BACKOFF);
+    changed.setWarmStartTier(PowerTier::POWER_SAVE);
+    EXPECT_CALL(backend, confirmTier(PowerTier::POWER_SAVE)).WillOnce(Return(false));
+    EXPECT_CALL(backend, setTier(PowerTier::POWER_SAVE)).WillOnce(Return(true));
+    EXPECT_TRUE(changed.setTier(PowerTier::POWER_SAVE, start));
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include "platform/linux/linux_power_backends.h"
+#include "mocks/fake_sysfs_fixture.h"
+
+namespace fs = std::filesystem;
+
+class TestLinuxCpuParkingController : public FakeSysfsTest {
+protected:
+    TestLinuxCpuParkingController() : FakeSysfsTest("parking_cpu") {}
+
+    void SetUp() override {
+        FakeSysfsTest::SetUp();
+
+        // Fake /sys/devices/system/cpu: cpu0 without hotplug, cpu3 already offline
+        fs::create_directories(root / "cpu0");
+        writeFile(online(1), "1");
+        writeFile(online(2), "1");
+        writeFile(online(3), "0");
+    }
+
+    fs::path online(int cpu) const {
+        return root / ("cpu" + std::to_string(cpu)) / "online";
+    }
+};
+
+// Test CPU selection
+TEST_F(TestLinuxCpuParkingController, test_initialize_skips_boot_and_offline_cpus) {
+    auto controller = createLinuxCpuParkingController(root.string());
+
+    EXPECT_FALSE(controller->initialize({0, 3}));
+    EXPECT_TRUE(controller->initialize({0, 1, 2, 3}));
+
+    controller->setTier(PowerTier::POWER_SAVE);
+    EXPECT_EQ("0", readFile(online(1)));
+    EXPECT_EQ("0", readFile(online(2)));
+    EXPECT_EQ("0", readFile(online(3)));
+
+    // CPU 3 was offline before parking, so restore leaves it offline
+    EXPECT_TRUE(controller->restore());
+    EXPECT_EQ("1", readFile(online(1)));
+    EXPECT_EQ("1", readFile(online(2)));
+    EXPECT_EQ("0", readFile(online(3)));
+}
+
+// Test parking and unparking
+TEST_F(TestLinuxCpuParkingController, test_cpus_return_when_leaving_power_save_or_boosting) {
+    auto controller = createLinuxCpuParkingController(root.string());
+    ASSERT_TRUE(controller->initialize({2}));
+
+    controller->setTier(PowerTier::POWER_SAVE);
+    EXPECT_EQ("0", readFile(online(2)));
+    controller->setTier(PowerTier::BALANCED_POWER);
+    EXPECT_EQ("1", readFile(online(2)));
+
+    controller->setTier(PowerTier::POWER_SAVE);
+    ASSERT_EQ("0", readFile(online(2)));
+    controller->unpark();
+    EXPECT_EQ("1", readFile(online(2)));
+    EXPECT_EQ("1", readFile(online(1)));
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include "platform/linux/linux_power_backends.h"
+#include "mocks/fake_sysfs_fixture.h"
+
+namespace fs = std::filesystem;
+
+class TestLinuxCpusetController : public FakeSysfsTest {
+protected:
+    TestLinuxCpusetController() : FakeSysfsTest("cpuset") {}
+
+    void SetUp() override {
+        FakeSysfsTest::SetUp();
+
+        // Fake /sys/fs/cgroup with two slices
+        writeFile(cpus("system.slice"), "");
+        writeFile(cpus("background.slice"), "0-5");
+    }
+
+    fs::path cpus(const std::string& cgroup) const { return root / cgroup / "cpuset.cpus"; }
+};
+
+// Test confinement and restore
+TEST_F(TestLinuxCpusetController, test_power_save_confines_cgroups_to_efficiency_cpus) {
+    auto controller = createLinuxCpusetController(root.string());
+    ASSERT_TRUE(controller->initialize({"system.slice", "background.slice"}, {4, 5}));
+
+    controller->setTier(PowerTier::BALANCED_POWER);
+    EXPECT_EQ("", readFile(cpus("system.slice")));
+
+    controller->setTier(PowerTier::POWER_SAVE);
+    EXPECT_EQ("4,5", readFile(cpus("system.slice")));
+    EXPECT_EQ("4,5", readFile(cpus("background.slice")));
+
+    // An inherited (empty) CPU set is cleared again, not left at the confinement list
+    controller->setTier(PowerTier::PERFORMANCE);
+    EXPECT_EQ("", readFile(cpus("system.slice")));
+    EXPECT_EQ("0-5", readFile(cpus("background.slice")));
+
+    controller->setTier(PowerTier::POWER_SAVE);
+    EXPECT_TRUE(controller->restore());
+    EXPECT_EQ("0-5", readFile(cpus("background.slice")));
+}
+
+TEST_F(TestLinuxCpusetController, test_failed_cgroup_keeps_its_cpuset) {
+    // cpuset.cpus that cannot be written
+    fs::create_directories(cpus("user.slice"));
+
+    auto controller = createLinuxCpusetController(root.string());
+    ASSERT_TRUE(controller->initialize({"user.slice", "background.slice", "missing.slice"}, {4}));
+    controller->setTier(PowerTier::POWER_SAVE);
+
+    EXPECT_TRUE(fs::is_directory(cpus("user.slice")));
+    EXPECT_EQ("4", readFile(cpus("background.slice")));
+    EXPECT_TRUE(controller->restore());
+    EXPECT_EQ("0-5", readFile(cpus("background.slice")));
+}
+
+TEST_F(TestLinuxCpusetController, test_initialize_requires_cpuset_controller) {
+    EXPECT_FALSE(createLinuxCpusetController(root.string())->initialize({"missing.slice"}, {4}));
+    EXPECT_FALSE(createLinuxCpusetController(root.string())->initialize({"system.slice"}, {}));
+}
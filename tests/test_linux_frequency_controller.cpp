@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include "platform/linux/linux_power_backends.h"
+#include "mocks/fake_sysfs_fixture.h"
+
+namespace fs = std::filesystem;
+
+class TestLinuxFrequencyController : public FakeSysfsTest {
+protected:
+    TestLinuxFrequencyController() : FakeSysfsTest("freq_cpu") {}
+
+    fs::path policy(int index) const {
+        return root / "cpufreq" / ("policy" + std::to_string(index));
+    }
+
+    // Helper: acpi-cpufreq policy 0 with listed steps, intel_pstate policy 1 with a range
+    void createPolicies() {
+        writeFile(policy(0) / "related_cpus", "0 1");
+        writeFile(policy(0) / "scaling_available_frequencies", "3000000 2400000 1800000 1200000");
+        writeFile(policy(0) / "scaling_max_freq", "3000000");
+        writeFile(policy(1) / "related_cpus", "2 3");
+        writeFile(policy(1) / "cpuinfo_min_freq", "800000");
+        writeFile(policy(1) / "cpuinfo_max_freq", "4000000");
+        writeFile(policy(1) / "scaling_max_freq", "4000000");
+    }
+};
+
+// Test policy discovery
+TEST_F(TestLinuxFrequencyController, test_initialize_finds_listed_and_ranged_policies) {
+    createPolicies();
+    writeFile(policy(2) / "related_cpus", "4");
+    writeFile(policy(2) / "scaling_max_freq", "2000000");  // no frequency information
+
+    auto controller = createLinuxFrequencyController(root.string(), (root / "energy_model").string());
+
+    ASSERT_TRUE(controller->initialize(0.75, {}));
+    EXPECT_EQ(2u, controller->getDomainCount());
+}
+
+TEST_F(TestLinuxFrequencyController, test_initialize_fails_without_cpufreq) {
+    auto controller = createLinuxFrequencyController(root.string(), (root / "energy_model").string());
+
+    EXPECT_FALSE(controller->initialize(0.75, {}));
+}
+
+// Test control steps
+TEST_F(TestLinuxFrequencyController, test_idle_policy_is_capped_and_busy_policy_left_alone) {
+    createPolicies();
+    auto controller = createLinuxFrequencyController(root.string(), (root / "energy_model").string());
+    ASSERT_TRUE(controller->initialize(0.75, {}));
+
+    // Policy 0 idles, policy 1 sits at the target
+    controller->update({0.05, 0.05, 0.75, 0.75});
+
+    // The cap drops one slew step (to 75%) and rounds up to an available frequency
+    EXPECT_EQ("2400000", readFile(policy(0) / "scaling_max_freq"));
+    EXPECT_EQ("4000000", readFile(policy(1) / "scaling_max_freq"));
+}
+
+TEST_F(TestLinuxFrequencyController, test_performance_tier_lifts_caps_and_restore_writes_original) {
+    createPolicies();
+    auto controller = createLinuxFrequencyController(root.string(), (root / "energy_model").string());
+    ASSERT_TRUE(controller->initialize(0.75, {}));
+    controller->update({0.0, 0.0, 0.0, 0.0});
+    ASSERT_NE("4000000", readFile(policy(1) / "scaling_max_freq"));
+
+    controller->setTier(PowerTier::PERFORMANCE);
+    EXPECT_EQ("3000000", readFile(policy(0) / "scaling_max_freq"));
+    EXPECT_EQ("4000000", readFile(policy(1) / "scaling_max_freq"));
+
+    // Updates are ignored while the caps are lifted
+    controller->update({0.0, 0.0, 0.0, 0.0});
+    EXPECT_EQ("4000000", readFile(policy(1) / "scaling_max_freq"));
+
+    controller->setTier(PowerTier::POWER_SAVE);
+    controller->update({0.0, 0.0, 0.0, 0.0});
+    EXPECT_EQ("3000000", readFile(policy(1) / "scaling_max_freq"));
+
+    EXPECT_TRUE(controller->restore());
+    EXPECT_EQ("3000000", readFile(policy(0) / "scaling_max_freq"));
+    EXPECT_EQ("4000000", readFile(policy(1) / "scaling_max_freq"));
+}
+
+// Test energy model selection
+TEST_F(TestLinuxFrequencyController, test_energy_model_selects_cheapest_sufficient_point) {
+    createPolicies();
+    // debugfs model for policy 0, 1.8 GHz costs more than 2.4 GHz
+    fs::path domain = root / "energy_model" / "cpu0";
+    writeFile(domain / "cpus", "0-1");
+    const std::pair<int, int> states[] = {{1200000, 100}, {1800000, 160}, {2400000, 150}, {3000000, 200}};
+    for (const auto& [frequency, cost] : states) {
+        fs::path state = domain / ("ps:" + std::to_string(frequency));
+        writeFile(state / "frequency", std::to_string(frequency));
+        writeFile(state / "power", std::to_string(cost * frequency / 1000000));
+        writeFile(state / "cost", std::to_string(cost));
+    }
+    // Device performance domains are ignored
+    writeFile(root / "energy_model" / "gpu" / "ps:500000" / "frequency", "500000");
+
+    auto controller = createLinuxFrequencyController(root.string(), (root / "energy_model").string());
+    // The configured table covers policy 1
+    ASSERT_TRUE(controller->initialize(0.75, {{3, {{2000000, 200.0, 0.0}, {4000000, 800.0, 0.0}}}}));
+
+    // 30% busy at 3.0 GHz with a third of headroom needs 1.2 GHz
+    controller->update({0.3, 0.3, 0.1, 0.1});
+    EXPECT_EQ("1200000", readFile(policy(0) / "scaling_max_freq"));
+    EXPECT_EQ("2000000", readFile(policy(1) / "scaling_max_freq"));
+
+    // 90% busy at 1.2 GHz needs 1.44 GHz, and 2.4 GHz is cheaper than 1.8 GHz
+    controller->update({0.9, 0.9, 0.1, 0.1});
+    EXPECT_EQ("2400000", readFile(policy(0) / "scaling_max_freq"));
+
+    // Energy model domains keep their computed caps in the performance tier
+    controller->setTier(PowerTier::PERFORMANCE);
+    EXPECT_EQ("2400000", readFile(policy(0) / "scaling_max_freq"));
+    EXPECT_EQ("2000000", readFile(policy(1) / "scaling_max_freq"));
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <string>
+#include "platform/linux/linux_power_backends.h"
+#include "mocks/fake_sysfs_fixture.h"
+
+namespace fs = std::filesystem;
+
+class TestLinuxIdleInjectionController : public FakeSysfsTest {
+protected:
+    TestLinuxIdleInjectionController() : FakeSysfsTest("idle_injection") {}
+
+    void SetUp() override {
+        FakeSysfsTest::SetUp();
+
+        // Fake RAPL package, CPU thermal zone, schedstat and cgroup
+        writeFile(root / "sys/class/powercap/intel-rapl:0/energy_uj", "0");
+        writeFile(root / "sys/class/powercap/intel-rapl:0:0/energy_uj", "0");
+        writeFile(root / "sys/class/thermal/thermal_zone0/type", "x86_pkg_temp");
+        writeFile(root / "sys/class/thermal/thermal_zone0/temp", "60000");
+        writeFile(root / "sys/devices/system/cpu/online", "0-3");
+        writeFile(cpuMax(), "max 100000");
+        writeSchedstat(0);
+    }
+
+    // Helper: two CPUs, each with runDelayNs of run-queue wait
+    void writeSchedstat(long runDelayNs) {
+        std::string counters = " 0 0 0 0 0 0 0 " + std::to_string(runDelayNs) + " 0\n";
+        writeFile(root / "proc/schedstat", "version 15\ntimestamp 1\ncpu0" + counters + "domain0 3 0\ncpu1" + counters);
+    }
+
+    void addPowerclamp() {
+        writeFile(powerclamp() / "type", "intel_powerclamp");
+        writeFile(powerclamp() / "max_state", "50");
+        writeFile(powerclamp() / "cur_state", "0");
+    }
+
+    fs::path powerclamp() const { return root / "sys/class/thermal/cooling_device3"; }
+    fs::path cpuMax() const { return root / "sys/fs/cgroup/background.slice/cpu.max"; }
+};
+
+// Test powerclamp injection against a power budget
+TEST_F(TestLinuxIdleInjectionController, test_power_overshoot_raises_powerclamp_state) {
+    addPowerclamp();
+    auto controller = createLinuxIdleInjectionController(root.string());
+    ASSERT_TRUE(controller->initialize(10.0, std::nullopt, {}));
+    auto start = std::chrono::steady_clock::now();
+
+    controller->update(start);
+    // 20 W against a 10 W budget
+    writeFile(root / "sys/class/powercap/intel-rapl:0/energy_uj", "20000000");
+    controller->update(start + std::chrono::seconds(1));
+    int state = std::stoi(readFile(powerclamp() / "cur_state"));
+    EXPECT_GT(state, 0);
+    EXPECT_LE(state, 50);
+    EXPECT_DOUBLE_EQ(state / 100.0, controller->getMetrics().injection);
+
+    // Well under budget the injection winds down
+    for (int second = 2; second < 20; ++second) {
+        writeFile(root / "sys/class/powercap/intel-rapl:0/energy_uj", std::to_string(20000000 + (second - 1) * 2000000));
+        controller->update(start + std::chrono::seconds(second));
+    }
+    EXPECT_EQ("0", readFile(powerclamp() / "cur_state"));
+}
+
+// Test the cgroup fallback against a thermal budget
+TEST_F(TestLinuxIdleInjectionController, test_thermal_overshoot_throttles_cgroups_without_powerclamp) {
+    auto controller = createLinuxIdleInjectionController(root.string());
+    ASSERT_TRUE(controller->initialize(std::nullopt, 70.0, {"background.slice"}));
+    auto start = std::chrono::steady_clock::now();
+
+    controller->update(start);
+    writeFile(root / "sys/class/thermal/thermal_zone0/temp", "80000");
+    writeSchedstat(500000000);
+    controller->update(start + std::chrono::seconds(1));
+
+    // 10% injection leaves 90% of four CPUs
+    double injection = controller->getMetrics().injection;
+    ASSERT_GT(injection, 0.0);
+    EXPECT_EQ(std::to_string(std::lround((1.0 - injection) * 400000)) + " 100000", readFile(cpuMax()));
+
+    writeSchedstat(900000000);
+    controller->update(start + std::chrono::seconds(2));
+    EXPECT_TRUE(controller->restore());
+    EXPECT_EQ("max 100000", readFile(cpuMax()));
+
+    // 0.5 s of wait on each CPU in the first second, 0.4 s in the second
+    IdleInjectionMetrics metrics = controller->getMetrics();
+    EXPECT_DOUBLE_EQ(500.0, metrics.runDelayFree);
+    EXPECT_DOUBLE_EQ(400.0, metrics.runDelayInjecting);
+    EXPECT_GT(metrics.averageInjection, 0.0);
+}
+
+TEST_F(TestLinuxIdleInjectionController, test_initialize_requires_actuator_and_sensor) {
+    // No powerclamp and no throttleable cgroup
+    EXPECT_FALSE(createLinuxIdleInjectionController(root.string())->initialize(10.0, std::nullopt, {"missing.slice"}));
+
+    // Power budget without RAPL
+    addPowerclamp();
+    fs::remove_all(root / "sys/class/powercap");
+    EXPECT_FALSE(createLinuxIdleInjectionController(root.string())->initialize(10.0, std::nullopt, {}));
+    EXPECT_TRUE(createLinuxIdleInjectionController(root.string())->initialize(std::nullopt, 90.0, {}));
+}
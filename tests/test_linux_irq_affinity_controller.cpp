@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include "platform/linux/linux_power_backends.h"
+#include "mocks/fake_sysfs_fixture.h"
+
+namespace fs = std::filesystem;
+
+class TestLinuxIrqAffinityController : public FakeSysfsTest {
+protected:
+    TestLinuxIrqAffinityController() : FakeSysfsTest("irq") {}
+
+    void SetUp() override {
+        FakeSysfsTest::SetUp();
+
+        // Fake /proc/irq, /proc/interrupts and online CPU list
+        writeFile(root / "sys/devices/system/cpu/online", "0-3");
+        writeFile(affinity(0), "0-3");
+        writeFile(affinity(24), "0-3");
+        writeFile(affinity(25), "2");
+        writeInterrupts(0, 0);
+    }
+
+    // Helper: /proc/interrupts with IRQ 24 and 25 counts on CPU 1 and 2
+    void writeInterrupts(int irq24, int irq25) {
+        writeFile(root / "proc/interrupts",
+                  "           CPU0       CPU1       CPU2       CPU3\n"
+                  "  0:         40          0          0          0   IO-APIC   2-edge      timer\n"
+                  " 24:          0 " + std::to_string(irq24) + " 0 0   PCI-MSI 524288-edge      eth0\n"
+                  " 25:          0 0 " + std::to_string(irq25) + " 0   PCI-MSI 327680-edge      xhci_hcd\n"
+                  "LOC:     100000     100000     100000     100000   Local timer interrupts\n"
+                  "ERR:          0\n");
+    }
+
+    fs::path affinity(int irq) const {
+        return root / "proc/irq" / std::to_string(irq) / "smp_affinity_list";
+    }
+};
+
+// Test consolidation and restore
+TEST_F(TestLinuxIrqAffinityController, test_power_save_moves_interrupts_to_housekeeping_cpus) {
+    auto controller = createLinuxIrqAffinityController(root.string());
+    ASSERT_TRUE(controller->initialize({0, 1}, 1000));
+
+    controller->setTier(PowerTier::BALANCED_POWER);
+    EXPECT_EQ("0-3", readFile(affinity(24)));
+
+    controller->setTier(PowerTier::POWER_SAVE);
+    EXPECT_EQ("0,1", readFile(affinity(24)));
+    EXPECT_EQ("0,1", readFile(affinity(25)));
+    // IRQ 0 is never touched
+    EXPECT_EQ("0-3", readFile(affinity(0)));
+
+    controller->setTier(PowerTier::BALANCED_PERFORMANCE);
+    EXPECT_EQ("0-3", readFile(affinity(24)));
+    EXPECT_EQ("2", readFile(affinity(25)));
+
+    controller->setTier(PowerTier::POWER_SAVE);
+    EXPECT_TRUE(controller->restore());
+    EXPECT_EQ("2", readFile(affinity(25)));
+}
+
+// Test the interrupt rate signal
+TEST_F(TestLinuxIrqAffinityController, test_busy_interrupt_blocks_consolidation) {
+    auto controller = createLinuxIrqAffinityController(root.string());
+    ASSERT_TRUE(controller->initialize({0}, 1000));
+    auto start = std::chrono::steady_clock::now();
+
+    controller->update(start);
+    EXPECT_TRUE(controller->getInterruptRates().empty());
+
+    // 5000 network interrupts per second on CPU 1
+    writeInterrupts(10000, 10);
+    controller->update(start + std::chrono::seconds(2));
+    auto rates = controller->getInterruptRates();
+    ASSERT_EQ(4u, rates.size());
+    EXPECT_DOUBLE_EQ(0.0, rates[0]);
+    EXPECT_DOUBLE_EQ(5000.0, rates[1]);
+    EXPECT_DOUBLE_EQ(5.0, rates[2]);
+
+    controller->setTier(PowerTier::POWER_SAVE);
+    EXPECT_EQ("0-3", readFile(affinity(24)));
+
+    // The source calms down; the third quiet interval in a row consolidates
+    writeInterrupts(10100, 20);
+    controller->update(start + std::chrono::seconds(4));
+    controller->update(start + std::chrono::seconds(6));
+    EXPECT_EQ("0-3", readFile(affinity(24)));
+    controller->update(start + std::chrono::seconds(8));
+    EXPECT_EQ("0", readFile(affinity(24)));
+
+    // And spreads again once it gets busy
+    writeInterrupts(30100, 20);
+    controller->update(start + std::chrono::seconds(10));
+    EXPECT_EQ("0-3", readFile(affinity(24)));
+    EXPECT_EQ("2", readFile(affinity(25)));
+
+    // A busy interval within the quiet streak starts it over
+    controller->update(start + std::chrono::seconds(12));
+    controller->update(start + std::chrono::seconds(14));
+    writeInterrupts(50100, 20);
+    controller->update(start + std::chrono::seconds(16));
+    controller->update(start + std::chrono::seconds(18));
+    controller->update(start + std::chrono::seconds(20));
+    EXPECT_EQ("0-3", readFile(affinity(24)));
+    controller->update(start + std::chrono::seconds(22));
+    EXPECT_EQ("0", readFile(affinity(24)));
+}
+
+TEST_F(TestLinuxIrqAffinityController, test_initialize_requires_online_housekeeping_cpu) {
+    EXPECT_FALSE(createLinuxIrqAffinityController(root.string())->initialize({6, 7}, 1000));
+    EXPECT_FALSE(createLinuxIrqAffinityController((root / "missing").string())->initialize({0}, 1000));
+}
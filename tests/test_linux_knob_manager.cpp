@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include "platform/linux/linux_power_backends.h"
+#include "mocks/fake_sysfs_fixture.h"
+
+namespace fs = std::filesystem;
+
+class TestLinuxKnobManager : public FakeSysfsTest {
+protected:
+    TestLinuxKnobManager() : FakeSysfsTest("knob_root") {}
+
+    // Helper: schedutil rate limits for two policies and a sysctl
+    void createTunables() {
+        for (int i = 0; i < 2; ++i) {
+            writeFile(policy(i) / "schedutil" / "rate_limit_us", "1000");
+        }
+        writeFile(root / "proc" / "sys" / "vm" / "dirty_writeback_centisecs", "500");
+    }
+
+    fs::path policy(int index) const {
+        return root / "sys" / "devices" / "system" / "cpu" / "cpufreq" / ("policy" + std::to_string(index));
+    }
+};
+
+// Test target resolution
+TEST_F(TestLinuxKnobManager, test_load_expands_globs_and_sysctl_names) {
+    createTunables();
+    KnobProfiles profiles;
+    profiles[static_cast<size_t>(PowerTier::POWER_SAVE)] = {
+        {"/sys/devices/system/cpu/cpufreq/policy*/schedutil/rate_limit_us", "10000"},
+        {"vm.dirty_writeback_centisecs", "1500"},
+        {"/sys/module/missing/parameters/value", "1"},
+    };
+
+    auto knobManager = createLinuxKnobManager(root.string());
+
+    ASSERT_TRUE(knobManager->load(profiles));
+    EXPECT_EQ(3u, knobManager->getKnobCount());
+}
+
+TEST_F(TestLinuxKnobManager, test_load_keeps_dots_in_slash_separated_sysctl_names) {
+    fs::path rpFilter = root / "proc" / "sys" / "net" / "ipv4" / "conf" / "eth0.100" / "rp_filter";
+    writeFile(rpFilter, "1");
+    KnobProfiles profiles;
+    profiles[static_cast<size_t>(PowerTier::POWER_SAVE)] = {{"net/ipv4/conf/eth0.100/rp_filter", "2"}};
+
+    auto knobManager = createLinuxKnobManager(root.string());
+    ASSERT_TRUE(knobManager->load(profiles));
+    EXPECT_TRUE(knobManager->applyTier(PowerTier::POWER_SAVE));
+    EXPECT_EQ("2", readFile(rpFilter));
+
+    // The dotted form splits eth0.100 and names no sysctl, which is an error rather than a no-op
+    KnobProfiles dotted;
+    dotted[static_cast<size_t>(PowerTier::POWER_SAVE)] = {{"net.ipv4.conf.eth0.100.rp_filter", "2"}};
+    EXPECT_FALSE(createLinuxKnobManager(root.string())->load(dotted));
+}
+
+TEST_F(TestLinuxKnobManager, test_load_rejects_targets_outside_sys_and_proc_sys) {
+    writeFile(root / "proc" / "1" / "oom_score_adj", "0");
+    writeFile(root / "etc" / "shadow", "secret");
+    fs::create_directories(root / "sys" / "class");
+    fs::create_symlink(root / "etc", root / "sys" / "class" / "escape");
+
+    KnobProfiles procProfiles;
+    procProfiles[0] = {{"/proc/1/oom_score_adj", "-1000"}};
+    KnobProfiles symlinkProfiles;
+    symlinkProfiles[0] = {{"/sys/class/escape/shadow", "owned"}};
+
+    EXPECT_FALSE(createLinuxKnobManager(root.string())->load(procProfiles));
+    EXPECT_FALSE(createLinuxKnobManager(root.string())->load(symlinkProfiles));
+    EXPECT_EQ("secret", readFile(root / "etc" / "shadow"));
+}
+
+// Test tier application
+TEST_F(TestLinuxKnobManager, test_apply_tier_writes_values_and_unlisted_knobs_revert) {
+    createTunables();
+    KnobProfiles profiles;
+    profiles[static_cast<size_t>(PowerTier::POWER_SAVE)] = {
+        {"/sys/devices/system/cpu/cpufreq/policy*/schedutil/rate_limit_us", "10000"},
+        {"vm.dirty_writeback_centisecs", "1500"},
+    };
+    profiles[static_cast<size_t>(PowerTier::PERFORMANCE)] = {
+        {"/sys/devices/system/cpu/cpufreq/policy*/schedutil/rate_limit_us", "500"},
+        // Later entries override earlier ones for the same attribute
+        {"/sys/devices/system/cpu/cpufreq/policy1/schedutil/rate_limit_us", "250"},
+    };
+
+    auto knobManager = createLinuxKnobManager(root.string());
+    ASSERT_TRUE(knobManager->load(profiles));
+
+    EXPECT_TRUE(knobManager->applyTier(PowerTier::POWER_SAVE));
+    EXPECT_EQ("10000", readFile(policy(0) / "schedutil" / "rate_limit_us"));
+    EXPECT_EQ("10000", readFile(policy(1) / "schedutil" / "rate_limit_us"));
+    EXPECT_EQ("1500", readFile(root / "proc" / "sys" / "vm" / "dirty_writeback_centisecs"));
+
+    EXPECT_TRUE(knobManager->applyTier(PowerTier::PERFORMANCE));
+    EXPECT_EQ("500", readFile(policy(0) / "schedutil" / "rate_limit_us"));
+    EXPECT_EQ("250", readFile(policy(1) / "schedutil" / "rate_limit_us"));
+    // PERFORMANCE does not list the sysctl, so it returns to its original value
+    EXPECT_EQ("500", readFile(root / "proc" / "sys" / "vm" / "dirty_writeback_centisecs"));
+}
+
+TEST_F(TestLinuxKnobManager, test_apply_tier_skips_unchanged_knobs) {
+    createTunables();
+    KnobProfiles profiles;
+    profiles[static_cast<size_t>(PowerTier::POWER_SAVE)] = {{"vm.dirty_writeback_centisecs", "1500"}};
+
+    auto knobManager = createLinuxKnobManager(root.string());
+    ASSERT_TRUE(knobManager->load(profiles));
+    ASSERT_TRUE(knobManager->applyTier(PowerTier::POWER_SAVE));
+
+    // The cached value matches, so the external change is not overwritten again
+    writeFile(root / "proc" / "sys" / "vm" / "dirty_writeback_centisecs", "3000");
+    EXPECT_TRUE(knobManager->applyTier(PowerTier::POWER_SAVE));
+    EXPECT_EQ("3000", readFile(root / "proc" / "sys" / "vm" / "dirty_writeback_centisecs"));
+}
+
+// Test snapshot restore
+TEST_F(TestLinuxKnobManager, test_restore_writes_back_snapshot) {
+    createTunables();
+    KnobProfiles profiles;
+    profiles[static_cast<size_t>(PowerTier::POWER_SAVE)] = {
+        {"/sys/devices/system/cpu/cpufreq/policy*/schedutil/rate_limit_us", "10000"},
+        {"vm.dirty_writeback_centisecs", "1500"},
+    };
+
+    auto knobManager = createLinuxKnobManager(root.string());
+    ASSERT_TRUE(knobManager->load(profiles));
+    ASSERT_TRUE(knobManager->applyTier(PowerTier::POWER_SAVE));
+
+    EXPECT_TRUE(knobManager->restore());
+    EXPECT_EQ("1000", readFile(policy(0) / "schedutil" / "rate_limit_us"));
+    EXPECT_EQ("1000", readFile(policy(1) / "schedutil" / "rate_limit_us"));
+    EXPECT_EQ("500", readFile(root / "proc" / "sys" / "vm" / "dirty_writeback_centisecs"));
+}
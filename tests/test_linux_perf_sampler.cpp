@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include "platform/linux/linux_power_backends.h"
+#include "mocks/fake_sysfs_fixture.h"
+
+namespace fs = std::filesystem;
+
+class TestLinuxPerfSampler : public FakeSysfsTest {
+protected:
+    TestLinuxPerfSampler() : FakeSysfsTest("perf") {}
+};
+
+// Test counting on the real PMU; containers, VMs and perf_event_paranoid often deny it
+TEST_F(TestLinuxPerfSampler, test_sample_reports_deltas_after_priming) {
+    auto sampler = createLinuxPerfSampler();
+    if (!sampler->initialize()) {
+        GTEST_SKIP() << "Hardware performance counters are not accessible here";
+    }
+
+    EXPECT_NE("none", sampler->getMemoryEvent());
+    EXPECT_FALSE(sampler->sample().has_value());
+
+    volatile uint64_t spin = 0;
+    for (uint64_t i = 0; i < 10000000; ++i) {
+        spin = spin + i;
+    }
+
+    auto counters = sampler->sample();
+    ASSERT_TRUE(counters.has_value());
+    EXPECT_GT(counters->cycles, 0u);
+    EXPECT_GT(counters->instructions, 0u);
+    EXPECT_TRUE(counters->stalledCycles.has_value() != counters->llcMisses.has_value());
+}
+
+// Test degradation
+TEST_F(TestLinuxPerfSampler, test_initialize_fails_without_online_cpus) {
+    writeFile(root / "online", "");
+    auto sampler = createLinuxPerfSampler(root.string());
+
+    EXPECT_FALSE(sampler->initialize());
+    EXPECT_FALSE(sampler->sample().has_value());
+    EXPECT_EQ("none", sampler->getMemoryEvent());
+}
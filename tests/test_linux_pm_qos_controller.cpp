@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "platform/linux/linux_power_backends.h"
+#include "mocks/fake_sysfs_fixture.h"
+
+namespace fs = std::filesystem;
+
+class TestLinuxPmQosController : public FakeSysfsTest {
+protected:
+    TestLinuxPmQosController() : FakeSysfsTest("pm_qos") {}
+
+    void SetUp() override {
+        FakeSysfsTest::SetUp();
+
+        // Fake latency device and /sys/devices/system/cpu
+        writeFile(device(), "");
+        for (int cpu = 0; cpu < 3; ++cpu) {
+            writeFile(resumeLatency(cpu), "0");
+        }
+    }
+
+    // Helper: descriptors this process holds on the latency device
+    int openDescriptors() const {
+        int count = 0;
+        for (const auto& entry : fs::directory_iterator("/proc/self/fd")) {
+            std::error_code ec;
+            if (fs::read_symlink(entry.path(), ec) == device()) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    fs::path device() const { return root / "cpu_dma_latency"; }
+    fs::path cpuRoot() const { return root / "cpu"; }
+    fs::path resumeLatency(int cpu) const {
+        return cpuRoot() / ("cpu" + std::to_string(cpu)) / "power" / "pm_qos_resume_latency_us";
+    }
+
+    std::unique_ptr<IPmQosController> createController() {
+        return createLinuxPmQosController(device().string(), cpuRoot().string());
+    }
+};
+
+// Test the system-wide request
+TEST_F(TestLinuxPmQosController, test_request_is_held_only_in_performance_tier) {
+    auto controller = createController();
+    ASSERT_TRUE(controller->initialize(20, false));
+
+    controller->setTier(PowerTier::BALANCED_PERFORMANCE);
+    EXPECT_EQ(0, openDescriptors());
+
+    controller->setTier(PowerTier::PERFORMANCE);
+    EXPECT_EQ(1, openDescriptors());
+    controller->setTier(PowerTier::PERFORMANCE);
+    EXPECT_EQ(1, openDescriptors());
+
+    // The device takes the bound as a binary 32-bit value
+    int32_t written = 0;
+    {
+        std::ifstream file(device(), std::ios::binary);
+        file.read(reinterpret_cast<char*>(&written), sizeof(written));
+    }
+    EXPECT_EQ(20, written);
+
+    controller->setTier(PowerTier::POWER_SAVE);
+    EXPECT_EQ(0, openDescriptors());
+}
+
+TEST_F(TestLinuxPmQosController, test_release_closes_request) {
+    auto controller = createController();
+    ASSERT_TRUE(controller->initialize(0, false));
+    controller->setTier(PowerTier::PERFORMANCE);
+    ASSERT_EQ(1, openDescriptors());
+
+    EXPECT_TRUE(controller->release());
+    EXPECT_EQ(0, openDescriptors());
+
+    EXPECT_FALSE(createLinuxPmQosController((root / "missing").string(), cpuRoot().string())->initialize(20, false));
+}
+
+// Test per-CPU requests
+TEST_F(TestLinuxPmQosController, test_per_cpu_bound_follows_busy_cpus) {
+    auto controller = createController();
+    ASSERT_TRUE(controller->initialize(50, true));
+
+    // Outside the performance tier nothing is bound
+    controller->update({0.9, 0.1, 0.9});
+    EXPECT_EQ("0", readFile(resumeLatency(0)));
+
+    controller->setTier(PowerTier::PERFORMANCE);
+    controller->update({0.9, 0.1, 0.9});
+    EXPECT_EQ("50", readFile(resumeLatency(0)));
+    EXPECT_EQ("0", readFile(resumeLatency(1)));
+    EXPECT_EQ("50", readFile(resumeLatency(2)));
+    EXPECT_EQ(0, openDescriptors());
+
+    controller->update({0.9, 0.8, 0.05});
+    EXPECT_EQ("50", readFile(resumeLatency(1)));
+    EXPECT_EQ("0", readFile(resumeLatency(2)));
+
+    controller->setTier(PowerTier::BALANCED_PERFORMANCE);
+    EXPECT_EQ("0", readFile(resumeLatency(0)));
+    EXPECT_EQ("0", readFile(resumeLatency(1)));
+}
@@ -0,0 +1,424 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include "platform/linux/linux_power_backends.h"
+#include "platform/linux/linux_dbus.h"
+#include "mocks/fake_power_profiles_bus.h"
+#include "mocks/fake_sysfs_fixture.h"
+
+namespace fs = std::filesystem;
+
+class TestLinuxPowerBackends : public FakeSysfsTest {
+protected:
+    TestLinuxPowerBackends() : FakeSysfsTest("cpu") {}
+
+    // Helper: intel_pstate active mode with the given number of policies
+    void createIntelPstate(int policyCount, const std::string& status = "active") {
+        writeFile(root / "intel_pstate" / "status", status);
+        writeFile(root / "intel_pstate" / "min_perf_pct", "9");
+        writeFile(root / "intel_pstate" / "max_perf_pct", "100");
+        for (int i = 0; i < policyCount; ++i) {
+            fs::path policy = root / "cpufreq" / ("policy" + std::to_string(i));
+            writeFile(policy / "scaling_driver", "intel_pstate");
+            writeFile(policy / "scaling_governor", "powersave");
+            writeFile(policy / "energy_performance_preference", "balance_performance");
+        }
+    }
+
+    // Helper: acpi-cpufreq policies offering the given governors
+    void createAcpiCpufreq(int policyCount, const std::string& governors) {
+        for (int i = 0; i < policyCount; ++i) {
+            fs::path policy = root / "cpufreq" / ("policy" + std::to_string(i));
+            writeFile(policy / "scaling_driver", "acpi-cpufreq");
+            writeFile(policy / "scaling_available_governors", governors);
+            writeFile(policy / "scaling_governor", "schedutil");
+        }
+    }
+};
+
+// Test driver detection
+TEST_F(TestLinuxPowerBackends, test_epp_backend_available_in_intel_pstate_active_mode) {
+    createIntelPstate(2);
+
+    auto powerManager = createLinuxEppPowerManager(root.string());
+
+    EXPECT_TRUE(powerManager->isAvailable());
+    EXPECT_EQ("performance", powerManager->getCurrentMode());
+}
+
+TEST_F(TestLinuxPowerBackends, test_epp_backend_unavailable_in_passive_mode) {
+    createIntelPstate(1, "passive");
+
+    auto powerManager = createLinuxEppPowerManager(root.string());
+
+    EXPECT_FALSE(powerManager->isAvailable());
+    EXPECT_FALSE(powerManager->setTier(PowerTier::POWER_SAVE));
+}
+
+TEST_F(TestLinuxPowerBackends, test_epp_backend_unavailable_without_cpufreq) {
+    auto powerManager = createLinuxEppPowerManager(root.string());
+
+    EXPECT_FALSE(powerManager->isAvailable());
+}
+
+TEST_F(TestLinuxPowerBackends, test_epp_backend_detects_amd_pstate_epp) {
+    writeFile(root / "amd_pstate" / "status", "active");
+    writeFile(root / "cpufreq" / "policy0" / "scaling_driver", "amd-pstate-epp");
+    writeFile(root / "cpufreq" / "policy0" / "scaling_governor", "powersave");
+    writeFile(root / "cpufreq" / "policy0" / "energy_performance_preference", "performance");
+
+    auto powerManager = createLinuxEppPowerManager(root.string());
+
+    ASSERT_TRUE(powerManager->isAvailable());
+    EXPECT_TRUE(powerManager->setTier(PowerTier::BALANCED_POWER));
+    EXPECT_EQ("balance_power", readFile(root / "cpufreq" / "policy0" / "energy_performance_preference"));
+}
+
+// Test tier mapping
+TEST_F(TestLinuxPowerBackends, test_epp_backend_maps_tiers_to_epp_and_perf_limits) {
+    createIntelPstate(2);
+    auto powerManager = createLinuxEppPowerManager(root.string());
+
+    EXPECT_TRUE(powerManager->setPowerSavingMode());
+
+    EXPECT_EQ("power", readFile(root / "cpufreq" / "policy0" / "energy_performance_preference"));
+    EXPECT_EQ("power", readFile(root / "cpufreq" / "policy1" / "energy_performance_preference"));
+    EXPECT_EQ("70", readFile(root / "intel_pstate" / "max_perf_pct"));
+    EXPECT_EQ("powersaving", powerManager->getCurrentMode());
+    // The admin's performance floor is left alone
+    EXPECT_EQ("9", readFile(root / "intel_pstate" / "min_perf_pct"));
+
+    EXPECT_TRUE(powerManager->setPerformanceMode());
+
+    EXPECT_EQ("performance", readFile(root / "cpufreq" / "policy0" / "energy_performance_preference"));
+    EXPECT_EQ("100", readFile(root / "intel_pstate" / "max_perf_pct"));
+    EXPECT_EQ("performance", powerManager->getCurrentMode());
+}
+
+TEST_F(TestLinuxPowerBackends, test_epp_backend_switches_governor_to_powersave) {
+    createIntelPstate(1);
+    writeFile(root / "cpufreq" / "policy0" / "scaling_governor", "performance");
+    auto powerManager = createLinuxEppPowerManager(root.string());
+
+    EXPECT_TRUE(powerManager->setTier(PowerTier::BALANCED_PERFORMANCE));
+
+    EXPECT_EQ("powersave", readFile(root / "cpufreq" / "policy0" / "scaling_governor"));
+}
+
+// Test write deduplication
+TEST_F(TestLinuxPowerBackends, test_epp_backend_skips_unchanged_attributes) {
+    createIntelPstate(1);
+    auto powerManager = createLinuxEppPowerManager(root.string());
+    ASSERT_TRUE(powerManager->setTier(PowerTier::BALANCED_POWER));
+
+    // Make the attributes unwritable: a second identical request must not touch them
+    for (const char* name : {"energy_performance_preference", "scaling_governor"}) {
+        fs::path path = root / "cpufreq" / "policy0" / name;
+        fs::remove(path);
+        fs::create_directories(path);
+    }
+
+    EXPECT_TRUE(powerManager->setTier(PowerTier::BALANCED_POWER));
+}
+
+// Test that requests for the tier in effect use no rate limit budget (2 switches per minute)
+TEST_F(TestLinuxPowerBackends, test_unchanged_tier_is_not_rate_limited) {
+    createIntelPstate(1);
+    auto eppManager = createLinuxEppPowerManager(root.string());
+    ASSERT_TRUE(eppManager->setTier(PowerTier::POWER_SAVE));
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(eppManager->setTier(PowerTier::POWER_SAVE));
+    }
+    EXPECT_TRUE(eppManager->setTier(PowerTier::PERFORMANCE));
+    EXPECT_FALSE(eppManager->setTier(PowerTier::POWER_SAVE));
+
+    fs::remove_all(root / "cpufreq");
+    createAcpiCpufreq(1, "powersave performance schedutil");
+    auto governorManager = createLinuxGovernorPowerManager(root.string());
+    ASSERT_TRUE(governorManager->setTier(PowerTier::POWER_SAVE));
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(governorManager->setTier(PowerTier::POWER_SAVE));
+    }
+    EXPECT_TRUE(governorManager->setTier(PowerTier::PERFORMANCE));
+    EXPECT_FALSE(governorManager->setTier(PowerTier::POWER_SAVE));
+}
+
+TEST_F(TestLinuxPowerBackends, test_epp_backend_confirms_tier_left_by_previous_run) {
+    createIntelPstate(2);
+    writeFile(root / "cpufreq" / "policy1" / "energy_performance_preference", "power");
+    auto powerManager = createLinuxEppPowerManager(root.string());
+
+    // Policies disagree: neither tier is in effect, and nothing is written
+    EXPECT_FALSE(powerManager->confirmTier(PowerTier::POWER_SAVE));
+    EXPECT_FALSE(powerManager->confirmTier(PowerTier::BALANCED_PERFORMANCE));
+    EXPECT_EQ("power", readFile(root / "cpufreq" / "policy1" / "energy_performance_preference"));
+
+    writeFile(root / "cpufreq" / "policy1" / "energy_performance_preference", "balance_performance");
+    EXPECT_TRUE(powerManager->confirmTier(PowerTier::BALANCED_PERFORMANCE));
+    EXPECT_EQ("100", readFile(root / "intel_pstate" / "max_perf_pct"));
+
+    // Confirmed settings are watched like applied ones
+    writeFile(root / "cpufreq" / "policy0" / "energy_performance_preference", "power");
+    EXPECT_EQ(1u, powerManager->detectExternalChanges().size());
+}
+
+// Test cpufreq governor backend
+TEST_F(TestLinuxPowerBackends, test_governor_backend_maps_tiers_to_governors) {
+    createAcpiCpufreq(2, "conservative ondemand userspace powersave performance schedutil");
+
+    auto powerManager = createLinuxGovernorPowerManager(root.string());
+    ASSERT_TRUE(powerManager->isAvailable());
+    EXPECT_EQ("governor", powerManager->getBackendName());
+
+    EXPECT_TRUE(powerManager->setTier(PowerTier::POWER_SAVE));
+    EXPECT_EQ("powersave", readFile(root / "cpufreq" / "policy0" / "scaling_governor"));
+    EXPECT_EQ("powersave", readFile(root / "cpufreq" / "policy1" / "scaling_governor"));
+    EXPECT_EQ("powersaving", powerManager->getCurrentMode());
+
+    EXPECT_TRUE(powerManager->setTier(PowerTier::BALANCED_PERFORMANCE));
+    EXPECT_EQ("schedutil", readFile(root / "cpufreq" / "policy1" / "scaling_governor"));
+    EXPECT_EQ("performance", powerManager->getCurrentMode());
+}
+
+TEST_F(TestLinuxPowerBackends, test_governor_backend_counts_verified_switches) {
+    createAcpiCpufreq(2, "powersave performance schedutil");
+    // Writes to /dev/null succeed but never read back
+    fs::path ignored = root / "cpufreq" / "policy1" / "scaling_governor";
+    fs::remove(ignored);
+    fs::create_symlink("/dev/null", ignored);
+
+    auto powerManager = createLinuxGovernorPowerManager(root.string());
+    ASSERT_TRUE(powerManager->isAvailable());
+
+    EXPECT_TRUE(powerManager->setTier(PowerTier::POWER_SAVE));
+    EXPECT_EQ(1, powerManager->getActuationMetrics().partial);
+
+    fs::remove(ignored);
+    writeFile(ignored, "schedutil");
+    EXPECT_TRUE(powerManager->setTier(PowerTier::PERFORMANCE));
+    EXPECT_EQ(1, powerManager->getActuationMetrics().succeeded);
+    EXPECT_EQ(0, powerManager->getActuationMetrics().failed);
+}
+
+TEST_F(TestLinuxPowerBackends, test_governor_backend_detects_external_governor_change) {
+    createAcpiCpufreq(1, "powersave performance schedutil");
+
+    auto powerManager = createLinuxGovernorPowerManager(root.string());
+    ASSERT_TRUE(powerManager->setTier(PowerTier::POWER_SAVE));
+    EXPECT_TRUE(powerManager->detectExternalChanges().empty());
+
+    writeFile(root / "cpufreq" / "policy0" / "scaling_governor", "performance");
+    std::vector<ExternalChange> changes = powerManager->detectExternalChanges();
+    ASSERT_EQ(1u, changes.size());
+    EXPECT_EQ("powersave", changes[0].expected);
+    EXPECT_EQ("performance", changes[0].actual);
+}
+
+TEST_F(TestLinuxPowerBackends, test_governor_backend_requires_performance_and_powersave) {
+    createAcpiCpufreq(1, "userspace schedutil");
+
+    auto powerManager = createLinuxGovernorPowerManager(root.string());
+
+    EXPECT_FALSE(powerManager->isAvailable());
+    EXPECT_FALSE(powerManager->setPerformanceMode());
+}
+
+TEST_F(TestLinuxPowerBackends, test_backends_reapply_current_mode_unchanged) {
+    createIntelPstate(1);
+    writeFile(root / "cpufreq" / "policy0" / "scaling_available_governors", "performance powersave");
+
+    auto eppManager = createLinuxEppPowerManager(root.string());
+    auto governorManager = createLinuxGovernorPowerManager(root.string());
+
+    EXPECT_TRUE(eppManager->reapplyCurrentMode());
+    EXPECT_TRUE(governorManager->reapplyCurrentMode());
+    EXPECT_EQ("balance_performance", readFile(root / "cpufreq" / "policy0" / "energy_performance_preference"));
+    EXPECT_EQ("powersave", readFile(root / "cpufreq" / "policy0" / "scaling_governor"));
+}
+
+// Test per-policy control domains
+TEST_F(TestLinuxPowerBackends, test_epp_backend_applies_domain_tier_to_one_policy) {
+    createIntelPstate(2);
+
+    auto powerManager = createLinuxEppPowerManager(root.string());
+    ASSERT_TRUE(powerManager->supportsControlDomains());
+
+    EXPECT_TRUE(powerManager->setDomainTier({"policy1", {4, 5, 6, 7}}, PowerTier::POWER_SAVE));
+    EXPECT_EQ("balance_performance", readFile(root / "cpufreq" / "policy0" / "energy_performance_preference"));
+    EXPECT_EQ("power", readFile(root / "cpufreq" / "policy1" / "energy_performance_preference"));
+    // Package-wide perf limits are left alone
+    EXPECT_EQ("100", readFile(root / "intel_pstate" / "max_perf_pct"));
+}
+
+TEST_F(TestLinuxPowerBackends, test_epp_backend_applies_package_tier_with_uncore_limit) {
+    createIntelPstate(3);
+    // Package 0 holds policies 0 and 1, package 1 holds policy 2
+    for (int i = 0; i < 3; ++i) {
+        writeFile(root / "cpufreq" / ("policy" + std::to_string(i)) / "related_cpus", std::to_string(i));
+    }
+    for (int package = 0; package < 2; ++package) {
+        fs::path uncore = root / "intel_uncore_frequency" / ("package_0" + std::to_string(package) + "_die_00");
+        writeFile(uncore / "initial_min_freq_khz", "800000");
+        writeFile(uncore / "initial_max_freq_khz", "2400000");
+        writeFile(uncore / "max_freq_khz", "2400000");
+    }
+
+    auto powerManager = createLinuxEppPowerManager(root.string());
+    ControlDomain package0{"package0", {0, 1}, ControlDomainScope::PACKAGE, 0};
+
+    EXPECT_TRUE(powerManager->setDomainTier(package0, PowerTier::POWER_SAVE));
+    EXPECT_EQ("power", readFile(root / "cpufreq" / "policy0" / "energy_performance_preference"));
+    EXPECT_EQ("power", readFile(root / "cpufreq" / "policy1" / "energy_performance_preference"));
+    EXPECT_EQ("balance_performance", readFile(root / "cpufreq" / "policy2" / "energy_performance_preference"));
+    // Half the boot-time uncore range: 800 MHz + 800 MHz
+    EXPECT_EQ("1600000", readFile(root / "intel_uncore_frequency" / "package_00_die_00" / "max_freq_khz"));
+    EXPECT_EQ("2400000", readFile(root / "intel_uncore_frequency" / "package_01_die_00" / "max_freq_khz"));
+}
+
+TEST_F(TestLinuxPowerBackends, test_domain_tier_rejects_unknown_policy) {
+    createAcpiCpufreq(1, "performance powersave");
+
+    auto powerManager = createLinuxGovernorPowerManager(root.string());
+
+    EXPECT_FALSE(powerManager->setDomainTier({"../policy0", {0}}, PowerTier::PERFORMANCE));
+    EXPECT_FALSE(powerManager->setDomainTier({"policy7", {7}}, PowerTier::PERFORMANCE));
+    EXPECT_TRUE(powerManager->setDomainTier({"policy0", {0}}, PowerTier::PERFORMANCE));
+    EXPECT_EQ("performance", readFile(root / "cpufreq" / "policy0" / "scaling_governor"));
+}
+
+// Test power-profiles-daemon backend against a private bus stand-in
+TEST_F(TestLinuxPowerBackends, test_dbus_message_round_trip) {
+    DBusMessage message;
+    message.serial = 7;
+    message.destination = "org.freedesktop.UPower.PowerProfiles";
+    message.path = "/org/freedesktop/UPower/PowerProfiles";
+    message.interface = "org.freedesktop.DBus.Properties";
+    message.member = "Set";
+    message.signature = "ssv";
+    DBusWriter body;
+    body.writeString("org.freedesktop.UPower.PowerProfiles");
+    body.writeString("ActiveProfile");
+    body.writeVariantString("power-saver");
+    message.body = body.data();
+
+    std::vector<uint8_t> wire = message.serialize();
+    EXPECT_EQ(0u, (wire.size() - message.body.size()) % 8);  // body starts 8-aligned
+
+    size_t consumed = 0;
+    auto parsed = DBusMessage::parse(wire, consumed);
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(wire.size(), consumed);
+    EXPECT_EQ(7u, parsed->serial);
+    EXPECT_EQ("Set", parsed->member);
+    EXPECT_EQ("ssv", parsed->signature);
+
+    std::string interfaceName, property, value;
+    DBusReader reader = parsed->bodyReader();
+    EXPECT_TRUE(reader.readString(interfaceName));
+    EXPECT_TRUE(reader.readString(property));
+    EXPECT_TRUE(reader.readVariant(value));
+    EXPECT_EQ("power-saver", value);
+}
+
+TEST_F(TestLinuxPowerBackends, test_dbus_parse_waits_for_complete_message) {
+    DBusMessage message;
+    message.serial = 1;
+    message.member = "Hello";
+    std::vector<uint8_t> wire = message.serialize();
+    wire.pop_back();
+
+    size_t consumed = 0;
+    EXPECT_EQ(0u, DBusMessage::completeSize(wire));
+    EXPECT_FALSE(DBusMessage::parse(wire, consumed).has_value());
+}
+
+TEST_F(TestLinuxPowerBackends, test_dbus_parse_reads_reply_serial_as_uint32) {
+    DBusMessage reply;
+    reply.type = DBusMessage::METHOD_RETURN;
+    reply.serial = 3;
+    reply.replySerial = 4000000000u;
+    std::vector<uint8_t> wire = reply.serialize();
+    // A second message in the buffer is left for the next parse
+    std::vector<uint8_t> next = reply.serialize();
+    wire.insert(wire.end(), next.begin(), next.end());
+
+    size_t consumed = 0;
+    auto parsed = DBusMessage::parse(wire, consumed);
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(next.size(), consumed);
+    EXPECT_EQ(4000000000u, parsed->replySerial);
+
+    // REPLY_SERIAL sent as a string is rejected instead of converted
+    DBusWriter malformed;
+    for (uint8_t byte : {uint8_t{'l'}, uint8_t{DBusMessage::METHOD_RETURN}, uint8_t{0}, uint8_t{1}}) {
+        malformed.writeByte(byte);
+    }
+    malformed.writeUint32(0);
+    malformed.writeUint32(5);
+    malformed.writeUint32(0);
+    malformed.writeByte(5);
+    malformed.writeSignature("s");
+    malformed.writeString("not a serial");
+    uint32_t fieldsLength = static_cast<uint32_t>(malformed.data().size() - 16);
+    for (size_t i = 0; i < 4; ++i) {
+        malformed.data()[12 + i] = static_cast<uint8_t>((fieldsLength >> (i * 8)) & 0xFF);
+    }
+    malformed.align(8);
+    EXPECT_FALSE(DBusMessage::parse(malformed.data(), consumed).has_value());
+}
+
+TEST_F(TestLinuxPowerBackends, test_ppd_backend_sets_active_profile_over_one_connection) {
+    FakePowerProfilesBus bus((root / "bus").string(), "org.freedesktop.UPower.PowerProfiles");
+    auto powerManager = createLinuxPpdPowerManager(bus.address());
+
+    ASSERT_TRUE(powerManager->isAvailable());
+    EXPECT_EQ("performance", powerManager->getCurrentMode());  // balanced counts as performance
+    EXPECT_TRUE(powerManager->reapplyCurrentMode());
+    EXPECT_EQ("balanced", bus.activeProfile());
+
+    EXPECT_TRUE(powerManager->setPowerSavingMode());
+    EXPECT_EQ("power-saver", bus.activeProfile());
+    EXPECT_EQ("powersaving", powerManager->getCurrentMode());
+
+    EXPECT_TRUE(powerManager->setPerformanceMode());
+    EXPECT_EQ("performance", bus.activeProfile());
+
+    // Connection is persistent: availability check and both switches share one connection
+    EXPECT_EQ(1, bus.connectionCount());
+    EXPECT_EQ(3, bus.setCount());
+    EXPECT_EQ(2, powerManager->getActuationMetrics().succeeded);
+}
+
+TEST_F(TestLinuxPowerBackends, test_ppd_backend_supports_legacy_bus_name) {
+    FakePowerProfilesBus bus((root / "bus").string(), "net.hadess.PowerProfiles");
+    auto powerManager = createLinuxPpdPowerManager(bus.address());
+
+    ASSERT_TRUE(powerManager->isAvailable());
+    EXPECT_TRUE(powerManager->setTier(PowerTier::POWER_SAVE));
+    EXPECT_EQ("power-saver", bus.activeProfile());
+}
+
+TEST_F(TestLinuxPowerBackends, test_ppd_backend_falls_back_to_balanced_without_performance) {
+    FakePowerProfilesBus bus((root / "bus").string(), "org.freedesktop.UPower.PowerProfiles");
+    bus.setActiveProfile("power-saver");
+    bus.setPerformanceAvailable(false);
+    auto powerManager = createLinuxPpdPowerManager(bus.address());
+
+    EXPECT_TRUE(powerManager->setPerformanceMode());
+    EXPECT_EQ("balanced", bus.activeProfile());
+    EXPECT_EQ(2, bus.setCount());
+
+    // The rejection is remembered: repeated requests are no-ops and use no rate limit budget
+    EXPECT_TRUE(powerManager->setPerformanceMode());
+    EXPECT_TRUE(powerManager->setTier(PowerTier::BALANCED_PERFORMANCE));
+    EXPECT_EQ(2, bus.setCount());
+    EXPECT_TRUE(powerManager->setPowerSavingMode());
+    EXPECT_EQ("power-saver", bus.activeProfile());
+}
+
+TEST_F(TestLinuxPowerBackends, test_ppd_backend_unavailable_without_bus) {
+    auto powerManager = createLinuxPpdPowerManager("unix:path=" + (root / "missing_bus").string());
+
+    EXPECT_FALSE(powerManager->isAvailable());
+    EXPECT_FALSE(powerManager->setPerformanceMode());
+}
@@ -0,0 +1,263 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include "platform/linux/linux_power_plan.h"
+#include "platform/linux/linux_sysfs.h"
+#include "logger.h"
+
+namespace fs = std::filesystem;
+
+class TestLinuxPowerPlan : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Fake attribute directory
+        root = fs::temp_directory_path() / ("ddogreen_fake_power_plan_" + std::to_string(getpid()));
+        fs::remove_all(root);
+        fs::create_directories(root);
+
+        // Suppress logger output during tests
+        Logger::setLevel(LogLevel::ERROR);
+    }
+
+    void TearDown() override {
+        // Clean up fake attributes
+        fs::remove_all(root);
+
+        // Restore logger level
+        Logger::setLevel(LogLevel::INFO);
+    }
+
+    std::string attribute(const std::string& name, const std::string& value) {
+        fs::path path = root / name;
+        std::ofstream file(path);
+        file << value << "\n";
+        return path.string();
+    }
+
+    std::string readFile(const std::string& path) {
+        return LinuxSysfs::readAttribute(path).value_or("<missing>");
+    }
+
+    fs::path root;
+};
+
+// Test write deduplication
+TEST_F(TestLinuxPowerPlan, test_apply_writes_only_changed_attributes) {
+    std::string governor = attribute("scaling_governor", "powersave");
+    std::string epp = attribute("energy_performance_preference", "balance_performance");
+
+    LinuxPowerPlanExecutor executor;
+    PowerPlanResult result = executor.apply({
+        {governor, "powersave", "governor", 0, false},
+        {epp, "power", "epp", 1, false},
+    });
+
+    EXPECT_TRUE(result.success);
+    EXPECT_EQ(1, result.written);
+    EXPECT_EQ(1, result.unchanged);
+    ASSERT_EQ(1u, result.timings.size());
+    EXPECT_EQ("epp", result.timings[0].knob);
+    EXPECT_TRUE(executor.averageLatency(epp).has_value());
+    EXPECT_FALSE(executor.averageLatency(governor).has_value());
+    EXPECT_EQ("power", readFile(epp));
+}
+
+TEST_F(TestLinuxPowerPlan, test_cached_values_skip_until_invalidated) {
+    std::string epp = attribute("energy_performance_preference", "balance_performance");
+    PowerPlan plan = {{epp, "power", "epp", 0, false}};
+
+    LinuxPowerPlanExecutor executor;
+    ASSERT_TRUE(executor.apply(plan).success);
+
+    // An external change is not seen while the cache is valid
+    attribute("energy_performance_preference", "performance");
+    EXPECT_EQ(0, executor.apply(plan).written);
+
+    executor.invalidate();
+    EXPECT_EQ(1, executor.apply(plan).written);
+    EXPECT_EQ("power", readFile(epp));
+}
+
+// Test ordering
+TEST_F(TestLinuxPowerPlan, test_apply_runs_stages_in_order) {
+    std::string maxPerf = attribute("max_perf_pct", "100");
+    std::string minPerf = attribute("min_perf_pct", "50");
+    std::string governor = attribute("scaling_governor", "performance");
+
+    LinuxPowerPlanExecutor executor;
+    PowerPlanResult result = executor.apply({
+        {maxPerf, "60", "max_perf_pct", 2, true},
+        {minPerf, "10", "min_perf_pct", 1, true},
+        {governor, "powersave", "governor", 0, false},
+    });
+
+    EXPECT_TRUE(result.success);
+    ASSERT_EQ(3u, result.timings.size());
+    EXPECT_EQ("governor", result.timings[0].knob);
+    EXPECT_EQ("min_perf_pct", result.timings[1].knob);
+    EXPECT_EQ("max_perf_pct", result.timings[2].knob);
+    EXPECT_EQ("60", executor.cachedValue(maxPerf).value());
+}
+
+// Test rollback
+TEST_F(TestLinuxPowerPlan, test_failed_write_rolls_back_previous_writes) {
+    std::string governor = attribute("scaling_governor", "performance");
+    std::string epp = attribute("energy_performance_preference", "performance");
+    // A directory cannot be written, even as root
+    std::string broken = (root / "max_perf_pct").string();
+    fs::create_directories(broken);
+
+    LinuxPowerPlanExecutor executor;
+    PowerPlanResult result = executor.apply({
+        {governor, "powersave", "governor", 0, false},
+        {epp, "power", "epp", 1, false},
+        {broken, "60", "max_perf_pct", 2, false},
+    });
+
+    EXPECT_FALSE(result.success);
+    EXPECT_TRUE(result.rolledBack);
+    EXPECT_EQ(broken, result.failedPath);
+    EXPECT_EQ("performance", readFile(governor));
+    EXPECT_EQ("performance", readFile(epp));
+    EXPECT_EQ("performance", executor.cachedValue(epp).value());
+}
+
+TEST_F(TestLinuxPowerPlan, test_failure_on_first_write_needs_no_rollback) {
+    std::string broken = (root / "scaling_governor").string();
+    fs::create_directories(broken);
+
+    LinuxPowerPlanExecutor executor;
+    PowerPlanResult result = executor.apply({{broken, "powersave", "governor", 0, false}});
+
+    EXPECT_FALSE(result.success);
+    EXPECT_FALSE(result.rolledBack);
+    EXPECT_EQ(0, result.written);
+}
+
+// Test readback verification
+TEST_F(TestLinuxPowerPlan, test_verify_confirms_applied_plan) {
+    std::string governor = attribute("scaling_governor", "performance");
+    std::string maxPerf = attribute("max_perf_pct", "100");
+    PowerPlan plan = {
+        {governor, "powersave", "governor", 0, false},
+        {maxPerf, "60", "max_perf_pct", 1, true},
+    };
+
+    LinuxPowerPlanExecutor executor;
+    ASSERT_TRUE(executor.apply(plan).success);
+
+    // A clamped attribute only has to be readable
+    attribute("max_perf_pct", "70");
+    PlanVerification verification = executor.verify(plan);
+    EXPECT_EQ(ActuationOutcome::SUCCEEDED, verification.outcome());
+    EXPECT_EQ(2, verification.matched);
+    EXPECT_EQ(0, verification.retries);
+    EXPECT_EQ("70", executor.cachedValue(maxPerf).value());
+}
+
+TEST_F(TestLinuxPowerPlan, test_verify_rewrites_and_reports_ignored_attribute) {
+    std::string epp = attribute("energy_performance_preference", "performance");
+    // Writes to /dev/null succeed but never read back
+    std::string ignored = (root / "scaling_governor").string();
+    fs::create_symlink("/dev/null", ignored);
+    PowerPlan plan = {
+        {ignored, "powersave", "governor", 0, false},
+        {epp, "power", "epp", 1, false},
+    };
+
+    LinuxPowerPlanExecutor executor;
+    ASSERT_TRUE(executor.apply(plan).success);
+
+    PlanVerification verification = executor.verify(plan);
+    EXPECT_EQ(ActuationOutcome::PARTIAL, verification.outcome());
+    EXPECT_EQ(1, verification.matched);
+    EXPECT_EQ(3, verification.retries);
+    EXPECT_EQ((std::vector<std::string>{ignored}), verification.mismatchedPaths);
+
+    // The cache holds what was read, so the next apply writes the attribute again
+    EXPECT_EQ(1, executor.apply(plan).written);
+}
+
+TEST_F(TestLinuxPowerPlan, test_poll_with_backoff_counts_failed_checks) {
+    int checks = 0;
+    EXPECT_EQ(2, pollWithBackoff([&checks]() { return ++checks == 3; }, 4, std::chrono::milliseconds(1)).value());
+    EXPECT_FALSE(pollWithBackoff([]() { return false; }, 2, std::chrono::milliseconds(1)).has_value());
+}
+
+// Test out-of-band change detection
+TEST_F(TestLinuxPowerPlan, test_detect_external_changes_reports_each_change_once) {
+    std::string epp = attribute("energy_performance_preference", "balance_performance");
+    std::string maxPerf = attribute("max_perf_pct", "100");
+    PowerPlan plan = {
+        {epp, "power", "epp", 0, false},
+        {maxPerf, "70", "max_perf_pct", 1, true},
+    };
+
+    LinuxPowerPlanExecutor executor;
+    ASSERT_TRUE(executor.apply(plan).success);
+    executor.verify(plan);
+    EXPECT_TRUE(executor.detectExternalChanges().empty());
+
+    // Attributes the kernel may adjust itself are not watched
+    attribute("energy_performance_preference", "performance");
+    attribute("max_perf_pct", "100");
+    std::vector<ExternalChange> changes = executor.detectExternalChanges();
+    ASSERT_EQ(1u, changes.size());
+    EXPECT_EQ(epp, changes[0].setting);
+    EXPECT_EQ("power", changes[0].expected);
+    EXPECT_EQ("performance", changes[0].actual);
+    EXPECT_FALSE(changes[0].writer.empty());
+    EXPECT_TRUE(executor.detectExternalChanges().empty());
+
+    // The cache follows the change, so applying the plan again writes it back
+    EXPECT_EQ(1, executor.apply(plan).written);
+    EXPECT_EQ("power", readFile(epp));
+}
+
+// Test adopting a plan left in effect by an earlier run
+TEST_F(TestLinuxPowerPlan, test_adopt_if_applied_requires_every_value) {
+    std::string governor = attribute("scaling_governor", "powersave");
+    std::string epp = attribute("energy_performance_preference", "balance_performance");
+    std::string maxPerf = attribute("max_perf_pct", "85");
+    PowerPlan plan = {
+        {governor, "powersave", "scaling_governor", 0, false},
+        {epp, "power", "epp", 1, false},
+        {maxPerf, "70", "max_perf_pct", 2, true},
+    };
+
+    LinuxPowerPlanExecutor executor;
+    EXPECT_FALSE(executor.adoptIfApplied(plan));
+    EXPECT_FALSE(executor.adoptIfApplied({}));
+    EXPECT_EQ("balance_performance", readFile(epp));
+
+    // A clamped limit does not have to match
+    attribute("energy_performance_preference", "power");
+    EXPECT_TRUE(executor.adoptIfApplied(plan));
+    EXPECT_EQ("85", executor.cachedValue(maxPerf));
+    EXPECT_EQ("powersave", readFile(governor));
+
+    // The adopted values are the external change baseline
+    attribute("energy_performance_preference", "performance");
+    std::vector<ExternalChange> changes = executor.detectExternalChanges();
+    ASSERT_EQ(1u, changes.size());
+    EXPECT_EQ("power", changes[0].expected);
+}
+
+// Test writer identification from a fake procfs
+TEST_F(TestLinuxPowerPlan, test_identify_external_writer_finds_known_agents) {
+    fs::path proc = root / "proc";
+    for (const auto& [pid, comm] : std::vector<std::pair<std::string, std::string>>{
+             {"1", "systemd"}, {"412", "power-profiles-"}, {"530", "thermald"}, {"self", "thermald"}}) {
+        fs::create_directories(proc / pid);
+        std::ofstream(proc / pid / "comm") << comm << "\n";
+    }
+
+    std::string writer = identifyExternalWriter(proc.string());
+    EXPECT_NE(std::string::npos, writer.find("power-profiles-"));
+    EXPECT_NE(std::string::npos, writer.find("thermald"));
+    EXPECT_EQ(std::string::npos, writer.find("systemd"));
+
+    EXPECT_EQ("unknown", identifyExternalWriter((root / "empty").string()));
+}
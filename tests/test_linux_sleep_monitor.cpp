@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include "platform/linux/linux_power_backends.h"
+#include "logger.h"
+
+class TestLinuxSleepMonitor : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Suppress logger output during tests
+        Logger::setLevel(LogLevel::ERROR);
+    }
+
+    void TearDown() override {
+        // Restore logger level
+        Logger::setLevel(LogLevel::INFO);
+    }
+};
+
+// Test suspended time readout
+TEST_F(TestLinuxSleepMonitor, test_suspended_time_never_decreases) {
+    auto sleepMonitor = createLinuxSleepMonitor();
+
+    auto first = sleepMonitor->getSuspendedTime();
+    auto second = sleepMonitor->getSuspendedTime();
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_GE(first->count(), 0);
+    // BOOTTIME and MONOTONIC are read one after the other, so allow for the gap between the reads
+    EXPECT_GE(second->count(), first->count() - 1);
+}
+
+// Test the watcher thread lifecycle
+TEST_F(TestLinuxSleepMonitor, test_watcher_starts_and_stops_without_waking) {
+    auto sleepMonitor = createLinuxSleepMonitor();
+    std::atomic<int> wakes{0};
+
+    ASSERT_TRUE(sleepMonitor->start([&wakes]() { ++wakes; }));
+    EXPECT_TRUE(sleepMonitor->start([&wakes]() { ++wakes; }));
+    sleepMonitor->stop();
+    sleepMonitor->stop();
+
+    // Restartable after a stop
+    ASSERT_TRUE(sleepMonitor->start([&wakes]() { ++wakes; }));
+    sleepMonitor->stop();
+    EXPECT_EQ(0, wakes.load());
+}
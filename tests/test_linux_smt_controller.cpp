@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include "platform/linux/linux_power_backends.h"
+#include "mocks/fake_sysfs_fixture.h"
+
+namespace fs = std::filesystem;
+
+class TestLinuxSmtController : public FakeSysfsTest {
+protected:
+    TestLinuxSmtController() : FakeSysfsTest("smt_root") {}
+
+    void SetUp() override {
+        FakeSysfsTest::SetUp();
+
+        // Fake root holding /sys and /proc
+        writeFile(control(), "on");
+        writeFile(root / "sys" / "devices" / "system" / "cpu" / "online", "0-3");
+        // A kernel thread with SCHED_FIFO, as migration and IRQ threads are
+        writeThread(2, "migration/0", 0x00200040, 1);
+        writeThread(100, "bash", 0x00400100, 0);
+    }
+
+    // Helper: /proc/<pid>/task/<pid>/stat with the given flags (field 9) and policy (field 41)
+    void writeThread(int pid, const std::string& name, unsigned long flags, int policy) {
+        std::string stat = std::to_string(pid) + " (" + name + ") S";
+        for (int field = 4; field <= 52; ++field) {
+            stat += " " + (field == 9 ? std::to_string(flags) : field == 41 ? std::to_string(policy) : std::string("0"));
+        }
+        writeFile(root / "proc" / std::to_string(pid) / "task" / std::to_string(pid) / "stat", stat);
+    }
+
+    fs::path control() const { return root / "sys" / "devices" / "system" / "cpu" / "smt" / "control"; }
+};
+
+// Test availability
+TEST_F(TestLinuxSmtController, test_initialize_requires_smt_on) {
+    EXPECT_TRUE(createLinuxSmtController(root.string())->initialize(0.05));
+
+    writeFile(control(), "notsupported");
+    EXPECT_FALSE(createLinuxSmtController(root.string())->initialize(0.05));
+}
+
+// Test switching
+TEST_F(TestLinuxSmtController, test_smt_goes_off_after_quiet_samples_and_returns_with_load) {
+    auto controller = createLinuxSmtController(root.string());
+    ASSERT_TRUE(controller->initialize(0.05));
+    controller->setTier(PowerTier::POWER_SAVE);
+
+    controller->update({0.02, 0.01, 0.02, 0.01});
+    controller->update({0.02, 0.01, 0.02, 0.01});
+    EXPECT_EQ("on", readFile(control()));
+    controller->update({0.02, 0.01, 0.02, 0.01});
+    EXPECT_EQ("off", readFile(control()));
+
+    // Siblings 2-3 are offline now; only the online CPUs count
+    writeFile(root / "sys" / "devices" / "system" / "cpu" / "online", "0-1");
+    controller->update({0.08, 0.06, 0.0, 0.0});
+    EXPECT_EQ("off", readFile(control()));
+    controller->update({0.30, 0.10, 0.0, 0.0});
+    EXPECT_EQ("on", readFile(control()));
+}
+
+TEST_F(TestLinuxSmtController, test_smt_stays_on_outside_power_save_and_with_realtime_threads) {
+    auto controller = createLinuxSmtController(root.string());
+    ASSERT_TRUE(controller->initialize(0.05));
+
+    controller->setTier(PowerTier::BALANCED_POWER);
+    for (int i = 0; i < 4; ++i) {
+        controller->update({0.0, 0.0, 0.0, 0.0});
+    }
+    EXPECT_EQ("on", readFile(control()));
+
+    // A user space SCHED_RR thread, e.g. an audio server
+    writeThread(200, "pipewire data", 0x00400040, 2);
+    controller->setTier(PowerTier::POWER_SAVE);
+    for (int i = 0; i < 4; ++i) {
+        controller->update({0.0, 0.0, 0.0, 0.0});
+    }
+    EXPECT_EQ("on", readFile(control()));
+}
+
+TEST_F(TestLinuxSmtController, test_leaving_power_save_and_restore_switch_smt_on) {
+    auto controller = createLinuxSmtController(root.string());
+    ASSERT_TRUE(controller->initialize(0.05));
+    for (int i = 0; i < 3; ++i) {
+        controller->update({0.0, 0.0, 0.0, 0.0});
+    }
+    ASSERT_EQ("off", readFile(control()));
+
+    controller->setTier(PowerTier::PERFORMANCE);
+    EXPECT_EQ("on", readFile(control()));
+
+    controller->setTier(PowerTier::POWER_SAVE);
+    for (int i = 0; i < 3; ++i) {
+        controller->update({0.0, 0.0, 0.0, 0.0});
+    }
+    ASSERT_EQ("off", readFile(control()));
+    EXPECT_TRUE(controller->restore());
+    EXPECT_EQ("on", readFile(control()));
+}
+
+TEST_F(TestLinuxSmtController, test_realtime_threads_are_rescanned_at_a_low_rate_while_smt_is_off) {
+    auto controller = createLinuxSmtController(root.string());
+    ASSERT_TRUE(controller->initialize(0.05));
+    for (int i = 0; i < 3; ++i) {
+        controller->update({0.0, 0.0, 0.0, 0.0});
+    }
+    ASSERT_EQ("off", readFile(control()));
+
+    // The scan made before switching off holds for the next samples
+    writeThread(200, "pipewire data", 0x00400040, 2);
+    for (int i = 0; i < 9; ++i) {
+        controller->update({0.0, 0.0, 0.0, 0.0});
+    }
+    EXPECT_EQ("off", readFile(control()));
+    controller->update({0.0, 0.0, 0.0, 0.0});
+    EXPECT_EQ("on", readFile(control()));
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include "platform/isystem_monitor.h"
+#include "mocks/fake_sysfs_fixture.h"
+
+namespace fs = std::filesystem;
+
+// Factory function defined in the Linux system monitor translation unit
+std::unique_ptr<ISystemMonitor> createLinuxSystemMonitor(const std::string& rootPrefix);
+
+class TestLinuxSystemMonitor : public FakeSysfsTest {
+protected:
+    TestLinuxSystemMonitor() : FakeSysfsTest("monitor_root") {}
+
+    void SetUp() override {
+        FakeSysfsTest::SetUp();
+
+        // Fake root holding /proc and /sys
+        writeFile(root / "proc" / "cpuinfo", "processor\t: 0\nprocessor\t: 1\nprocessor\t: 2\nprocessor\t: 3");
+        writeFile(root / "proc" / "loadavg", "1.50 1.20 0.80 2/300 4242");
+    }
+
+    // Helper: /proc/stat with user and idle jiffies per CPU
+    void writeStat(const std::vector<std::pair<int, int>>& cpus) {
+        std::string content = "cpu  0 0 0 0 0 0 0 0 0 0\n";
+        for (size_t cpu = 0; cpu < cpus.size(); ++cpu) {
+            if (cpus[cpu].first < 0) {
+                continue;  // offline
+            }
+            content += "cpu" + std::to_string(cpu) + " " + std::to_string(cpus[cpu].first) + " 0 0 " +
+                       std::to_string(cpus[cpu].second) + " 0 0 0 0 0 0\n";
+        }
+        content += "intr 12345\nctxt 67890";
+        writeFile(root / "proc" / "stat", content);
+    }
+};
+
+// Test control domain discovery
+TEST_F(TestLinuxSystemMonitor, test_control_domains_follow_cpufreq_policies) {
+    fs::path cpufreq = root / "sys" / "devices" / "system" / "cpu" / "cpufreq";
+    writeFile(cpufreq / "policy0" / "related_cpus", "0 1");
+    writeFile(cpufreq / "policy2" / "related_cpus", "");
+    writeFile(cpufreq / "policy2" / "affected_cpus", "2 3");
+
+    auto monitor = createLinuxSystemMonitor(root.string());
+    std::vector<ControlDomain> domains = monitor->getControlDomains(ControlDomainScope::CPUFREQ_POLICY);
+
+    ASSERT_EQ(2u, domains.size());
+    EXPECT_EQ("policy0", domains[0].name);
+    EXPECT_EQ((std::vector<int>{0, 1}), domains[0].cpus);
+    EXPECT_EQ("policy2", domains[1].name);
+    EXPECT_EQ((std::vector<int>{2, 3}), domains[1].cpus);
+}
+
+// Test per-CPU utilization sampling
+TEST_F(TestLinuxSystemMonitor, test_cpu_utilization_uses_deltas_between_samples) {
+    writeStat({{100, 100}, {100, 100}, {100, 100}, {100, 100}});
+
+    auto monitor = createLinuxSystemMonitor(root.string());
+    std::vector<double> utilization;
+
+    // The first sample only primes the counters
+    EXPECT_FALSE(monitor->sampleCpuUtilization(utilization));
+
+    // CPU 3 went offline
+    writeStat({{190, 110}, {110, 190}, {150, 150}, {-1, -1}});
+    ASSERT_TRUE(monitor->sampleCpuUtilization(utilization));
+    ASSERT_EQ(3u, utilization.size());
+    EXPECT_DOUBLE_EQ(0.9, utilization[0]);
+    EXPECT_DOUBLE_EQ(0.1, utilization[1]);
+    EXPECT_DOUBLE_EQ(0.5, utilization[2]);
+}
+
+// Test hybrid topology discovery
+TEST_F(TestLinuxSystemMonitor, test_topology_reads_core_types_and_capacities) {
+    fs::path cpuRoot = root / "sys" / "devices" / "system" / "cpu";
+    writeFile(root / "sys" / "devices" / "cpu_core" / "cpus", "0-1");
+    writeFile(root / "sys" / "devices" / "cpu_atom" / "cpus", "2-3");
+    for (int cpu = 0; cpu < 4; ++cpu) {
+        fs::path dir = cpuRoot / ("cpu" + std::to_string(cpu));
+        bool performance = cpu < 2;
+        writeFile(dir / "topology" / "physical_package_id", "0");
+        writeFile(dir / "topology" / "core_id", performance ? "0" : std::to_string(cpu + 6));
+        writeFile(dir / "topology" / "thread_siblings_list", performance ? "0-1" : std::to_string(cpu));
+        writeFile(dir / "cache" / "index3" / "id", "0");
+        // No cpu_capacity - the maximum frequency ratio stands in
+        writeFile(dir / "cpufreq" / "cpuinfo_max_freq", performance ? "4800000" : "2400000");
+    }
+    // An offline CPU has no topology directory
+    fs::create_directories(cpuRoot / "cpu4");
+
+    auto monitor = createLinuxSystemMonitor(root.string());
+    CpuTopology topology = monitor->getCpuTopology();
+
+    ASSERT_EQ(4u, topology.getCpus().size());
+    EXPECT_TRUE(topology.isHybrid());
+    EXPECT_EQ(CoreType::PERFORMANCE, topology.getCpus()[1].type);
+    EXPECT_EQ(CoreType::EFFICIENCY, topology.getCpus()[2].type);
+    EXPECT_EQ((std::vector<int>{0, 1}), topology.getCpus()[0].smtSiblings);
+    EXPECT_DOUBLE_EQ(0.5, topology.getCpus()[3].capacity);
+    EXPECT_EQ(3, topology.getPhysicalCoreCount());
+
+    std::array<char, 256> buffer{};
+    size_t length = monitor->getSystemMetrics(buffer);
+    EXPECT_EQ("load=1.50,cores=4,physical_cores=3,pcores=2,ecores=2,packages=1,capacity=3.00",
+              std::string(buffer.data(), length));
+}
+
+// Test CPU hotplug and SMT switching
+TEST_F(TestLinuxSystemMonitor, test_online_cpu_change_refreshes_count_topology_and_samples) {
+    fs::path cpuRoot = root / "sys" / "devices" / "system" / "cpu";
+    writeFile(cpuRoot / "online", "0-3");
+    for (int cpu = 0; cpu < 4; ++cpu) {
+        fs::path dir = cpuRoot / ("cpu" + std::to_string(cpu));
+        writeFile(dir / "topology" / "physical_package_id", "0");
+        writeFile(dir / "topology" / "core_id", std::to_string(cpu % 2));
+        writeFile(dir / "topology" / "thread_siblings_list", cpu % 2 == 0 ? "0,2" : "1,3");
+    }
+    writeStat({{100, 100}, {100, 100}, {100, 100}, {100, 100}});
+
+    auto monitor = createLinuxSystemMonitor(root.string());
+    std::vector<double> utilization;
+    monitor->sampleCpuUtilization(utilization);
+    EXPECT_FALSE(monitor->refreshOnlineCpus());
+
+    // SMT off: the siblings leave the online list, /proc/cpuinfo and /proc/stat
+    writeFile(cpuRoot / "online", "0-1");
+    writeFile(root / "proc" / "cpuinfo", "processor\t: 0\nprocessor\t: 1");
+    writeStat({{150, 150}, {200, 100}});
+
+    ASSERT_TRUE(monitor->refreshOnlineCpus());
+    EXPECT_EQ(2, monitor->getCpuCoreCount());
+    EXPECT_EQ(2u, monitor->getCpuTopology().getCpus().size());
+    EXPECT_FALSE(monitor->refreshOnlineCpus());
+
+    ASSERT_TRUE(monitor->sampleCpuUtilization(utilization));
+    ASSERT_EQ(2u, utilization.size());
+    EXPECT_DOUBLE_EQ(0.5, utilization[0]);
+    EXPECT_DOUBLE_EQ(1.0, utilization[1]);
+}
+
+// Test package domains on a two-socket machine
+TEST_F(TestLinuxSystemMonitor, test_package_domains_merge_numa_nodes_per_socket) {
+    fs::path cpuRoot = root / "sys" / "devices" / "system" / "cpu";
+    for (int cpu = 0; cpu < 6; ++cpu) {
+        fs::path dir = cpuRoot / ("cpu" + std::to_string(cpu));
+        writeFile(dir / "topology" / "physical_package_id", cpu < 4 ? "0" : "1");
+        writeFile(dir / "topology" / "core_id", std::to_string(cpu % 4));
+    }
+    // Sub-NUMA clustering splits package 0 into two nodes; node 3 has memory only
+    fs::path nodeRoot = root / "sys" / "devices" / "system" / "node";
+    writeFile(nodeRoot / "node0" / "cpulist", "0-1");
+    writeFile(nodeRoot / "node1" / "cpulist", "2-3");
+    writeFile(nodeRoot / "node2" / "cpulist", "4-5");
+    writeFile(nodeRoot / "node3" / "cpulist", "");
+
+    auto monitor = createLinuxSystemMonitor(root.string());
+    std::vector<ControlDomain> domains = monitor->getControlDomains(ControlDomainScope::PACKAGE);
+
+    ASSERT_EQ(2u, domains.size());
+    EXPECT_EQ("package0", domains[0].name);
+    EXPECT_EQ((std::vector<int>{0, 1, 2, 3}), domains[0].cpus);
+    EXPECT_EQ(ControlDomainScope::PACKAGE, domains[1].scope);
+    EXPECT_EQ(1, domains[1].package);
+    EXPECT_EQ((std::vector<int>{4, 5}), domains[1].cpus);
+    EXPECT_TRUE(monitor->getControlDomains(ControlDomainScope::SYSTEM).empty());
+}
@@ -0,0 +1,237 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include "platform/linux/linux_tlp_compiler.h"
+#include "platform/linux/linux_power_backends.h"
+#include "mocks/fake_sysfs_fixture.h"
+
+namespace fs = std::filesystem;
+
+class TestLinuxTlpCompiler : public FakeSysfsTest {
+protected:
+    TestLinuxTlpCompiler() : FakeSysfsTest("tlp_root") {}
+
+    fs::path cpu() const { return root / "sys" / "devices" / "system" / "cpu"; }
+
+    // Helper: intel_pstate machine with two policies and a platform profile
+    void createIntelMachine() {
+        for (int i = 0; i < 2; ++i) {
+            fs::path policy = cpu() / "cpufreq" / ("policy" + std::to_string(i));
+            writeFile(policy / "scaling_governor", "powersave");
+            writeFile(policy / "energy_performance_preference", "balance_performance");
+        }
+        writeFile(cpu() / "intel_pstate" / "no_turbo", "0");
+        writeFile(cpu() / "intel_pstate" / "min_perf_pct", "9");
+        writeFile(cpu() / "intel_pstate" / "max_perf_pct", "100");
+        writeFile(root / "sys" / "firmware" / "acpi" / "platform_profile", "balanced");
+    }
+
+    // Helper: PCI device with a runtime PM control file and an optional driver
+    void createPciDevice(const std::string& address, const std::string& driver) {
+        fs::path device = root / "sys" / "bus" / "pci" / "devices" / address;
+        writeFile(device / "power" / "control", "on");
+        if (!driver.empty()) {
+            fs::path driverDir = root / "sys" / "bus" / "pci" / "drivers" / driver;
+            fs::create_directories(driverDir);
+            fs::create_symlink(driverDir, device / "driver");
+        }
+    }
+
+    static std::vector<std::string> writtenPaths(const CompiledTlpProfile& profile) {
+        std::vector<std::string> paths;
+        for (const auto& write : profile.writes) {
+            paths.push_back(write.path);
+        }
+        return paths;
+    }
+};
+
+// Test configuration loading
+TEST_F(TestLinuxTlpCompiler, test_load_follows_tlp_precedence_and_syntax) {
+    writeFile(root / "usr" / "share" / "tlp" / "defaults.conf",
+              "CPU_BOOST_ON_BAT=1\nRUNTIME_PM_DRIVER_DENYLIST=\"mei_me nouveau\"");
+    writeFile(root / "etc" / "tlp.d" / "20-late.conf", "CPU_BOOST_ON_BAT=0\nCPU_MAX_PERF_ON_BAT=60");
+    writeFile(root / "etc" / "tlp.d" / "10-early.conf", "CPU_MAX_PERF_ON_BAT=40\nRUNTIME_PM_DRIVER_DENYLIST+=\"radeon\"");
+    writeFile(root / "etc" / "tlp.conf",
+              "# comment\n"
+              "  CPU_SCALING_GOVERNOR_ON_BAT=powersave   # trailing comment\n"
+              "CPU_ENERGY_PERF_POLICY_ON_BAT=\"balance_power\"\n"
+              "CPU_MAX_PERF_ON_BAT=50\n"
+              "not a parameter\n");
+
+    LinuxTlpCompiler compiler(root.string());
+    ASSERT_TRUE(compiler.load());
+
+    EXPECT_EQ("powersave", compiler.getParameter("CPU_SCALING_GOVERNOR_ON_BAT").value());
+    EXPECT_EQ("balance_power", compiler.getParameter("CPU_ENERGY_PERF_POLICY_ON_BAT").value());
+    // tlp.conf wins over drop-ins, drop-ins are read in lexical order
+    EXPECT_EQ("50", compiler.getParameter("CPU_MAX_PERF_ON_BAT").value());
+    EXPECT_EQ("0", compiler.getParameter("CPU_BOOST_ON_BAT").value());
+    EXPECT_EQ("mei_me nouveau radeon", compiler.getParameter("RUNTIME_PM_DRIVER_DENYLIST").value());
+    EXPECT_TRUE(compiler.isEnabled());
+}
+
+TEST_F(TestLinuxTlpCompiler, test_load_without_user_configuration_fails) {
+    writeFile(root / "usr" / "share" / "tlp" / "defaults.conf", "CPU_BOOST_ON_AC=1");
+
+    LinuxTlpCompiler compiler(root.string());
+
+    EXPECT_FALSE(compiler.load());
+}
+
+// Test profile compilation
+TEST_F(TestLinuxTlpCompiler, test_compile_cpu_knobs_in_dependency_order) {
+    createIntelMachine();
+    writeFile(root / "etc" / "tlp.conf",
+              "PLATFORM_PROFILE_ON_BAT=low-power\n"
+              "CPU_SCALING_GOVERNOR_ON_BAT=powersave\n"
+              "CPU_ENERGY_PERF_POLICY_ON_BAT=power\n"
+              "CPU_MIN_PERF_ON_BAT=0\n"
+              "CPU_MAX_PERF_ON_BAT=30\n"
+              "CPU_BOOST_ON_BAT=0\n"
+              "PCIE_ASPM_ON_BAT=powersupersave\n");
+
+    LinuxTlpCompiler compiler(root.string());
+    ASSERT_TRUE(compiler.load());
+    CompiledTlpProfile profile = compiler.compile(TlpProfile::BAT);
+
+    EXPECT_TRUE(profile.isNativeCapable());
+    ASSERT_EQ(9u, profile.writes.size());  // PCIE_ASPM target is missing on this machine
+
+    EXPECT_EQ((root / "sys" / "firmware" / "acpi" / "platform_profile").string(), profile.writes[0].path);
+    EXPECT_EQ("low-power", profile.writes[0].value);
+    EXPECT_EQ("CPU_SCALING_GOVERNOR_ON_BAT", profile.writes[1].knob);
+
+    // min, max, min so intel_pstate clamping cannot leave a stale limit
+    EXPECT_EQ("CPU_MIN_PERF_ON_BAT", profile.writes[3].knob);
+    EXPECT_EQ("CPU_MAX_PERF_ON_BAT", profile.writes[4].knob);
+    EXPECT_EQ("CPU_MIN_PERF_ON_BAT", profile.writes[5].knob);
+
+    // CPU_BOOST=0 means no_turbo=1
+    EXPECT_EQ((cpu() / "intel_pstate" / "no_turbo").string(), profile.writes[6].path);
+    EXPECT_EQ("1", profile.writes[6].value);
+
+    // EPP comes after the governor
+    EXPECT_EQ("power", profile.writes[7].value);
+    EXPECT_EQ("CPU_ENERGY_PERF_POLICY_ON_BAT", profile.writes[8].knob);
+}
+
+TEST_F(TestLinuxTlpCompiler, test_compile_skips_epp_under_performance_governor) {
+    createIntelMachine();
+    writeFile(root / "etc" / "tlp.conf",
+              "CPU_SCALING_GOVERNOR_ON_AC=performance\n"
+              "CPU_ENERGY_PERF_POLICY_ON_AC=performance\n");
+
+    LinuxTlpCompiler compiler(root.string());
+    ASSERT_TRUE(compiler.load());
+    CompiledTlpProfile profile = compiler.compile(TlpProfile::AC);
+
+    ASSERT_EQ(2u, profile.writes.size());
+    EXPECT_EQ("CPU_SCALING_GOVERNOR_ON_AC", profile.writes[0].knob);
+    EXPECT_EQ("CPU_SCALING_GOVERNOR_ON_AC", profile.writes[1].knob);
+}
+
+TEST_F(TestLinuxTlpCompiler, test_unsupported_user_parameters_require_tlp) {
+    createIntelMachine();
+    writeFile(root / "usr" / "share" / "tlp" / "defaults.conf", "WIFI_PWR_ON_AC=off\nWIFI_PWR_ON_BAT=on");
+    writeFile(root / "etc" / "tlp.conf",
+              "CPU_BOOST_ON_AC=1\n"
+              "CPU_BOOST_ON_BAT=0\n"
+              "SATA_LINKPWR_ON_BAT=\"med_power_with_dipm min_power\"\n"
+              "START_CHARGE_THRESH_BAT0=75\n");
+
+    LinuxTlpCompiler compiler(root.string());
+    ASSERT_TRUE(compiler.load());
+
+    // Intrinsic WIFI_PWR defaults and mode independent parameters do not force tlp
+    EXPECT_TRUE(compiler.compile(TlpProfile::AC).isNativeCapable());
+
+    CompiledTlpProfile battery = compiler.compile(TlpProfile::BAT);
+    EXPECT_FALSE(battery.isNativeCapable());
+    ASSERT_EQ(1u, battery.unsupported.size());
+    EXPECT_EQ("SATA_LINKPWR_ON_BAT", battery.unsupported.front());
+}
+
+TEST_F(TestLinuxTlpCompiler, test_compile_runtime_pm_honours_deny_lists) {
+    createPciDevice("0000:00:02.0", "i915");
+    createPciDevice("0000:00:16.0", "mei_me");
+    createPciDevice("0000:00:1f.3", "snd_hda_intel");
+    createPciDevice("0000:01:00.0", "");
+    writeFile(root / "etc" / "tlp.conf",
+              "RUNTIME_PM_ON_BAT=auto\n"
+              "RUNTIME_PM_DENYLIST=\"00:1f.3\"\n"
+              "RUNTIME_PM_DISABLE=\"01:00.0\"\n");
+
+    LinuxTlpCompiler compiler(root.string());
+    ASSERT_TRUE(compiler.load());
+    CompiledTlpProfile profile = compiler.compile(TlpProfile::BAT);
+
+    fs::path devices = root / "sys" / "bus" / "pci" / "devices";
+    std::vector<std::string> paths = writtenPaths(profile);
+    ASSERT_EQ(2u, paths.size());
+    EXPECT_EQ((devices / "0000:00:02.0" / "power" / "control").string(), paths[0]);
+    EXPECT_EQ("auto", profile.writes[0].value);
+    // RUNTIME_PM_DISABLE keeps the device powered regardless of the profile
+    EXPECT_EQ((devices / "0000:01:00.0" / "power" / "control").string(), paths[1]);
+    EXPECT_EQ("on", profile.writes[1].value);
+}
+
+TEST_F(TestLinuxTlpCompiler, test_tlp_enable_zero_disables_tlp) {
+    writeFile(root / "etc" / "tlp.conf", "TLP_ENABLE=0");
+
+    LinuxTlpCompiler compiler(root.string());
+    ASSERT_TRUE(compiler.load());
+
+    EXPECT_FALSE(compiler.isEnabled());
+}
+
+// Test native application through the TLP backend
+TEST_F(TestLinuxTlpCompiler, test_tlp_backend_applies_supported_profile_natively) {
+    createIntelMachine();
+    writeFile(root / "etc" / "tlp.conf",
+              "CPU_ENERGY_PERF_POLICY_ON_AC=balance_performance\n"
+              "CPU_ENERGY_PERF_POLICY_ON_BAT=power\n"
+              "CPU_BOOST_ON_AC=1\n"
+              "CPU_BOOST_ON_BAT=0\n");
+
+    auto powerManager = createLinuxPowerManager(root.string());
+
+    EXPECT_TRUE(powerManager->setPowerSavingMode());
+    EXPECT_EQ("power", readFile(cpu() / "cpufreq" / "policy1" / "energy_performance_preference"));
+    EXPECT_EQ("1", readFile(cpu() / "intel_pstate" / "no_turbo"));
+    EXPECT_EQ("powersaving", powerManager->getCurrentMode());
+
+    EXPECT_TRUE(powerManager->setPerformanceMode());
+    EXPECT_EQ("balance_performance", readFile(cpu() / "cpufreq" / "policy0" / "energy_performance_preference"));
+    EXPECT_EQ("0", readFile(cpu() / "intel_pstate" / "no_turbo"));
+    EXPECT_EQ("performance", powerManager->getCurrentMode());
+}
+
+// Test that a profile's turbo switch is left to the turbo controller
+TEST_F(TestLinuxTlpCompiler, test_tlp_backend_ignores_switch_owned_by_turbo_controller) {
+    createIntelMachine();
+    writeFile(root / "etc" / "tlp.conf",
+              "CPU_ENERGY_PERF_POLICY_ON_BAT=power\n"
+              "CPU_BOOST_ON_AC=1\n"
+              "CPU_BOOST_ON_BAT=0\n");
+
+    auto powerManager = createLinuxPowerManager(root.string());
+    auto turboController = createLinuxTurboController(cpu().string(), (root / "sys" / "class" / "thermal").string());
+    ASSERT_TRUE(turboController->initialize(TurboSettings{}));
+
+    ASSERT_TRUE(powerManager->setPowerSavingMode());
+    EXPECT_EQ("1", readFile(cpu() / "intel_pstate" / "no_turbo"));
+    powerManager->ignoreExternalChanges(turboController->getControlledAttributes());
+
+    // The controller switching turbo on is not an external change
+    turboController->setTier(PowerTier::PERFORMANCE);
+    ASSERT_EQ("0", readFile(cpu() / "intel_pstate" / "no_turbo"));
+    EXPECT_TRUE(powerManager->detectExternalChanges().empty());
+
+    // The rest of the profile is still watched
+    writeFile(cpu() / "cpufreq" / "policy0" / "energy_performance_preference", "performance");
+    std::vector<ExternalChange> changes = powerManager->detectExternalChanges();
+    ASSERT_EQ(1u, changes.size());
+    EXPECT_EQ((cpu() / "cpufreq" / "policy0" / "energy_performance_preference").string(), changes[0].setting);
+}
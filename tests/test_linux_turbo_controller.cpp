@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include "platform/linux/linux_power_backends.h"
+#include "mocks/fake_sysfs_fixture.h"
+
+namespace fs = std::filesystem;
+
+class TestLinuxTurboController : public FakeSysfsTest {
+protected:
+    TestLinuxTurboController() : FakeSysfsTest("turbo") {}
+
+    void SetUp() override {
+        FakeSysfsTest::SetUp();
+
+        // Fake /sys/devices/system/cpu and /sys/class/thermal
+        fs::create_directories(cpuRoot());
+        fs::create_directories(thermalRoot());
+    }
+
+    fs::path cpuRoot() const { return root / "cpu"; }
+    fs::path thermalRoot() const { return root / "thermal"; }
+
+    // Helper: package zone plus a hotter zone that does not belong to the CPU
+    void createThermalZones(const std::string& packageTemp) {
+        writeFile(thermalRoot() / "thermal_zone0" / "type", "acpitz");
+        writeFile(thermalRoot() / "thermal_zone0" / "temp", "99000");
+        writeFile(thermalRoot() / "thermal_zone1" / "type", "x86_pkg_temp");
+        writeFile(thermalRoot() / "thermal_zone1" / "temp", packageTemp);
+    }
+
+    std::unique_ptr<ITurboController> createController() {
+        return createLinuxTurboController(cpuRoot().string(), thermalRoot().string());
+    }
+};
+
+// Test switch discovery
+TEST_F(TestLinuxTurboController, test_initialize_fails_without_turbo_switch) {
+    auto controller = createController();
+
+    EXPECT_FALSE(controller->initialize(TurboSettings{}));
+}
+
+// Test switching
+TEST_F(TestLinuxTurboController, test_no_turbo_follows_confirmed_burst_and_restores) {
+    writeFile(cpuRoot() / "intel_pstate" / "no_turbo", "0");
+    createThermalZones("60000");
+    auto controller = createController();
+    ASSERT_TRUE(controller->initialize(TurboSettings{}));
+
+    // Quiet: turbo off
+    controller->update({0.1, 0.2});
+    EXPECT_EQ("1", readFile(cpuRoot() / "intel_pstate" / "no_turbo"));
+
+    // The busiest CPU decides; the second busy sample confirms the burst
+    controller->update({0.1, 0.95});
+    EXPECT_EQ("1", readFile(cpuRoot() / "intel_pstate" / "no_turbo"));
+    // The boost callback runs once the switch is written
+    std::string stateAtBoost;
+    controller->setBoostCallback([&]() { stateAtBoost = readFile(cpuRoot() / "intel_pstate" / "no_turbo"); });
+    controller->update({0.1, 0.95});
+    EXPECT_EQ("0", stateAtBoost);
+    EXPECT_EQ("0", readFile(cpuRoot() / "intel_pstate" / "no_turbo"));
+    EXPECT_EQ(1, controller->getMetrics().activations);
+
+    controller->update({0.1, 0.1});
+    EXPECT_TRUE(controller->restore());
+    EXPECT_EQ("0", readFile(cpuRoot() / "intel_pstate" / "no_turbo"));
+}
+
+TEST_F(TestLinuxTurboController, test_boost_follows_tier_within_thermal_headroom) {
+    writeFile(cpuRoot() / "cpufreq" / "boost", "1");
+    createThermalZones("70000");
+    auto controller = createController();
+    ASSERT_TRUE(controller->initialize(TurboSettings{}));
+
+    // The hot acpitz zone is ignored because a package zone exists
+    controller->setTier(PowerTier::PERFORMANCE);
+    EXPECT_EQ("1", readFile(cpuRoot() / "cpufreq" / "boost"));
+
+    writeFile(thermalRoot() / "thermal_zone1" / "temp", "90000");
+    controller->update({0.5});
+    EXPECT_EQ("0", readFile(cpuRoot() / "cpufreq" / "boost"));
+    EXPECT_EQ(1, controller->getMetrics().thermalDenials);
+
+    // A tier change re-applies the decision even if a backend wrote the switch
+    writeFile(cpuRoot() / "cpufreq" / "boost", "1");
+    controller->setTier(PowerTier::POWER_SAVE);
+    EXPECT_EQ("0", readFile(cpuRoot() / "cpufreq" / "boost"));
+}
+
+// Test refused writes
+TEST_F(TestLinuxTurboController, test_refused_switch_is_retried_only_when_the_decision_changes) {
+    writeFile(cpuRoot() / "cpufreq" / "boost", "1");
+    auto controller = createController();
+    ASSERT_TRUE(controller->initialize(TurboSettings{}));
+    int boosts = 0;
+    controller->setBoostCallback([&]() { ++boosts; });
+
+    // A directory cannot be written, even as root
+    fs::remove(cpuRoot() / "cpufreq" / "boost");
+    fs::create_directories(cpuRoot() / "cpufreq" / "boost");
+    controller->setTier(PowerTier::PERFORMANCE);
+    EXPECT_EQ(0, boosts);
+
+    // The same decision does not write again, even across tier requests
+    fs::remove_all(cpuRoot() / "cpufreq" / "boost");
+    writeFile(cpuRoot() / "cpufreq" / "boost", "0");
+    controller->update({0.5});
+    controller->setTier(PowerTier::PERFORMANCE);
+    EXPECT_EQ("0", readFile(cpuRoot() / "cpufreq" / "boost"));
+
+    // A new decision does
+    controller->setTier(PowerTier::POWER_SAVE);
+    controller->setTier(PowerTier::PERFORMANCE);
+    EXPECT_EQ("1", readFile(cpuRoot() / "cpufreq" / "boost"));
+    EXPECT_EQ(1, boosts);
+}
+
+TEST_F(TestLinuxTurboController, test_initialize_refuses_turbo_disabled_by_firmware) {
+    // no_turbo reads 1 and rejects 0, as intel_pstate does when the firmware disabled turbo
+    fs::create_directories(cpuRoot() / "intel_pstate");
+    fs::create_symlink("/proc/version", cpuRoot() / "intel_pstate" / "no_turbo");
+    auto controller = createController();
+
+    EXPECT_FALSE(controller->initialize(TurboSettings{}));
+}
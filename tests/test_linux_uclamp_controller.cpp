@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include "platform/linux/linux_power_backends.h"
+#include "mocks/fake_sysfs_fixture.h"
+
+namespace fs = std::filesystem;
+
+class TestLinuxUclampController : public FakeSysfsTest {
+protected:
+    TestLinuxUclampController() : FakeSysfsTest("uclamp") {}
+
+    void SetUp() override {
+        FakeSysfsTest::SetUp();
+
+        // Fake /sys/fs/cgroup with an interactive and a background slice
+        writeFile(cgroupRoot() / "user.slice/cpu.uclamp.min", "0.00");
+        writeFile(cgroupRoot() / "background.slice/cpu.uclamp.max", "max");
+        writeFile(root / "cpu/cpufreq/policy0/scaling_governor", "schedutil");
+    }
+
+    fs::path cgroupRoot() const { return root / "cgroup"; }
+
+    std::unique_ptr<IUclampController> createController() {
+        return createLinuxUclampController(cgroupRoot().string(), (root / "cpu").string());
+    }
+};
+
+// Test clamps below the performance tier
+TEST_F(TestLinuxUclampController, test_clamps_are_held_below_performance_tier) {
+    auto controller = createController();
+    ASSERT_TRUE(controller->initialize({"user.slice"}, 30, {"background.slice"}, 40));
+
+    controller->setTier(PowerTier::POWER_SAVE);
+    EXPECT_EQ("30", readFile(cgroupRoot() / "user.slice/cpu.uclamp.min"));
+    EXPECT_EQ("40", readFile(cgroupRoot() / "background.slice/cpu.uclamp.max"));
+
+    controller->setTier(PowerTier::BALANCED_PERFORMANCE);
+    EXPECT_EQ("30", readFile(cgroupRoot() / "user.slice/cpu.uclamp.min"));
+
+    controller->setTier(PowerTier::PERFORMANCE);
+    EXPECT_EQ("0.00", readFile(cgroupRoot() / "user.slice/cpu.uclamp.min"));
+    EXPECT_EQ("max", readFile(cgroupRoot() / "background.slice/cpu.uclamp.max"));
+}
+
+TEST_F(TestLinuxUclampController, test_restore_writes_back_original_clamps) {
+    auto controller = createController();
+    ASSERT_TRUE(controller->initialize({"user.slice", "missing.slice"}, 30, {}, 50));
+    controller->setTier(PowerTier::BALANCED_POWER);
+    ASSERT_EQ("30", readFile(cgroupRoot() / "user.slice/cpu.uclamp.min"));
+
+    EXPECT_TRUE(controller->restore());
+    EXPECT_EQ("0.00", readFile(cgroupRoot() / "user.slice/cpu.uclamp.min"));
+    EXPECT_FALSE(fs::exists(cgroupRoot() / "missing.slice"));
+
+    EXPECT_FALSE(createController()->initialize({"missing.slice"}, 30, {"user.slice"}, 50));
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include "pi_controller.h"
+
+class TestPiController : public ::testing::Test {
+protected:
+    static PiControllerSettings makeSettings() {
+        PiControllerSettings settings;
+        settings.kp = 0.5;
+        settings.ki = 0.2;
+        settings.deadband = 0.05;
+        settings.outputMin = 0.25;
+        settings.outputMax = 1.0;
+        settings.maxStep = 0.25;
+        return settings;
+    }
+};
+
+// Test the control direction
+TEST_F(TestPiController, test_low_measurement_lowers_output_until_minimum) {
+    PiController controller(makeSettings(), 1.0);
+
+    double previous = controller.getOutput();
+    for (int i = 0; i < 20; ++i) {
+        double output = controller.update(0.75, 0.10);
+        EXPECT_LE(output, previous);
+        previous = output;
+    }
+    EXPECT_DOUBLE_EQ(0.25, controller.getOutput());
+
+    // A busy sample pushes the output back up
+    EXPECT_GT(controller.update(0.75, 1.0), 0.25);
+}
+
+// Test deadband
+TEST_F(TestPiController, test_errors_inside_deadband_hold_output) {
+    PiController controller(makeSettings(), 0.6);
+
+    EXPECT_DOUBLE_EQ(0.6, controller.update(0.75, 0.72));
+    EXPECT_DOUBLE_EQ(0.6, controller.update(0.75, 0.79));
+}
+
+// Test slew limit
+TEST_F(TestPiController, test_output_change_per_update_is_limited) {
+    PiController controller(makeSettings(), 1.0);
+
+    // Error of -0.75 asks for a drop far beyond one step
+    EXPECT_DOUBLE_EQ(0.75, controller.update(0.75, 0.0));
+}
+
+// Test reset
+TEST_F(TestPiController, test_reset_clamps_and_clears_integral) {
+    PiController controller(makeSettings(), 1.0);
+    controller.update(0.75, 0.0);
+    controller.update(0.75, 0.0);
+
+    controller.reset(2.0);
+
+    EXPECT_DOUBLE_EQ(1.0, controller.getOutput());
+    EXPECT_DOUBLE_EQ(1.0, controller.update(0.75, 0.75));
+}
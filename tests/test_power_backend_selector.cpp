@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <thread>
+#include <unistd.h>
+#include "power_backend_selector.h"
+#include "logger.h"
+#include "mocks/mock_power_manager.h"
+
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class TestPowerBackendSelector : public ::testing::Test {
+protected:
+    struct BackendBehaviour {
+        bool available{true};
+        bool capable{true};
+        std::chrono::milliseconds switchDelay{0};
+    };
+
+    void SetUp() override {
+        // Suppress logger output during tests
+        Logger::setLevel(LogLevel::ERROR);
+
+        stateDir = std::filesystem::temp_directory_path() /
+                   ("ddogreen_selector_" + std::to_string(getpid()) + "_" +
+                    ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(stateDir);
+        cacheFile = (stateDir / "power_backend.cache").string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(stateDir);
+
+        // Restore logger level
+        Logger::setLevel(LogLevel::INFO);
+    }
+
+    // Helper: candidate backed by a mock whose behaviour is looked up at creation time
+    PowerBackendCandidate makeCandidate(const std::string& name) {
+        return {name, [this, name]() -> std::unique_ptr<IPowerManager> {
+            ++created[name];
+            const BackendBehaviour& behaviour = behaviours[name];
+            auto backend = std::make_unique<NiceMock<MockPowerManager>>();
+            ON_CALL(*backend, getBackendName()).WillByDefault(Return(name));
+            ON_CALL(*backend, isAvailable()).WillByDefault(Return(behaviour.available));
+            ON_CALL(*backend, reapplyCurrentMode()).WillByDefault([behaviour]() {
+                std::this_thread::sleep_for(behaviour.switchDelay);
+                return behaviour.capable;
+            });
+            return backend;
+        }};
+    }
+
+    std::vector<PowerBackendCandidate> makeCandidates() {
+        return {makeCandidate("epp"), makeCandidate("ppd"), makeCandidate("tlp")};
+    }
+
+    std::filesystem::path stateDir;
+    std::string cacheFile;
+    std::map<std::string, BackendBehaviour> behaviours;
+    std::map<std::string, int> created;
+};
+
+// Test automatic selection
+TEST_F(TestPowerBackendSelector, test_auto_selects_fastest_capable_backend) {
+    behaviours["epp"] = {true, true, std::chrono::milliseconds(15)};
+    behaviours["ppd"] = {true, true, std::chrono::milliseconds(0)};
+    behaviours["tlp"] = {false, true, std::chrono::milliseconds(0)};
+
+    PowerBackendSelector selector(makeCandidates());
+    auto backend = selector.select();
+
+    ASSERT_NE(nullptr, backend);
+    EXPECT_EQ("ppd", selector.getSelectedName());
+    EXPECT_EQ("ppd", backend->getBackendName());
+    ASSERT_EQ(3u, selector.getProbeResults().size());
+    EXPECT_TRUE(selector.getProbeResults()[0].capable);
+    EXPECT_FALSE(selector.getProbeResults()[2].available);
+}
+
+TEST_F(TestPowerBackendSelector, test_capability_outranks_latency_and_close_latencies_keep_default_order) {
+    behaviours["epp"] = {true, true, std::chrono::milliseconds(15)};
+    behaviours["ppd"] = {true, true, std::chrono::milliseconds(0)};
+    behaviours["tlp"] = {true, true, std::chrono::milliseconds(0)};
+
+    std::vector<PowerBackendCandidate> ranked = makeCandidates();
+    ranked[0].capability = 1;
+    PowerBackendSelector capable(std::move(ranked));
+    ASSERT_NE(nullptr, capable.select());
+    EXPECT_EQ("epp", capable.getSelectedName());
+
+    // Within twice the latency, the earlier backend in the default order stays
+    behaviours["epp"] = {true, true, std::chrono::milliseconds(15)};
+    behaviours["ppd"] = {true, true, std::chrono::milliseconds(10)};
+    behaviours["tlp"] = {false, true, std::chrono::milliseconds(0)};
+    PowerBackendSelector close(makeCandidates());
+    ASSERT_NE(nullptr, close.select());
+    EXPECT_EQ("epp", close.getSelectedName());
+}
+
+TEST_F(TestPowerBackendSelector, test_backend_failing_idempotent_switch_is_not_capable) {
+    behaviours["epp"] = {true, false, std::chrono::milliseconds(0)};
+    behaviours["ppd"] = {false, true, std::chrono::milliseconds(0)};
+    behaviours["tlp"] = {true, true, std::chrono::milliseconds(5)};
+
+    PowerBackendSelector selector(makeCandidates());
+    auto backend = selector.select();
+
+    ASSERT_NE(nullptr, backend);
+    EXPECT_EQ("tlp", selector.getSelectedName());
+    EXPECT_TRUE(selector.getProbeResults()[0].available);
+    EXPECT_FALSE(selector.getProbeResults()[0].capable);
+}
+
+TEST_F(TestPowerBackendSelector, test_no_capable_backend_returns_null) {
+    behaviours["epp"] = {false, true, std::chrono::milliseconds(0)};
+    behaviours["ppd"] = {true, false, std::chrono::milliseconds(0)};
+    behaviours["tlp"] = {false, true, std::chrono::milliseconds(0)};
+
+    PowerBackendSelector selector(makeCandidates());
+    selector.setCacheFile(cacheFile);
+
+    EXPECT_EQ(nullptr, selector.select());
+    EXPECT_TRUE(selector.getSelectedName().empty());
+    EXPECT_FALSE(std::filesystem::exists(cacheFile));
+}
+
+// Test configured order
+TEST_F(TestPowerBackendSelector, test_preferred_order_takes_first_capable_backend) {
+    behaviours["epp"] = {true, true, std::chrono::milliseconds(0)};
+    behaviours["ppd"] = {false, true, std::chrono::milliseconds(0)};
+    behaviours["tlp"] = {true, true, std::chrono::milliseconds(10)};
+
+    PowerBackendSelector selector(makeCandidates());
+    selector.setPreferredOrder({"ppd", "tlp", "unknown"});
+    auto backend = selector.select();
+
+    ASSERT_NE(nullptr, backend);
+    EXPECT_EQ("tlp", selector.getSelectedName());
+    // Backends missing from the order are never probed
+    EXPECT_EQ(0, created["epp"]);
+    EXPECT_EQ(2u, selector.getProbeResults().size());
+}
+
+// Test selection cache
+TEST_F(TestPowerBackendSelector, test_cached_selection_skips_probing) {
+    behaviours["epp"] = {true, true, std::chrono::milliseconds(10)};
+    behaviours["ppd"] = {true, true, std::chrono::milliseconds(0)};
+    behaviours["tlp"] = {true, true, std::chrono::milliseconds(10)};
+
+    PowerBackendSelector first(makeCandidates());
+    first.setCacheFile(cacheFile);
+    ASSERT_NE(nullptr, first.select());
+    EXPECT_FALSE(first.usedCache());
+    ASSERT_TRUE(std::filesystem::exists(cacheFile));
+
+    created.clear();
+    PowerBackendSelector second(makeCandidates());
+    second.setCacheFile(cacheFile);
+    auto backend = second.select();
+
+    ASSERT_NE(nullptr, backend);
+    EXPECT_TRUE(second.usedCache());
+    EXPECT_EQ("ppd", second.getSelectedName());
+    EXPECT_EQ(0, created["epp"]);
+    EXPECT_EQ(0, created["tlp"]);
+    EXPECT_TRUE(second.getProbeResults().empty());
+}
+
+TEST_F(TestPowerBackendSelector, test_cache_invalidated_by_order_change_or_unavailable_backend) {
+    behaviours["epp"] = {true, true, std::chrono::milliseconds(0)};
+    behaviours["ppd"] = {true, true, std::chrono::milliseconds(10)};
+    behaviours["tlp"] = {true, true, std::chrono::milliseconds(10)};
+
+    PowerBackendSelector first(makeCandidates());
+    first.setCacheFile(cacheFile);
+    ASSERT_NE(nullptr, first.select());
+    EXPECT_EQ("epp", first.getSelectedName());
+
+    // A different configured order must not reuse the automatic choice
+    PowerBackendSelector reordered(makeCandidates());
+    reordered.setCacheFile(cacheFile);
+    reordered.setPreferredOrder({"tlp"});
+    ASSERT_NE(nullptr, reordered.select());
+    EXPECT_FALSE(reordered.usedCache());
+    EXPECT_EQ("tlp", reordered.getSelectedName());
+
+    // The cached backend disappearing triggers a new probe
+    behaviours["tlp"].available = false;
+    PowerBackendSelector afterRemoval(makeCandidates());
+    afterRemoval.setCacheFile(cacheFile);
+    afterRemoval.setPreferredOrder({"tlp", "ppd"});
+    ASSERT_NE(nullptr, afterRemoval.select());
+    EXPECT_FALSE(afterRemoval.usedCache());
+    EXPECT_EQ("ppd", afterRemoval.getSelectedName());
+}
+
+TEST_F(TestPowerBackendSelector, test_cache_with_other_version_is_ignored) {
+    behaviours["epp"] = {true, true, std::chrono::milliseconds(0)};
+    behaviours["ppd"] = {true, true, std::chrono::milliseconds(10)};
+    behaviours["tlp"] = {true, true, std::chrono::milliseconds(10)};
+
+    std::filesystem::create_directories(stateDir);
+    std::ofstream(cacheFile) << "version=0\norder=auto\ncandidates=epp,ppd,tlp\nbackend=tlp\n";
+
+    PowerBackendSelector selector(makeCandidates());
+    selector.setCacheFile(cacheFile);
+    ASSERT_NE(nullptr, selector.select());
+
+    EXPECT_FALSE(selector.usedCache());
+    EXPECT_EQ("epp", selector.getSelectedName());
+}
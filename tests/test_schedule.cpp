@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <ctime>
+#include "schedule.h"
+#include "logger.h"
+
+class TestSchedule : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Suppress logger output during tests
+        Logger::setLevel(LogLevel::ERROR);
+    }
+
+    void TearDown() override {
+        // Restore logger level
+        Logger::setLevel(LogLevel::INFO);
+    }
+
+    // Helper: broken-down time for a weekday (0 = Sunday) and clock time
+    static std::tm makeTime(int weekday, int hour, int minute) {
+        std::tm time{};
+        time.tm_wday = weekday;
+        time.tm_hour = hour;
+        time.tm_min = minute;
+        return time;
+    }
+
+    // Helper: local wall clock time point (2025-01-06 is a Monday)
+    static std::chrono::system_clock::time_point makeTimePoint(int dayOfMonth, int hour, int minute) {
+        std::tm time{};
+        time.tm_year = 2025 - 1900;
+        time.tm_mon = 0;
+        time.tm_mday = dayOfMonth;
+        time.tm_hour = hour;
+        time.tm_min = minute;
+        time.tm_isdst = -1;
+        return std::chrono::system_clock::from_time_t(std::mktime(&time));
+    }
+
+    // Helper: schedule with weekday office hours and a nightly build window
+    static Schedule makeOfficeSchedule() {
+        Schedule schedule;
+        EXPECT_TRUE(schedule.addProfile("interactive", "high=0.6,low=0.2"));
+        EXPECT_TRUE(schedule.addProfile("batch", "high=0.9,low=0.5,active=balance_performance"));
+        EXPECT_TRUE(schedule.addProfile("build", "hold=performance"));
+        EXPECT_TRUE(schedule.addWindow("* 02:00-03:00 build"));
+        EXPECT_TRUE(schedule.addWindow("mon-fri 09:00-18:00 interactive"));
+        EXPECT_TRUE(schedule.addWindow("* 18:00-09:00 batch"));
+        return schedule;
+    }
+};
+
+// Test profile parsing
+TEST_F(TestSchedule, test_add_profile_parses_thresholds_and_tiers) {
+    Schedule schedule;
+
+    EXPECT_TRUE(schedule.addProfile("batch", "high=0.9, low=0.5, active=balance_performance, idle=power"));
+
+    ASSERT_EQ(1u, schedule.getProfiles().size());
+    const auto& profile = schedule.getProfiles().front();
+    EXPECT_DOUBLE_EQ(0.9, profile.highPerformanceThreshold.value());
+    EXPECT_DOUBLE_EQ(0.5, profile.powerSaveThreshold.value());
+    EXPECT_EQ(PowerTier::BALANCED_PERFORMANCE, profile.activeTier);
+    EXPECT_EQ(PowerTier::POWER_SAVE, profile.idleTier);
+    EXPECT_FALSE(profile.holdTier.has_value());
+}
+
+TEST_F(TestSchedule, test_add_profile_rejects_invalid_specifications) {
+    Schedule schedule;
+
+    EXPECT_FALSE(schedule.addProfile("a", "high=1.5"));
+    EXPECT_FALSE(schedule.addProfile("b", "low=0.6,high=0.5"));
+    EXPECT_FALSE(schedule.addProfile("c", "hold=turbo"));
+    EXPECT_FALSE(schedule.addProfile("d", "speed=fast"));
+    EXPECT_FALSE(schedule.addProfile("e", "high"));
+    EXPECT_TRUE(schedule.addProfile("f", "hold=performance"));
+    EXPECT_FALSE(schedule.addProfile("f", "hold=power"));
+}
+
+// Test window parsing
+TEST_F(TestSchedule, test_add_window_rejects_invalid_specifications) {
+    Schedule schedule;
+
+    EXPECT_FALSE(schedule.addWindow("mon-fri 09:00-18:00"));
+    EXPECT_FALSE(schedule.addWindow("someday 09:00-18:00 p"));
+    EXPECT_FALSE(schedule.addWindow("* 9-18 p"));
+    EXPECT_FALSE(schedule.addWindow("* 25:00-26:00 p"));
+    EXPECT_FALSE(schedule.addWindow("* 09:00-09:00 p"));
+    EXPECT_FALSE(schedule.addWindow("* 09:00-18:00 p extra"));
+    EXPECT_TRUE(schedule.addWindow("sat,sun 00:00-24:00 p"));
+}
+
+TEST_F(TestSchedule, test_validate_detects_undefined_profiles) {
+    Schedule schedule;
+    EXPECT_TRUE(schedule.addWindow("* 09:00-18:00 missing"));
+
+    EXPECT_FALSE(schedule.validate());
+
+    EXPECT_TRUE(schedule.addProfile("missing", "high=0.8"));
+    EXPECT_TRUE(schedule.validate());
+}
+
+// Test profile lookup
+TEST_F(TestSchedule, test_active_profile_follows_weekday_windows) {
+    Schedule schedule = makeOfficeSchedule();
+
+    // Wednesday 10:00 - office hours
+    const ScheduleProfile* profile = schedule.activeProfileAt(makeTime(3, 10, 0));
+    ASSERT_NE(nullptr, profile);
+    EXPECT_EQ("interactive", profile->name);
+
+    // Saturday 10:00 - weekend falls back to nothing (batch ends at 09:00)
+    EXPECT_EQ(nullptr, schedule.activeProfileAt(makeTime(6, 10, 0)));
+}
+
+TEST_F(TestSchedule, test_active_profile_handles_windows_wrapping_midnight) {
+    Schedule schedule = makeOfficeSchedule();
+
+    // Tuesday 23:30 - evening part of the batch window
+    const ScheduleProfile* evening = schedule.activeProfileAt(makeTime(2, 23, 30));
+    ASSERT_NE(nullptr, evening);
+    EXPECT_EQ("batch", evening->name);
+
+    // Wednesday 05:00 - morning part of the window started on Tuesday
+    const ScheduleProfile* morning = schedule.activeProfileAt(makeTime(3, 5, 0));
+    ASSERT_NE(nullptr, morning);
+    EXPECT_EQ("batch", morning->name);
+}
+
+TEST_F(TestSchedule, test_first_matching_window_wins) {
+    Schedule schedule = makeOfficeSchedule();
+
+    // 02:30 is inside both the build and the batch windows
+    const ScheduleProfile* profile = schedule.activeProfileAt(makeTime(4, 2, 30));
+    ASSERT_NE(nullptr, profile);
+    EXPECT_EQ("build", profile->name);
+    EXPECT_EQ(PowerTier::PERFORMANCE, profile->holdTier.value());
+}
+
+TEST_F(TestSchedule, test_day_ranges_wrap_around_week_end) {
+    Schedule schedule;
+    EXPECT_TRUE(schedule.addProfile("weekend", "high=0.9"));
+    EXPECT_TRUE(schedule.addWindow("fri-mon 12:00-13:00 weekend"));
+
+    EXPECT_NE(nullptr, schedule.activeProfileAt(makeTime(5, 12, 30)));
+    EXPECT_NE(nullptr, schedule.activeProfileAt(makeTime(0, 12, 30)));
+    EXPECT_NE(nullptr, schedule.activeProfileAt(makeTime(1, 12, 30)));
+    EXPECT_EQ(nullptr, schedule.activeProfileAt(makeTime(3, 12, 30)));
+}
+
+// Test boundary computation
+TEST_F(TestSchedule, test_next_boundary_is_next_window_edge) {
+    Schedule schedule = makeOfficeSchedule();
+
+    // Monday 2025-01-06 10:15 -> office hours end at 18:00 the same day
+    auto next = schedule.nextBoundaryAfter(makeTimePoint(6, 10, 15));
+    EXPECT_EQ(makeTimePoint(6, 18, 0), next);
+
+    // Monday 18:00 exactly -> the boundary is strictly after, so the next is 02:00 Tuesday
+    next = schedule.nextBoundaryAfter(makeTimePoint(6, 18, 0));
+    EXPECT_EQ(makeTimePoint(7, 2, 0), next);
+
+    // Saturday 2025-01-11 10:00 -> next edge is the batch window start at 18:00
+    next = schedule.nextBoundaryAfter(makeTimePoint(11, 10, 0));
+    EXPECT_EQ(makeTimePoint(11, 18, 0), next);
+}
+
+TEST_F(TestSchedule, test_next_boundary_of_empty_schedule_is_never) {
+    Schedule schedule;
+
+    EXPECT_EQ(std::chrono::system_clock::time_point::max(),
+              schedule.nextBoundaryAfter(std::chrono::system_clock::now()));
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "turbo_policy.h"
+
+using namespace std::chrono_literals;
+
+class TestTurboPolicy : public ::testing::Test {
+protected:
+    static TurboSettings makeSettings() {
+        TurboSettings settings;
+        settings.burstThreshold = 0.8;
+        settings.burstSamples = 2;
+        settings.budget = 0.5;
+        settings.window = 60s;
+        settings.thermalLimit = 90.0;
+        settings.thermalHysteresis = 10.0;
+        return settings;
+    }
+
+    std::chrono::steady_clock::time_point start{};
+};
+
+// Test burst confirmation
+TEST_F(TestTurboPolicy, test_burst_must_be_confirmed_before_turbo) {
+    TurboPolicy policy(makeSettings());
+
+    EXPECT_FALSE(policy.update(0.95, std::nullopt, start));
+    EXPECT_TRUE(policy.update(0.95, std::nullopt, start + 5s));
+    EXPECT_FALSE(policy.update(0.30, std::nullopt, start + 10s));
+
+    // A single busy sample after a quiet one does not count as a burst
+    EXPECT_FALSE(policy.update(0.95, std::nullopt, start + 15s));
+    EXPECT_EQ(1, policy.getMetrics().activations);
+}
+
+TEST_F(TestTurboPolicy, test_performance_tier_wants_turbo_without_burst) {
+    TurboPolicy policy(makeSettings());
+    policy.setTier(PowerTier::PERFORMANCE);
+
+    EXPECT_TRUE(policy.evaluate(std::nullopt, start));
+
+    policy.setTier(PowerTier::BALANCED_PERFORMANCE);
+    EXPECT_FALSE(policy.evaluate(std::nullopt, start + 1s));
+}
+
+// Test limits
+TEST_F(TestTurboPolicy, test_budget_limits_turbo_per_window) {
+    TurboPolicy policy(makeSettings());
+    policy.setTier(PowerTier::PERFORMANCE);
+
+    // 30 s of turbo spends the 50% budget of the 60 s window
+    EXPECT_TRUE(policy.evaluate(std::nullopt, start));
+    EXPECT_TRUE(policy.evaluate(std::nullopt, start + 20s));
+    EXPECT_FALSE(policy.evaluate(std::nullopt, start + 30s));
+    EXPECT_FALSE(policy.evaluate(std::nullopt, start + 50s));
+    EXPECT_EQ(2, policy.getMetrics().budgetDenials);
+
+    // The next window starts with a fresh budget
+    EXPECT_TRUE(policy.evaluate(std::nullopt, start + 61s));
+    EXPECT_EQ(2, policy.getMetrics().activations);
+}
+
+TEST_F(TestTurboPolicy, test_thermal_limit_withdraws_turbo_with_hysteresis) {
+    TurboPolicy policy(makeSettings());
+    policy.setTier(PowerTier::PERFORMANCE);
+
+    EXPECT_TRUE(policy.evaluate(70.0, start));
+    EXPECT_FALSE(policy.evaluate(92.0, start + 1s));
+    EXPECT_FALSE(policy.evaluate(85.0, start + 2s));
+    EXPECT_TRUE(policy.evaluate(79.0, start + 3s));
+    EXPECT_EQ(2, policy.getMetrics().thermalDenials);
+}
+
+// Test metrics
+TEST_F(TestTurboPolicy, test_residency_tracks_time_with_turbo_enabled) {
+    TurboPolicy policy(makeSettings());
+
+    policy.evaluate(std::nullopt, start);
+    policy.setTier(PowerTier::PERFORMANCE);
+    policy.evaluate(std::nullopt, start + 10s);
+    policy.setTier(PowerTier::POWER_SAVE);
+    policy.evaluate(std::nullopt, start + 20s);
+    policy.evaluate(std::nullopt, start + 40s);
+
+    const TurboMetrics& metrics = policy.getMetrics();
+    EXPECT_EQ(40000, metrics.observed.count());
+    EXPECT_EQ(10000, metrics.residency.count());
+    EXPECT_DOUBLE_EQ(0.25, metrics.residencyFraction());
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+#include "warm_start_state.h"
+#include "logger.h"
+
+class TestWarmStartState : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Suppress logger output during tests
+        Logger::setLevel(LogLevel::ERROR);
+
+        stateDir = std::filesystem::temp_directory_path() /
+                   ("ddogreen_warm_start_" + std::to_string(getpid()) + "_" +
+                    ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(stateDir);
+        stateFile = (stateDir / "warm_start.state").string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(stateDir);
+
+        // Restore logger level
+        Logger::setLevel(LogLevel::INFO);
+    }
+
+    std::filesystem::path stateDir;
+    std::string stateFile;
+};
+
+// Test a save/load round trip, creating the state directory
+TEST_F(TestWarmStartState, test_saved_state_loads_back) {
+    WarmStartStore store(stateFile);
+    WarmStartState state;
+    state.backend = "tlp";
+    state.tier = PowerTier::BALANCED_POWER;
+    state.runs = 3;
+    state.actuation.succeeded = 12;
+    state.actuation.partial = 1;
+    state.conflicts = 2;
+
+    ASSERT_TRUE(store.save(state));
+    EXPECT_FALSE(std::filesystem::exists(stateFile + ".tmp"));
+
+    auto loaded = store.load();
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ("tlp", loaded->backend);
+    ASSERT_TRUE(loaded->tier.has_value());
+    EXPECT_EQ(PowerTier::BALANCED_POWER, *loaded->tier);
+    EXPECT_EQ(3, loaded->runs);
+    EXPECT_EQ(12, loaded->actuation.succeeded);
+    EXPECT_EQ(1, loaded->actuation.partial);
+    EXPECT_EQ(0, loaded->actuation.failed);
+    EXPECT_EQ(2, loaded->conflicts);
+
+    // Per-domain control leaves no system tier
+    state.tier.reset();
+    ASSERT_TRUE(store.save(state));
+    loaded = store.load();
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_FALSE(loaded->tier.has_value());
+}
+
+// Test that missing, foreign-version and damaged files are ignored
+TEST_F(TestWarmStartState, test_unusable_files_are_ignored) {
+    WarmStartStore store(stateFile);
+    EXPECT_FALSE(store.load().has_value());
+
+    WarmStartState state;
+    state.backend = "epp";
+    state.tier = PowerTier::PERFORMANCE;
+    ASSERT_TRUE(store.save(state));
+
+    auto rewrite = [this](const std::string& from, const std::string& to) {
+        std::ifstream in(stateFile);
+        std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        in.close();
+        content.replace(content.find(from), from.size(), to);
+        std::ofstream(stateFile, std::ios::trunc) << content;
+    };
+
+    rewrite("version=1", "version=0");
+    EXPECT_FALSE(store.load().has_value());
+
+    rewrite("version=0", "version=1");
+    rewrite("tier=performance", "tier=turbo");
+    EXPECT_FALSE(store.load().has_value());
+
+    rewrite("tier=turbo", "tier=performance");
+    rewrite("runs=0", "runs=many");
+    EXPECT_FALSE(store.load().has_value());
+
+    // An empty path disables the store
+    WarmStartStore disabled("");
+    EXPECT_FALSE(disabled.save(state));
+    EXPECT_FALSE(disabled.load().has_value());
+}
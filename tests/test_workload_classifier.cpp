@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "workload_classifier.h"
+
+class TestWorkloadClassifier : public ::testing::Test {
+protected:
+    static PerfCounters stalls(uint64_t cycles, uint64_t instructions, uint64_t stalled) {
+        PerfCounters counters;
+        counters.cycles = cycles;
+        counters.instructions = instructions;
+        counters.stalledCycles = stalled;
+        return counters;
+    }
+};
+
+// Test classification
+TEST_F(TestWorkloadClassifier, test_stalled_low_ipc_load_is_memory_bound) {
+    WorkloadClassifier classifier(0.5);
+
+    EXPECT_EQ(WorkloadClass::MEMORY_BOUND, classifier.update(stalls(1000000000, 400000000, 700000000)));
+    EXPECT_NEAR(0.4, classifier.getIpc(), 1e-9);
+    EXPECT_NEAR(0.7, classifier.getMemoryBoundedness(), 1e-9);
+}
+
+TEST_F(TestWorkloadClassifier, test_high_ipc_keeps_load_compute_bound) {
+    WorkloadClassifier classifier(0.5);
+
+    // Stalls overlap with useful work when the core still retires two instructions per cycle
+    EXPECT_EQ(WorkloadClass::COMPUTE_BOUND, classifier.update(stalls(1000000000, 2000000000, 600000000)));
+    EXPECT_EQ(WorkloadClass::COMPUTE_BOUND, classifier.update(stalls(1000000000, 2500000000, 100000000)));
+}
+
+TEST_F(TestWorkloadClassifier, test_cache_misses_per_instruction_without_stall_counter) {
+    WorkloadClassifier classifier(0.5);
+    PerfCounters counters;
+    counters.cycles = 1000000000;
+    counters.instructions = 500000000;
+
+    // 30 misses per thousand instructions is past the fully bound mark
+    counters.llcMisses = 15000000;
+    EXPECT_EQ(WorkloadClass::MEMORY_BOUND, classifier.update(counters));
+    EXPECT_NEAR(1.0, classifier.getMemoryBoundedness(), 1e-9);
+
+    counters.llcMisses = 500000;
+    EXPECT_EQ(WorkloadClass::COMPUTE_BOUND, classifier.update(counters));
+}
+
+// Test stability
+TEST_F(TestWorkloadClassifier, test_exit_margin_prevents_flapping) {
+    WorkloadClassifier classifier(0.5);
+
+    ASSERT_EQ(WorkloadClass::MEMORY_BOUND, classifier.update(stalls(1000000000, 400000000, 600000000)));
+    EXPECT_EQ(WorkloadClass::MEMORY_BOUND, classifier.update(stalls(1000000000, 400000000, 400000000)));
+    EXPECT_EQ(WorkloadClass::COMPUTE_BOUND, classifier.update(stalls(1000000000, 400000000, 300000000)));
+}
+
+TEST_F(TestWorkloadClassifier, test_quiet_interval_keeps_class) {
+    WorkloadClassifier classifier(0.5);
+
+    ASSERT_EQ(WorkloadClass::MEMORY_BOUND, classifier.update(stalls(1000000000, 400000000, 700000000)));
+    EXPECT_EQ(WorkloadClass::MEMORY_BOUND, classifier.update(stalls(1000000, 4000000, 0)));
+}
+
+TEST_F(TestWorkloadClassifier, test_missing_memory_event_is_unknown) {
+    WorkloadClassifier classifier(0.5);
+    PerfCounters counters;
+    counters.cycles = 1000000000;
+    counters.instructions = 400000000;
+
+    EXPECT_EQ(WorkloadClass::UNKNOWN, classifier.update(counters));
+    EXPECT_EQ("unknown", workloadClassToString(classifier.getClass()));
+}